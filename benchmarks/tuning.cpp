@@ -0,0 +1,278 @@
+/*
+ * Measures the crossover points between the multiplication and division algorithms of aarith on
+ * the machine it runs on and writes them as a header aarith/tuning.hpp. If that header is found on
+ * the include path, aarith uses the measured thresholds instead of its defaults.
+ *
+ * Usage: aarith-tuning [output file]
+ *
+ * Without an output file, the header is written to the standard output. The progress of the
+ * measurements is reported on the standard error.
+ */
+#include <aarith/integer_no_operators.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace aarith; // NOLINT
+
+namespace {
+
+using word = uint64_t;
+using words = std::vector<word>;
+
+constexpr size_t word_width = implementation::bits_per_word<word>();
+
+// the results of the measured computations are stored here so that they are not optimized away
+volatile word sink{0U}; // NOLINT
+
+words random_words(const size_t n)
+{
+    static std::mt19937_64 generator{42U}; // NOLINT
+    words result(n);
+    for (auto& w : result)
+    {
+        w = generator();
+    }
+    // make sure that the number really has n significant words
+    result.back() |= word{1U} << (word_width - 1);
+    return result;
+}
+
+/*
+ * Returns the times of single calls of the two functions in nanoseconds. The functions are called
+ * often enough for a single measurement to take a few milliseconds. The measurements of both
+ * functions alternate and the best of several measurements is returned, so that other processes
+ * slowing down the machine for a while affect both functions alike.
+ */
+std::pair<double, double> measure(const std::function<void()>& f, const std::function<void()>& g)
+{
+    using clock = std::chrono::steady_clock;
+    constexpr auto min_duration = std::chrono::milliseconds{4};
+    constexpr size_t rounds = 7;
+
+    const auto calls_for = [min_duration](const std::function<void()>& h) {
+        size_t calls = 1;
+        for (;;)
+        {
+            const auto start = clock::now();
+            for (size_t i = 0; i < calls; ++i)
+            {
+                h();
+            }
+            if (clock::now() - start >= min_duration)
+            {
+                return calls;
+            }
+            calls *= 2;
+        }
+    };
+    const auto time = [](const std::function<void()>& h, const size_t calls) {
+        const auto start = clock::now();
+        for (size_t i = 0; i < calls; ++i)
+        {
+            h();
+        }
+        const std::chrono::duration<double, std::nano> duration = clock::now() - start;
+        return duration.count() / static_cast<double>(calls);
+    };
+
+    const size_t calls_f = calls_for(f);
+    const size_t calls_g = calls_for(g);
+    double best_f = std::numeric_limits<double>::max();
+    double best_g = std::numeric_limits<double>::max();
+    for (size_t round = 0; round < rounds; ++round)
+    {
+        best_f = std::min(best_f, time(f, calls_f));
+        best_g = std::min(best_g, time(g, calls_g));
+    }
+    return {best_f, best_g};
+}
+
+// the number of words grows by a quarter from one step to the next
+std::vector<size_t> word_counts(const size_t from, const size_t to)
+{
+    std::vector<size_t> counts;
+    for (size_t n = from; n <= to; n = std::max(n + 1, n + n / 4))
+    {
+        counts.push_back(n);
+    }
+    return counts;
+}
+
+using multiplication = std::function<words(const words&, const words&)>;
+
+/*
+ * Returns the smallest number of words from which on the second algorithm is faster than the
+ * first one. To not be fooled by a single noisy measurement, the second algorithm has to win for
+ * two consecutive numbers of words. If it never wins, the largest number of words tried plus one
+ * is returned.
+ */
+size_t crossover(const std::string& name, const std::vector<size_t>& counts,
+                 const multiplication& first, const multiplication& second)
+{
+    size_t candidate = 0;
+    bool won_before = false;
+    for (const size_t n : counts)
+    {
+        const words a = random_words(n);
+        const words b = random_words(n);
+        const auto [time_first, time_second] = measure([&]() { sink = first(a, b).back(); },
+                                                       [&]() { sink = second(a, b).back(); });
+        std::cerr << name << ": " << n * word_width << " bits: " << time_first << " ns vs. "
+                  << time_second << " ns\n";
+
+        if (time_second < time_first)
+        {
+            if (won_before)
+            {
+                return candidate;
+            }
+            won_before = true;
+            candidate = n;
+        }
+        else
+        {
+            won_before = false;
+        }
+    }
+    return counts.back() + 1;
+}
+
+words schoolbook(const words& a, const words& b)
+{
+    words product(a.size() + b.size());
+    implementation::mul_words(product.data(), a.data(), a.size(), b.data(), b.size());
+    return product;
+}
+
+words karatsuba(const words& a, const words& b)
+{
+    words product(a.size() + b.size());
+    words scratch(implementation::karatsuba_scratch_words<word>(a.size(), b.size()));
+    implementation::mul_words_karatsuba(product.data(), a.data(), a.size(), b.data(), b.size(),
+                                        scratch.data());
+    return product;
+}
+
+words toom3(const words& a, const words& b)
+{
+    return implementation::mul_words_toom(a, b, 3);
+}
+
+words toom4(const words& a, const words& b)
+{
+    return implementation::mul_words_toom(a, b, 4);
+}
+
+words ntt(const words& a, const words& b)
+{
+    return implementation::mul_words_ntt(a, b);
+}
+
+words truncated_schoolbook(const words& a, const words& b)
+{
+    words product(a.size());
+    implementation::mul_words_truncated(product.data(), a.size(), a.data(), b.data());
+    return product;
+}
+
+/*
+ * Times the division of a number of twice the given width by a number of the given width. The
+ * widths are template parameters of the division algorithms, so only a fixed set of widths is
+ * measured.
+ */
+template <size_t W> bool long_division_wins()
+{
+    using U = uinteger<2 * W, word>;
+    const words n = random_words(U::word_count());
+    const words d = random_words(U::word_count() / 2);
+    const auto numerator = implementation::from_word_vector<U>(n);
+    const auto denominator = implementation::from_word_vector<U>(d);
+
+    const auto [time_restoring, time_long] =
+        measure([&]() { sink = restoring_division(numerator, denominator).first.word(0); },
+                [&]() { sink = long_division(numerator, denominator).first.word(0); });
+    std::cerr << "long division: " << 2 * W << " bits: " << time_restoring << " ns vs. "
+              << time_long << " ns\n";
+    return time_long < time_restoring;
+}
+
+template <size_t... Ws> size_t long_division_threshold()
+{
+    // the widths are tried in ascending order, the long division has to win for all larger ones
+    size_t threshold = 0;
+    ((threshold = long_division_wins<Ws>() ? threshold : 2 * Ws + 1), ...);
+    return threshold;
+}
+
+void write_threshold(std::ostream& out, const std::string& name, const size_t bits)
+{
+    out << "#ifndef " << name << "\n#define " << name << " " << bits << "\n#endif\n\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const size_t karatsuba_words =
+        crossover("karatsuba", word_counts(4, 256), schoolbook, karatsuba);
+    const size_t toom3_words = crossover("toom3", word_counts(16, 1024), karatsuba, toom3);
+    const size_t toom4_words =
+        crossover("toom4", word_counts(std::max<size_t>(toom3_words, 32), 4096), toom3, toom4);
+    const size_t ntt_words =
+        crossover("ntt", word_counts(std::max<size_t>(toom4_words, 256), 32768), toom4, ntt);
+
+    // the full product is computed using the algorithm chosen by the thresholds measured above
+    const auto full_product = [=](const words& a, const words& b) {
+        const size_t n = a.size();
+        if (n < karatsuba_words)
+        {
+            return schoolbook(a, b);
+        }
+        if (n < toom3_words)
+        {
+            return karatsuba(a, b);
+        }
+        if (n < toom4_words)
+        {
+            return toom3(a, b);
+        }
+        return (n < ntt_words) ? toom4(a, b) : ntt(a, b);
+    };
+    const size_t mul_expanding_words =
+        crossover("mul", word_counts(4, 8192), truncated_schoolbook, full_product);
+
+    const size_t long_division_bits = long_division_threshold<64, 128, 256, 512, 1024>();
+
+    std::ofstream file;
+    if (argc > 1)
+    {
+        file.open(argv[1]); // NOLINT
+        if (!file)
+        {
+            std::cerr << "could not open " << argv[1] << "\n"; // NOLINT
+            return 1;
+        }
+    }
+    std::ostream& out = (argc > 1) ? file : std::cout;
+
+    out << "#pragma once\n\n"
+        << "// Algorithm thresholds (in bits) measured by aarith-tuning, do not edit.\n\n";
+    write_threshold(out, "AARITH_KARATSUBA_THRESHOLD", karatsuba_words * word_width);
+    write_threshold(out, "AARITH_TOOM3_THRESHOLD", toom3_words * word_width);
+    write_threshold(out, "AARITH_TOOM4_THRESHOLD", toom4_words * word_width);
+    write_threshold(out, "AARITH_NTT_THRESHOLD", ntt_words * word_width);
+    write_threshold(out, "AARITH_MUL_EXPANDING_THRESHOLD", mul_expanding_words * word_width);
+    write_threshold(out, "AARITH_LONG_DIVISION_THRESHOLD", long_division_bits);
+
+    return 0;
+}
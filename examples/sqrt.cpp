@@ -62,7 +62,9 @@ int main()
               << "\taarith::float (exact): " << iterative_square_root(a, 6) << std::endl
               << "\taarith::float (anytime, full precision): " << iterative_square_root(a, 6, 48) << std::endl
               << "\taarith::float (anytime, 10 MSBs): " << iterative_square_root(a, 6, 10) << std::endl
-              << "\taarith::float (FAU adder): " << iterative_square_root_FAU<8, 23, 8, 4>(a, 6) << std::endl;
+              << "\taarith::float (FAU adder): " << iterative_square_root_FAU<8, 23, 8, 4>(a, 6) << std::endl
+              << "\taarith::float (digit recurrence): " << sqrt(a) << std::endl
+              << "\taarith::float (digit recurrence, 10 MSBs): " << anytime_sqrt(a, 10) << std::endl;
 
     return 0;
 }
@@ -71,8 +71,7 @@ template <int start, size_t iters, size_t heron_iter, size_t C> void compare_her
         const double abs_diff = static_cast<double>(abs(sub(res_exact, res_anytime)));
 
         const double res_anytime_float = static_cast<double>(res_anytime);
-        const double a_float = static_cast<double>(a);
-        const double res_float = static_cast<double>(sqrtf(a_float)); // NOLINT
+        const double res_float = static_cast<double>(sqrt(a));
         const double abs_diff_correct = std::abs(res_anytime_float - res_float);
 
         max_abs_diff = std::max(max_abs_diff, abs_diff);
@@ -84,7 +83,7 @@ template <int start, size_t iters, size_t heron_iter, size_t C> void compare_her
         //        std::cout << "sqrt_a(" << static_cast<float>(a) << ") = " <<
         //        static_cast<float>(res_anytime)
         //                  << "\n";
-        //        std::cout << "sqrt_f(" << a_float << ") = " << res_float << "\n";
+        //        std::cout << "sqrt_f(" << static_cast<float>(a) << ") = " << res_float << "\n";
         //        std::cout << "diff: " << abs_diff << "\n";
         //        std::cout << "diff_float: " << abs_diff_correct << "\n\n";
 
@@ -6,6 +6,10 @@
 #include <aarith/core/word_array_functional.hpp>
 #include <aarith/core/word_array_logical_operations.hpp>
 #include <aarith/core/word_array_operations.hpp>
+#include <aarith/core/word_array_view.hpp>
+#include <aarith/core/word_batch_operations.hpp>
+#include <aarith/core/word_multiplication.hpp>
+#include <aarith/core/word_operations.hpp>
 #include <aarith/core/word_array_shift_operations.hpp>
 
 #include <aarith/core/traits.hpp>
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <aarith/core/word_array_view.hpp>
+
+#include <ostream>
 #include <string>
 
 namespace aarith {
@@ -125,4 +128,29 @@ auto operator<<(std::ostream& out, const WA<W, WordType>& value) -> std::ostream
     return out;
 }
 
+/**
+ * @brief Converts the viewed bits into a bitstring
+ * @tparam Width Width of the view
+ * @tparam WordType Word type of the viewed words
+ * @param value The view
+ * @return The string of the viewed bits
+ */
+template <size_t Width, typename WordType>
+auto to_binary(const word_array_view<Width, WordType>& value) -> std::string
+{
+    return to_binary(value.to_word_array());
+}
+
+/**
+ * @brief Outputs the viewed bits to an output stream (grouped like the bits of a `word_array`)
+ * @tparam Width Width of the view
+ * @tparam WordType Word type of the viewed words
+ */
+template <size_t Width, typename WordType>
+auto operator<<(std::ostream& out, const word_array_view<Width, WordType>& value) -> std::ostream&
+{
+    out << group_digits(to_binary(value), word_array_view<Width, WordType>::word_width());
+    return out;
+}
+
 } // namespace aarith
\ No newline at end of file
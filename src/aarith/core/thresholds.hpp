@@ -0,0 +1,69 @@
+#pragma once
+
+/*
+ * The thresholds at which aarith switches between its algorithms. A header aarith/tuning.hpp
+ * generated by the aarith-tuning executable (see benchmarks/tuning.cpp) replaces the defaults with
+ * the thresholds measured on the build machine if it is found on the include path. Macros defined
+ * before including aarith take precedence over both.
+ */
+#if __has_include(<aarith/tuning.hpp>)
+#include <aarith/tuning.hpp>
+#endif
+
+/**
+ * @brief Minimal bit width of the operands for which the Karatsuba multiplication is used
+ *
+ * The value can be overwritten by defining the macro before including aarith.
+ */
+#ifndef AARITH_KARATSUBA_THRESHOLD
+#define AARITH_KARATSUBA_THRESHOLD 1536
+#endif
+
+/**
+ * @brief Minimal bit width of the operands for which the Toom-Cook 3 multiplication is used
+ *
+ * The value can be overwritten by defining the macro before including aarith.
+ */
+#ifndef AARITH_TOOM3_THRESHOLD
+#define AARITH_TOOM3_THRESHOLD 8192
+#endif
+
+/**
+ * @brief Minimal bit width of the operands for which the Toom-Cook 4 multiplication is used
+ *
+ * The value can be overwritten by defining the macro before including aarith.
+ */
+#ifndef AARITH_TOOM4_THRESHOLD
+#define AARITH_TOOM4_THRESHOLD 16384
+#endif
+
+/**
+ * @brief Minimal bit width of the operands for which the multiplication using number theoretic
+ * transforms is used
+ *
+ * The value can be overwritten by defining the macro before including aarith.
+ */
+#ifndef AARITH_NTT_THRESHOLD
+#define AARITH_NTT_THRESHOLD 262144
+#endif
+
+/**
+ * @brief Minimal bit width of the unsigned integers that mul multiplies by computing the full
+ * product using expanding_mul
+ *
+ * Below this width, only the words of the truncated product are computed using the schoolbook
+ * method. The value can be overwritten by defining the macro before including aarith.
+ */
+#ifndef AARITH_MUL_EXPANDING_THRESHOLD
+#define AARITH_MUL_EXPANDING_THRESHOLD 24576
+#endif
+
+/**
+ * @brief Minimal bit width of the unsigned integers that div and remainder divide using the long
+ * division (smaller ones use the restoring division)
+ *
+ * The value can be overwritten by defining the macro before including aarith.
+ */
+#ifndef AARITH_LONG_DIVISION_THRESHOLD
+#define AARITH_LONG_DIVISION_THRESHOLD 0
+#endif
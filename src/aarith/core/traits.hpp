@@ -31,6 +31,31 @@ public:
  */
 template <class Type> inline constexpr bool is_word_array_v = is_word_array<Type>::value;
 
+/**
+ * @brief Type trait to check if a type is a view onto external words
+ *
+ * @see `word_array_view`
+ *
+ * @tparam Type The type to check
+ */
+template <class Type> class is_word_array_view
+{
+public:
+    /**
+     * By default, no type is a view onto external words
+     */
+    static constexpr bool value = false;
+};
+
+/**
+ * @brief Test for a type being a view onto external words
+ *
+ * Helper for the `is_word_array_view` type trait
+ *
+ * @tparam Type Type to check for being a view onto external words
+ */
+template <class Type> inline constexpr bool is_word_array_view_v = is_word_array_view<Type>::value;
+
 /**
  * @brief Type trait to check if a type is an aarith integer
  * @tparam Type The Type to check
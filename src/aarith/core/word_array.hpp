@@ -1,6 +1,8 @@
 #pragma once
 
 #include <aarith/core/traits.hpp>
+#include <aarith/core/word_operations.hpp>
+#include <aarith/core/word_storage.hpp>
 
 #include <algorithm>
 #include <array>
@@ -13,6 +15,18 @@
 
 namespace aarith {
 
+/**
+ * @brief A fixed number of bits stored in words of the given type
+ *
+ * Word arrays of up to heap_storage_threshold bits store their words inline, wider ones on the
+ * heap (see implementation::word_storage_t). Either way, a moved-from word array stays valid: it
+ * can be read, modified, assigned to and destroyed. A word array that stores its words on the heap
+ * is zero after it was moved from (by construction or assignment) and allocates its words again
+ * when it is accessed the next time, a narrower one keeps its value.
+ *
+ * @tparam Width The number of bits
+ * @tparam WordType The type of the words
+ */
 template <size_t Width, class WordType = uint64_t> class word_array
 {
 public:
@@ -107,11 +121,23 @@ public:
      */
     explicit word_array(std::string_view bs)     {
         // TODO (keszocze) why isn't it constexpr? --> build a test case for that
-        for (auto i = bs.length(), pos = 0UL; i > 0 && pos < Width; --i, ++pos)
+        // the bits are collected word by word, each word is stored once it is complete
+        word_type current{0U};
+        auto i = bs.length();
+        size_t pos = 0UL;
+        for (; i > 0 && pos < Width; --i, ++pos)
         {
+            if (pos > 0 && pos % word_width() == 0)
+            {
+                set_word(pos / word_width() - 1, current);
+                current = word_type{0U};
+            }
             switch (bs[i - 1])
             {
-            case '1': this->set_bit(pos, true); break;
+            case '1':
+                current = static_cast<word_type>(
+                    current | static_cast<word_type>(word_type{1U} << (pos % word_width())));
+                break;
             case '0':
                 // it is already set to zero so we don't do anything
                 // this is just here to make explicit that we check for '1' and '0' only
@@ -123,6 +149,10 @@ public:
                                             std::string("\": expecting '1' and '0'only"));
             }
         }
+        if (pos > 0)
+        {
+            set_word((pos - 1) / word_width(), current);
+        }
     }
 
 
@@ -147,21 +177,43 @@ public:
     }
 
     /**
+     * @brief Overwrites the bits [end + V - 1, end] with the bits of other
+     *
+     * Bits that would be placed beyond the width of the word_array are ignored. For identical
+     * word types, only the affected words are modified.
      *
      * @tparam V Bit width of the word_array
      * @tparam T Word type to store the data in
-     * @param end
+     * @param end The index of the least significant bit to overwrite
      * @param other The word_array to take the values from
      */
-    template <size_t V, typename T> void set_bits(size_t end, const word_array<V, T>& other)
+    template <size_t V, typename T>
+    constexpr void set_bits(size_t end, const word_array<V, T>& other)
     {
 
         static_assert(V <= Width, "Can not create a word_array from larger container");
 
-        for (size_t i = 0; i < other.width(); i++)
+        if (end >= Width)
         {
-            const size_t index = i + end;
-            set_bit(index, other.bit(i));
+            return;
+        }
+        const size_t count = std::min(V, Width - end);
+
+        if constexpr (std::is_same_v<T, WordType>)
+        {
+            implementation::word_storage_t<WordType, word_array<V, T>::word_count()> source{};
+            for (size_t i = 0; i < other.word_count(); ++i)
+            {
+                source[i] = other.word(i);
+            }
+            implementation::insert_bits(words.data(), word_count(), source.data(), end, count);
+        }
+        else
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                set_bit(end + i, other.bit(i) != 0U);
+            }
         }
     }
 
@@ -236,13 +288,23 @@ public:
         return static_cast<bit_type>(masked_bit > 0 ? 1 : 0);
     }
 
+    /**
+     * @brief Returns Count consecutive bits starting at the given index
+     *
+     * The bits are extracted word by word, bits beyond the width of the word_array are zero.
+     *
+     * @tparam Count The number of bits to extract
+     * @param index The index of the least significant bit to extract
+     * @return The bits [index + Count - 1, index]
+     */
     template <size_t Count>
     [[nodiscard]] constexpr auto bits(size_t index) const -> word_array<Count, WordType>
     {
         word_array<Count, WordType> result;
-        for (auto i = 0U; i < Count; ++i)
+        for (size_t i = 0; i < result.word_count(); ++i)
         {
-            result.set_bit(i, bit(index + i));
+            result.set_word(i, implementation::extract_word(words.data(), word_count(),
+                                                            index + i * word_width()));
         }
         return result;
     }
@@ -507,7 +569,7 @@ private:
         return index;
     }
 
-    std::array<word_type, word_count()> words{{0}};
+    implementation::word_storage_t<word_type, word_count()> words{};
 };
 
 template <size_t Width, typename T> class is_word_array<word_array<Width, T>>
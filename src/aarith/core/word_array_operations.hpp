@@ -3,10 +3,139 @@
 #include <aarith/core/traits.hpp>
 #include <aarith/core/word_array.hpp>
 #include <aarith/core/word_array_cast_operations.hpp>
+#include <aarith/core/word_operations.hpp>
+
 #include <optional>
+#include <utility>
 
 namespace aarith {
 
+namespace implementation {
+
+/*
+ * The scans only use the static interface of the word container (word_count, word_width,
+ * word_mask) and word(), so they are shared by word arrays and views onto external words.
+ */
+
+template <typename W> constexpr size_t count_leading_zeroes_of(const W& value)
+{
+    using WordType = typename W::word_type;
+    // the most significant word only stores the remaining bits of the word_array
+    constexpr size_t unused_bits = W::word_count() * W::word_width() - W::width();
+
+    for (size_t i = W::word_count(); i > 0; --i)
+    {
+        const WordType w = value.word(i - 1);
+        if (w != WordType{0U})
+        {
+            return (W::word_count() - i) * W::word_width() + count_leading_zeroes_word(w) -
+                   unused_bits;
+        }
+    }
+    return W::width();
+}
+
+template <typename W> constexpr size_t count_leading_ones_of(const W& value)
+{
+    using WordType = typename W::word_type;
+    constexpr size_t unused_bits = W::word_count() * W::word_width() - W::width();
+
+    for (size_t i = W::word_count(); i > 0; --i)
+    {
+        // the unused bits of the most significant word are ones after the inversion
+        const WordType w = static_cast<WordType>(~value.word(i - 1) & W::word_mask(i - 1));
+        if (w != WordType{0U})
+        {
+            return (W::word_count() - i) * W::word_width() + count_leading_zeroes_word(w) -
+                   unused_bits;
+        }
+    }
+    return W::width();
+}
+
+template <typename W> constexpr size_t count_trailing_zeroes_of(const W& value)
+{
+    using WordType = typename W::word_type;
+
+    for (size_t i = 0; i < W::word_count(); ++i)
+    {
+        const WordType w = value.word(i);
+        if (w != WordType{0U})
+        {
+            return i * W::word_width() + count_trailing_zeroes_word(w);
+        }
+    }
+    return W::width();
+}
+
+template <typename W> constexpr size_t popcount_of(const W& value)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < W::word_count(); ++i)
+    {
+        count += popcount_word(value.word(i));
+    }
+    return count;
+}
+
+template <typename W> constexpr bool parity_of(const W& value)
+{
+    using WordType = typename W::word_type;
+
+    WordType combined{0U};
+    for (size_t i = 0; i < W::word_count(); ++i)
+    {
+        combined = static_cast<WordType>(combined ^ value.word(i));
+    }
+    return (popcount_word(combined) & 1U) != 0U;
+}
+
+template <typename W, typename F> constexpr void for_each_set_bit_of(const W& value, F&& f)
+{
+    using WordType = typename W::word_type;
+
+    for (size_t i = 0; i < W::word_count(); ++i)
+    {
+        WordType w = value.word(i);
+        while (w != WordType{0U})
+        {
+            f(i * W::word_width() + count_trailing_zeroes_word(w));
+            // clear the lowest bit set to one
+            w = static_cast<WordType>(w & (w - 1U));
+        }
+    }
+}
+
+template <typename W> constexpr std::optional<size_t> first_set_bit_of(const W& value)
+{
+    const size_t leading_zeroes = count_leading_zeroes_of(value);
+
+    if (leading_zeroes == W::width())
+    {
+        return std::nullopt;
+    }
+    else
+    {
+        return W::width() - (leading_zeroes + 1);
+    }
+}
+
+template <typename W> constexpr std::optional<size_t> first_unset_bit_of(const W& value)
+{
+    const size_t leading_ones = count_leading_ones_of(value);
+
+    if (leading_ones == W::width())
+    {
+        return std::nullopt;
+    }
+    else
+    {
+        return W::width() - (leading_ones + 1);
+    }
+}
+
+} // namespace implementation
+
 /**
  * @brief  Counts the number of bits set to zero before the first one appears (from MSB to LSB)
  * @tparam Width Width of the word_array
@@ -16,14 +145,7 @@ namespace aarith {
 template <size_t Width, typename WordType>
 constexpr size_t count_leading_zeroes(const word_array<Width, WordType>& value)
 {
-    for (auto i = Width; i > 0; --i)
-    {
-        if (value.bit(i - 1))
-        {
-            return (Width - i);
-        }
-    }
-    return Width;
+    return implementation::count_leading_zeroes_of(value);
 }
 
 /**
@@ -35,14 +157,60 @@ constexpr size_t count_leading_zeroes(const word_array<Width, WordType>& value)
 template <size_t Width, typename WordType>
 constexpr size_t count_leading_ones(const word_array<Width, WordType>& value)
 {
-    for (auto i = Width; i > 0; --i)
-    {
-        if (!value.bit(i - 1))
-        {
-            return (Width - i);
-        }
-    }
-    return Width;
+    return implementation::count_leading_ones_of(value);
+}
+
+/**
+ * @brief  Counts the number of bits set to zero before the first one appears (from LSB to MSB)
+ * @tparam Width Width of the word_array
+ * @param value The word to count the trailing zeroes in
+ * @return The number of trailing zeroes (Width if value contains zeroes only)
+ */
+template <size_t Width, typename WordType>
+constexpr size_t count_trailing_zeroes(const word_array<Width, WordType>& value)
+{
+    return implementation::count_trailing_zeroes_of(value);
+}
+
+/**
+ * @brief Counts the number of bits set to one
+ * @tparam Width Width of the word_array
+ * @param value The word_array whose ones are counted
+ * @return The number of ones in value
+ */
+template <size_t Width, typename WordType>
+constexpr size_t popcount(const word_array<Width, WordType>& value)
+{
+    return implementation::popcount_of(value);
+}
+
+/**
+ * @brief Computes the parity of the word_array
+ * @tparam Width Width of the word_array
+ * @param value The word_array whose parity is computed
+ * @return True if the number of ones in value is odd
+ */
+template <size_t Width, typename WordType>
+constexpr bool parity(const word_array<Width, WordType>& value)
+{
+    return implementation::parity_of(value);
+}
+
+/**
+ * @brief Calls a function for the index of every bit set to one (from LSB to MSB)
+ *
+ * The set bits are found word by word, i.e., the run time depends on the number of words and the
+ * number of ones but not on the number of zeroes within a word.
+ *
+ * @tparam Width Width of the word_array
+ * @tparam F Type of the function, it is called with a size_t
+ * @param value The word_array whose set bits are visited
+ * @param f The function that is called with the index of each set bit
+ */
+template <size_t Width, typename WordType, typename F>
+constexpr void for_each_set_bit(const word_array<Width, WordType>& value, F&& f)
+{
+    implementation::for_each_set_bit_of(value, std::forward<F>(f));
 }
 
 /**
@@ -54,18 +222,9 @@ constexpr size_t count_leading_ones(const word_array<Width, WordType>& value)
  * @return The index of the first set bit in value
  */
 template <size_t Width, typename WordType>
-std::optional<size_t> first_set_bit(const word_array<Width, WordType>& value)
+constexpr std::optional<size_t> first_set_bit(const word_array<Width, WordType>& value)
 {
-    const size_t leading_zeroes = count_leading_zeroes(value);
-
-    if (leading_zeroes == Width)
-    {
-        return std::nullopt;
-    }
-    else
-    {
-        return Width - (leading_zeroes + 1);
-    }
+    return implementation::first_set_bit_of(value);
 }
 
 /**
@@ -77,18 +236,9 @@ std::optional<size_t> first_set_bit(const word_array<Width, WordType>& value)
  * @return The index of the first set bit in value
  */
 template <size_t Width, typename WordType>
-std::optional<size_t> first_unset_bit(const word_array<Width, WordType>& value)
+constexpr std::optional<size_t> first_unset_bit(const word_array<Width, WordType>& value)
 {
-    const size_t leading_ones = count_leading_ones(value);
-
-    if (leading_ones == Width)
-    {
-        return std::nullopt;
-    }
-    else
-    {
-        return Width - (leading_ones + 1);
-    }
+    return implementation::first_unset_bit_of(value);
 }
 
 /**
@@ -126,7 +276,7 @@ bit_range(const word_array<W, WordType>& w)
     static_assert(S < W, "Range must start within the word");
     static_assert(E <= S, "Range must be positive (i.e. this method will not reverse the word");
 
-    return width_cast<(S - E) + 1>(w >> E);
+    return w.template bits<(S - E) + 1>(E);
 }
 
 /**
@@ -140,12 +290,11 @@ bit_range(const word_array<W, WordType>& w)
  * @return word_array of size W+V containing the bits of the inputs
  */
 template <size_t W, size_t V, typename WordType>
-word_array<W + V, WordType> concat(const word_array<W, WordType>& w,
-                                   const word_array<V, WordType>& v)
+constexpr word_array<W + V, WordType> concat(const word_array<W, WordType>& w,
+                                             const word_array<V, WordType>& v)
 {
-    word_array<W + V, WordType> result{w};
-    result = result << V;
-    result = result | word_array<W + V, WordType>{v};
+    word_array<W + V, WordType> result{v};
+    result.set_bits(V, w);
     return result;
 }
 
@@ -162,9 +311,9 @@ split(const word_array<W, WordType>& w)
 {
     static_assert(S < W - 1 && S >= 0);
 
-    const word_array<W - (S + 1), WordType> lhs{width_cast<W - (S + 1)>(w >> (S + 1))};
+    const word_array<W - (S + 1), WordType> lhs = w.template bits<W - (S + 1)>(S + 1);
 
-    const word_array<S + 1, WordType> rhs = width_cast<S + 1>(w);
+    const word_array<S + 1, WordType> rhs = w.template bits<S + 1>(0);
 
     return std::make_pair(lhs, rhs);
 }
@@ -2,6 +2,7 @@
 
 #include <aarith/core/traits.hpp>
 #include <aarith/core/word_array.hpp>
+#include <aarith/core/word_operations.hpp>
 
 namespace aarith {
 
@@ -30,6 +31,12 @@ constexpr W logical_left_shift(W& lhs, const size_t rhs)
         return lhs;
     }
 
+    if constexpr (W::word_count() > 1 && implementation::has_native_width<W>)
+    {
+        lhs = implementation::from_native<W>(implementation::to_native(lhs) << rhs);
+        return lhs;
+    }
+
     const auto skip_words = rhs / lhs.word_width();
     const auto shift_word_left = rhs - skip_words * lhs.word_width();
     const auto shift_word_right = lhs.word_width() - shift_word_left;
@@ -145,6 +152,12 @@ auto constexpr logical_right_shift(W& lhs, const size_t rhs) -> W
         return lhs;
     }
 
+    if constexpr (W::word_count() > 1 && implementation::has_native_width<W>)
+    {
+        lhs = implementation::from_native<W>(implementation::to_native(lhs) >> rhs);
+        return lhs;
+    }
+
     const auto skip_words = rhs / lhs.word_width();
     const auto shift_word_right = rhs - skip_words * lhs.word_width();
     const auto shift_word_left = lhs.word_width() - shift_word_right;
@@ -243,6 +256,15 @@ auto constexpr arithmetic_right_shift(W& lhs, const size_t rhs) -> W&
         return lhs;
     }
 
+    if constexpr (W::word_count() > 1 && implementation::has_native_width<W>)
+    {
+        using N = implementation::native_uint_t<Width>;
+        const N fill =
+            lhs_was_negative ? static_cast<N>(static_cast<N>(~N{0U}) << (Width - rhs)) : N{0U};
+        lhs = implementation::from_native<W>((implementation::to_native(lhs) >> rhs) | fill);
+        return lhs;
+    }
+
     const auto skip_words = rhs / lhs.word_width();
     const auto shift_word_right = rhs - skip_words * lhs.word_width();
     const auto shift_word_left = lhs.word_width() - shift_word_right;
@@ -350,14 +372,7 @@ constexpr W& rotate_through_carry_right(W& lhs, const bool carry_in, const U& ro
 template <typename W, typename = std::enable_if_t<is_word_array_v<W>>>
 constexpr W& rotate_left(W& lhs, size_t rotate = 1)
 {
-
-    // TODO (keszocze) offer this as a compile-time optimized version?
-    //    constexpr size_t width = W::width();
-    //    const auto slice = bit_range<width-1, width-R>(lhs);
-    //
-    //    lhs <<= R;
-    //    lhs.set_bits(0, slice);
-
+    // see rotate_left<N> for rotations by a number of bits known at compile time
     const size_t right_shift = lhs.width() - rotate;
     const auto slice = lhs >> right_shift;
     lhs <<= rotate;
@@ -421,4 +436,173 @@ constexpr W& rotate_right(W& lhs, const U& rotate = U::one())
     return rotate_right(lhs, static_cast<size_t>(rotate));
 }
 
-} // namespace aarith
\ No newline at end of file
+/**
+ * @brief Logical left shift by a number of bits known at compile time
+ *
+ * As the word and bit offsets are known at compile time, the shift consists of straight-line word
+ * moves and double word shifts without any branches.
+ *
+ * @tparam N The number of bits to shift
+ * @tparam W The word_container type to work on
+ * @param w The word_container to be shifted
+ * @return The shifted word_container
+ */
+template <size_t N, typename W, typename = std::enable_if_t<is_word_array_v<W>>>
+[[nodiscard]] constexpr W shift_left(const W& w)
+{
+    using word_type = typename W::word_type;
+    constexpr size_t skip_words = N / W::word_width();
+    constexpr size_t offset = N % W::word_width();
+
+    if constexpr (N == 0)
+    {
+        return w;
+    }
+    else if constexpr (N >= W::width())
+    {
+        return W{};
+    }
+    else if constexpr (W::word_count() > 1 && implementation::has_native_width<W>)
+    {
+        return implementation::from_native<W>(implementation::to_native(w) << N);
+    }
+    else
+    {
+        W result;
+        for (size_t i = W::word_count() - 1; i > skip_words; --i)
+        {
+            result.set_word(i, implementation::funnel_shift_left<offset>(
+                                   w.word(i - skip_words), w.word(i - skip_words - 1)));
+        }
+        result.set_word(skip_words, implementation::funnel_shift_left<offset>(w.word(0),
+                                                                              word_type{0U}));
+        return result;
+    }
+}
+
+/**
+ * @brief Logical right shift by a number of bits known at compile time
+ *
+ * As the word and bit offsets are known at compile time, the shift consists of straight-line word
+ * moves and double word shifts without any branches.
+ *
+ * @tparam N The number of bits to shift
+ * @tparam W The word_container type to work on
+ * @param w The word_container to be shifted
+ * @return The shifted word_container
+ */
+template <size_t N, typename W, typename = std::enable_if_t<is_word_array_v<W>>>
+[[nodiscard]] constexpr W shift_right(const W& w)
+{
+    using word_type = typename W::word_type;
+    constexpr size_t skip_words = N / W::word_width();
+    constexpr size_t offset = N % W::word_width();
+    constexpr size_t last = W::word_count() - 1;
+
+    if constexpr (N == 0)
+    {
+        return w;
+    }
+    else if constexpr (N >= W::width())
+    {
+        return W{};
+    }
+    else if constexpr (W::word_count() > 1 && implementation::has_native_width<W>)
+    {
+        return implementation::from_native<W>(implementation::to_native(w) >> N);
+    }
+    else
+    {
+        W result;
+        for (size_t i = 0; i + skip_words < last; ++i)
+        {
+            result.set_word(i, implementation::funnel_shift_right<offset>(
+                                   w.word(i + skip_words + 1), w.word(i + skip_words)));
+        }
+        result.set_word(last - skip_words,
+                        implementation::funnel_shift_right<offset>(word_type{0U}, w.word(last)));
+        return result;
+    }
+}
+
+/**
+ * @brief Arithmetic right shift by a number of bits known at compile time
+ *
+ * The most significant bit is shifted in. The sign is applied using a precomputed mask, i.e., the
+ * shift does not branch on the value of the word_container.
+ *
+ * @tparam N The number of bits to shift
+ * @tparam W The word_container type to work on
+ * @param w The word_container to be shifted
+ * @return The shifted word_container
+ */
+template <size_t N, typename W, typename = std::enable_if_t<is_word_array_v<W>>>
+[[nodiscard]] constexpr W arithmetic_shift_right(const W& w)
+{
+    using word_type = typename W::word_type;
+    constexpr size_t width = W::width();
+    constexpr size_t shift = (N < width) ? N : width - 1;
+
+    // ones in the bits that are shifted in
+    constexpr W fill = []() {
+        W ones;
+        ones.fill(static_cast<word_type>(~word_type{0U}));
+        return shift_left<width - shift>(ones);
+    }();
+    constexpr size_t first_fill_word = (width - shift) / W::word_width();
+
+    const auto sign = static_cast<word_type>(word_type{0U} - static_cast<word_type>(w.msb()));
+
+    W result = shift_right<shift>(w);
+    for (size_t i = first_fill_word; i < W::word_count(); ++i)
+    {
+        result.set_word(i, static_cast<word_type>(result.word(i) | (fill.word(i) & sign)));
+    }
+    return result;
+}
+
+/**
+ * @brief Rotates the word_container to the left by a number of bits known at compile time
+ *
+ * @tparam N The number of bits to rotate
+ * @tparam W The word_container type to work on
+ * @param w The word_container to be rotated
+ * @return The rotated word_container
+ */
+template <size_t N, typename W, typename = std::enable_if_t<is_word_array_v<W>>>
+[[nodiscard]] constexpr W rotate_left(const W& w)
+{
+    constexpr size_t rotate = N % W::width();
+
+    if constexpr (rotate == 0)
+    {
+        return w;
+    }
+    else
+    {
+        const W high = shift_left<rotate>(w);
+        const W low = shift_right<W::width() - rotate>(w);
+        W result;
+        for (size_t i = 0; i < W::word_count(); ++i)
+        {
+            result.set_word(i, static_cast<typename W::word_type>(high.word(i) | low.word(i)));
+        }
+        return result;
+    }
+}
+
+/**
+ * @brief Rotates the word_container to the right by a number of bits known at compile time
+ *
+ * @tparam N The number of bits to rotate
+ * @tparam W The word_container type to work on
+ * @param w The word_container to be rotated
+ * @return The rotated word_container
+ */
+template <size_t N, typename W, typename = std::enable_if_t<is_word_array_v<W>>>
+[[nodiscard]] constexpr W rotate_right(const W& w)
+{
+    return rotate_left<W::width() - (N % W::width())>(w);
+}
+
+} // namespace aarith
@@ -0,0 +1,825 @@
+#pragma once
+
+#include <aarith/core/traits.hpp>
+#include <aarith/core/word_array.hpp>
+#include <aarith/core/word_array_operations.hpp>
+#include <aarith/core/word_operations.hpp>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace aarith {
+
+/**
+ * @brief A non-owning view onto Width bits stored in external words
+ *
+ * The view only stores a pointer to the words (least significant word first, i.e. the layout of a
+ * word_array), so it can be placed on top of memory-mapped files or network buffers without
+ * copying them. The caller has to keep the words alive while the view is in use.
+ *
+ * A view of const words (e.g. word_array_view<256, const uint64_t>) only allows reading. A view of
+ * mutable words also allows modifying the words in place. Just like for std::span, constness of
+ * the view itself is not propagated to the words.
+ *
+ * Bits of the most significant word beyond Width are ignored when reading and left untouched when
+ * writing.
+ *
+ * Views support the scans, comparisons, logical and shift operators of the word arrays as well as
+ * wrapping addition, subtraction and multiplication. The compound assignments modify the viewed
+ * words, the other operators return a word_array of Width bits. The bits are always interpreted as
+ * an unsigned number, views can hence not be compared to signed integers.
+ *
+ * @tparam Width The number of bits the view covers
+ * @tparam WordType The word type, const qualified for read-only views
+ */
+template <size_t Width, typename WordType = uint64_t> class word_array_view
+{
+public:
+    using word_type = std::remove_const_t<WordType>;
+    using bit_type = word_type;
+    static_assert(Width > 0, " Width must be at least 1 (bit)");
+
+    static_assert(::aarith::is_unsigned_int<word_type>,
+                  "Only unsigned integers can be used as word types");
+
+    /**
+     * @brief Creates a view onto the given words
+     *
+     * @param words Pointer to (at least) word_count() words, least significant word first
+     */
+    constexpr explicit word_array_view(WordType* words) noexcept
+        : words(words)
+    {
+    }
+
+    /**
+     * @brief Creates a read-only view from a view of mutable words
+     */
+    template <typename T, typename = std::enable_if_t<std::is_same_v<const T, WordType> &&
+                                                      !std::is_same_v<T, WordType>>>
+    constexpr word_array_view(const word_array_view<Width, T>& other) noexcept // NOLINT
+        : words(other.data())
+    {
+    }
+
+    /*
+     * Getters
+     */
+
+    [[nodiscard]] static constexpr auto word_width() noexcept -> size_t
+    {
+        return word_array<Width, word_type>::word_width();
+    }
+
+    [[nodiscard]] static constexpr auto word_count() noexcept -> size_t
+    {
+        return word_array<Width, word_type>::word_count();
+    }
+
+    [[nodiscard]] static constexpr word_type word_mask(size_t index) noexcept
+    {
+        return word_array<Width, word_type>::word_mask(index);
+    }
+
+    [[nodiscard]] static constexpr auto width() noexcept -> size_t
+    {
+        return Width;
+    }
+
+    /**
+     * @brief Returns the pointer to the viewed words
+     */
+    [[nodiscard]] constexpr auto data() const noexcept -> WordType*
+    {
+        return words;
+    }
+
+    [[nodiscard]] constexpr auto word(size_t index) const -> word_type
+    {
+        return static_cast<word_type>(words[index] & word_mask(index));
+    }
+
+    /**
+     * @brief Returns the most significant bit.
+     */
+    [[nodiscard]] constexpr auto msb() const -> bit_type
+    {
+        return bit(Width - 1);
+    }
+
+    /**
+     * @brief Returns bit at given index.
+     *
+     * @note No bounds checking is performed! If your index is too large bad things will happen!
+     *
+     * @param index The index for which the bit is to be returned
+     * @return  The bit at the indexed position
+     */
+    [[nodiscard]] constexpr auto bit(size_t index) const -> bit_type
+    {
+        return static_cast<bit_type>((word(index / word_width()) >> (index % word_width())) & 1U);
+    }
+
+    /**
+     * @brief Returns Count consecutive bits starting at the given index
+     *
+     * Bits beyond the width of the view are zero.
+     *
+     * @tparam Count The number of bits to extract
+     * @param index The index of the least significant bit to extract
+     * @return The bits [index + Count - 1, index]
+     */
+    template <size_t Count>
+    [[nodiscard]] constexpr auto bits(size_t index) const -> word_array<Count, word_type>
+    {
+        word_array<Count, word_type> result;
+        if (index >= Width)
+        {
+            return result;
+        }
+
+        // the unused bits of the most significant word must not show up in the result
+        const size_t valid = Width - index;
+        for (size_t i = 0; i < result.word_count() && i * word_width() < valid; ++i)
+        {
+            auto w = implementation::extract_word<word_type>(words, word_count(),
+                                                             index + i * word_width());
+            if (valid - i * word_width() < word_width())
+            {
+                w &= static_cast<word_type>((word_type{1U} << (valid - i * word_width())) - 1U);
+            }
+            result.set_word(i, w);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Copies the viewed bits into a word_array
+     */
+    [[nodiscard]] constexpr auto to_word_array() const -> word_array<Width, word_type>
+    {
+        word_array<Width, word_type> result;
+        for (size_t i = 0; i < word_count(); ++i)
+        {
+            result.set_word(i, word(i));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Tests if all bits are zero
+     * @return True iff all bits are zero
+     */
+    [[nodiscard]] constexpr bool is_zero() const noexcept
+    {
+        for (size_t i = 0; i < word_count(); ++i)
+        {
+            if (word(i) != word_type{0U})
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] explicit constexpr operator bool() const noexcept
+    {
+        return !is_zero();
+    }
+
+    /**
+     * @brief Returns the number of viewed words
+     */
+    [[nodiscard]] constexpr size_t size() const noexcept
+    {
+        return word_count();
+    }
+
+    [[nodiscard]] constexpr auto begin() const noexcept -> WordType*
+    {
+        return words;
+    }
+
+    [[nodiscard]] constexpr auto end() const noexcept -> WordType*
+    {
+        return words + word_count();
+    }
+
+    /*
+     * Setters (only available for views of mutable words)
+     */
+
+    constexpr void set_word(const size_t index, const word_type value) const
+    {
+        static_assert(!std::is_const_v<WordType>, "The words of the view are read-only");
+
+        if constexpr (Width % word_width() == 0)
+        {
+            words[index] = value;
+        }
+        else
+        {
+            const auto mask = word_mask(index);
+            words[index] = static_cast<word_type>((words[index] & ~mask) | (value & mask));
+        }
+    }
+
+    constexpr void set_bit(size_t index, bool value = true) const
+    {
+        const size_t word_index = index / word_width();
+        const auto mask = static_cast<word_type>(word_type{1U} << (index % word_width()));
+        set_word(word_index, static_cast<word_type>(value ? (word(word_index) | mask)
+                                                          : (word(word_index) & ~mask)));
+    }
+
+    /**
+     * @brief Sets the value of the most significant bit (MSB)
+     * @param b The value the MSB is set to
+     */
+    constexpr void set_msb(const bool b) const
+    {
+        set_bit(Width - 1, b);
+    }
+
+    /**
+     * @brief Assigns the specified value to all words
+     * @param value the value to assign to the words
+     */
+    constexpr void fill(const word_type& value) const
+    {
+        for (size_t i = 0; i < word_count(); ++i)
+        {
+            set_word(i, value);
+        }
+    }
+
+    /**
+     * @brief Overwrites the viewed bits with the bits of other, remaining bits are set to zero
+     *
+     * @tparam W Type of the word container to copy (of at most Width bits)
+     * @param other The word_array (or view) whose bits are copied
+     */
+    template <typename W> constexpr void set_bits(const W& other) const
+    {
+        static_assert(::aarith::is_word_array_v<W> || ::aarith::is_word_array_view_v<W>);
+        static_assert(W::width() <= Width, "Can not copy a larger container into the view");
+        static_assert(std::is_same_v<typename W::word_type, word_type>);
+
+        for (size_t i = 0; i < word_count(); ++i)
+        {
+            set_word(i, (i < W::word_count()) ? other.word(i) : word_type{0U});
+        }
+    }
+
+private:
+    WordType* words;
+};
+
+template <size_t Width, typename T> class is_word_array_view<word_array_view<Width, T>>
+{
+public:
+    static constexpr bool value = true;
+};
+
+namespace implementation {
+
+/**
+ * @brief Word containers views can be combined with (word arrays, integers and other views)
+ */
+template <typename W>
+inline constexpr bool is_word_container_v = is_word_array_v<W> || is_word_array_view_v<W>;
+
+/**
+ * @brief Returns the index-th word of the container, missing words are zero
+ */
+template <typename W>
+[[nodiscard]] constexpr auto word_or_zero(const W& w, const size_t index) -> typename W::word_type
+{
+    return (index < W::word_count()) ? w.word(index) : typename W::word_type{0U};
+}
+
+/**
+ * @brief Compares the values of two word containers of, possibly, different widths
+ *
+ * @return A negative value if a < b, zero if a == b and a positive value if a > b
+ */
+template <typename A, typename B>
+[[nodiscard]] constexpr int compare_words_of(const A& a, const B& b)
+{
+    static_assert(::aarith::same_word_type<A, B>);
+    static_assert(!::aarith::is_signed_v<A> && !::aarith::is_signed_v<B>,
+                  "Views are compared as unsigned numbers, signed integers are not supported");
+
+    for (size_t i = std::max(A::word_count(), B::word_count()); i > 0; --i)
+    {
+        const auto word_a = word_or_zero(a, i - 1);
+        const auto word_b = word_or_zero(b, i - 1);
+        if (word_a != word_b)
+        {
+            return (word_a < word_b) ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+} // namespace implementation
+
+/*
+ * Scans
+ */
+
+/**
+ * @brief  Counts the number of bits set to zero before the first one appears (from MSB to LSB)
+ * @param value The view to count the leading zeroes in
+ * @return The number of leading zeroes (Width if value contains zeroes only)
+ */
+template <size_t Width, typename WordType>
+constexpr size_t count_leading_zeroes(const word_array_view<Width, WordType>& value)
+{
+    return implementation::count_leading_zeroes_of(value);
+}
+
+/**
+ * @brief  Counts the number of bits set to one before the first zero appears (from MSB to LSB)
+ * @param value The view to count the leading ones in
+ * @return The number of leading ones (Width if value contains ones only)
+ */
+template <size_t Width, typename WordType>
+constexpr size_t count_leading_ones(const word_array_view<Width, WordType>& value)
+{
+    return implementation::count_leading_ones_of(value);
+}
+
+/**
+ * @brief  Counts the number of bits set to zero before the first one appears (from LSB to MSB)
+ * @param value The view to count the trailing zeroes in
+ * @return The number of trailing zeroes (Width if value contains zeroes only)
+ */
+template <size_t Width, typename WordType>
+constexpr size_t count_trailing_zeroes(const word_array_view<Width, WordType>& value)
+{
+    return implementation::count_trailing_zeroes_of(value);
+}
+
+/**
+ * @brief Counts the number of bits set to one
+ * @param value The view whose ones are counted
+ * @return The number of ones in value
+ */
+template <size_t Width, typename WordType>
+constexpr size_t popcount(const word_array_view<Width, WordType>& value)
+{
+    return implementation::popcount_of(value);
+}
+
+/**
+ * @brief Computes the parity of the viewed bits
+ * @param value The view whose parity is computed
+ * @return True if the number of ones in value is odd
+ */
+template <size_t Width, typename WordType>
+constexpr bool parity(const word_array_view<Width, WordType>& value)
+{
+    return implementation::parity_of(value);
+}
+
+/**
+ * @brief Calls a function for the index of every bit set to one (from LSB to MSB)
+ * @param value The view whose set bits are visited
+ * @param f The function that is called with the index of each set bit
+ */
+template <size_t Width, typename WordType, typename F>
+constexpr void for_each_set_bit(const word_array_view<Width, WordType>& value, F&& f)
+{
+    implementation::for_each_set_bit_of(value, std::forward<F>(f));
+}
+
+/**
+ * @brief Computes the position of the first set bit from MSB to LSB
+ * @param value The view whose first set bit should be found
+ * @return The index of the first set bit in value, an empty optional if there is none
+ */
+template <size_t Width, typename WordType>
+constexpr std::optional<size_t> first_set_bit(const word_array_view<Width, WordType>& value)
+{
+    return implementation::first_set_bit_of(value);
+}
+
+/**
+ * @brief Computes the position of the first unset bit from MSB to LSB
+ * @param value The view whose first unset bit should be found
+ * @return The index of the first unset bit in value, an empty optional if there is none
+ */
+template <size_t Width, typename WordType>
+constexpr std::optional<size_t> first_unset_bit(const word_array_view<Width, WordType>& value)
+{
+    return implementation::first_unset_bit_of(value);
+}
+
+/*
+ * Comparisons
+ *
+ * Views are compared to other views, word arrays and unsigned integers by the unsigned values of
+ * their bits, containers of different widths are zero extended. Comparing a view to a signed
+ * integer does not compile as the order of the bits differs from the order of the signed values.
+ */
+
+template <size_t W, size_t V, typename T>
+constexpr bool operator==(const word_array_view<W, T>& a, const word_array_view<V, T>& b)
+{
+    return implementation::compare_words_of(a, b) == 0;
+}
+
+template <size_t W, typename T, typename O,
+          typename = std::enable_if_t<implementation::is_word_container_v<O>>>
+constexpr bool operator==(const word_array_view<W, T>& a, const O& b)
+{
+    return implementation::compare_words_of(a, b) == 0;
+}
+
+template <typename O, size_t W, typename T,
+          typename = std::enable_if_t<is_word_array_v<O>>>
+constexpr bool operator==(const O& a, const word_array_view<W, T>& b)
+{
+    return implementation::compare_words_of(a, b) == 0;
+}
+
+template <size_t W, typename T, typename O,
+          typename = std::enable_if_t<implementation::is_word_container_v<O>>>
+constexpr bool operator!=(const word_array_view<W, T>& a, const O& b)
+{
+    return implementation::compare_words_of(a, b) != 0;
+}
+
+template <typename O, size_t W, typename T,
+          typename = std::enable_if_t<is_word_array_v<O>>>
+constexpr bool operator!=(const O& a, const word_array_view<W, T>& b)
+{
+    return implementation::compare_words_of(a, b) != 0;
+}
+
+template <size_t W, typename T, typename O,
+          typename = std::enable_if_t<implementation::is_word_container_v<O>>>
+constexpr bool operator<(const word_array_view<W, T>& a, const O& b)
+{
+    return implementation::compare_words_of(a, b) < 0;
+}
+
+template <typename O, size_t W, typename T,
+          typename = std::enable_if_t<is_word_array_v<O>>>
+constexpr bool operator<(const O& a, const word_array_view<W, T>& b)
+{
+    return implementation::compare_words_of(a, b) < 0;
+}
+
+template <size_t W, typename T, typename O,
+          typename = std::enable_if_t<implementation::is_word_container_v<O>>>
+constexpr bool operator<=(const word_array_view<W, T>& a, const O& b)
+{
+    return implementation::compare_words_of(a, b) <= 0;
+}
+
+template <typename O, size_t W, typename T,
+          typename = std::enable_if_t<is_word_array_v<O>>>
+constexpr bool operator<=(const O& a, const word_array_view<W, T>& b)
+{
+    return implementation::compare_words_of(a, b) <= 0;
+}
+
+template <size_t W, typename T, typename O,
+          typename = std::enable_if_t<implementation::is_word_container_v<O>>>
+constexpr bool operator>(const word_array_view<W, T>& a, const O& b)
+{
+    return implementation::compare_words_of(a, b) > 0;
+}
+
+template <typename O, size_t W, typename T,
+          typename = std::enable_if_t<is_word_array_v<O>>>
+constexpr bool operator>(const O& a, const word_array_view<W, T>& b)
+{
+    return implementation::compare_words_of(a, b) > 0;
+}
+
+template <size_t W, typename T, typename O,
+          typename = std::enable_if_t<implementation::is_word_container_v<O>>>
+constexpr bool operator>=(const word_array_view<W, T>& a, const O& b)
+{
+    return implementation::compare_words_of(a, b) >= 0;
+}
+
+template <typename O, size_t W, typename T,
+          typename = std::enable_if_t<is_word_array_v<O>>>
+constexpr bool operator>=(const O& a, const word_array_view<W, T>& b)
+{
+    return implementation::compare_words_of(a, b) >= 0;
+}
+
+/*
+ * In-place operations
+ *
+ * The right-hand side can be a view, a word array or an integer of any width, it is zero extended
+ * or truncated to the width of the view. Just like for the integers, the arithmetic operations wrap
+ * around.
+ */
+
+template <size_t W, typename T, typename O,
+          typename = std::enable_if_t<implementation::is_word_container_v<O>>>
+constexpr auto operator&=(const word_array_view<W, T>& lhs, const O& rhs)
+    -> const word_array_view<W, T>&
+{
+    for (size_t i = 0; i < lhs.word_count(); ++i)
+    {
+        lhs.set_word(i, lhs.word(i) & implementation::word_or_zero(rhs, i));
+    }
+    return lhs;
+}
+
+template <size_t W, typename T, typename O,
+          typename = std::enable_if_t<implementation::is_word_container_v<O>>>
+constexpr auto operator|=(const word_array_view<W, T>& lhs, const O& rhs)
+    -> const word_array_view<W, T>&
+{
+    for (size_t i = 0; i < lhs.word_count(); ++i)
+    {
+        lhs.set_word(i, lhs.word(i) | implementation::word_or_zero(rhs, i));
+    }
+    return lhs;
+}
+
+template <size_t W, typename T, typename O,
+          typename = std::enable_if_t<implementation::is_word_container_v<O>>>
+constexpr auto operator^=(const word_array_view<W, T>& lhs, const O& rhs)
+    -> const word_array_view<W, T>&
+{
+    for (size_t i = 0; i < lhs.word_count(); ++i)
+    {
+        lhs.set_word(i, lhs.word(i) ^ implementation::word_or_zero(rhs, i));
+    }
+    return lhs;
+}
+
+/**
+ * @brief Adds rhs to the viewed bits (modulo 2^W)
+ */
+template <size_t W, typename T, typename O,
+          typename = std::enable_if_t<implementation::is_word_container_v<O>>>
+constexpr auto operator+=(const word_array_view<W, T>& lhs, const O& rhs)
+    -> const word_array_view<W, T>&
+{
+    static_assert(::aarith::same_word_type<word_array_view<W, T>, O>);
+
+    typename O::word_type carry{0U};
+    for (size_t i = 0; i < lhs.word_count(); ++i)
+    {
+        const auto summand = implementation::word_or_zero(rhs, i);
+        lhs.set_word(i, implementation::add_carry(lhs.word(i), summand, carry, carry));
+    }
+    return lhs;
+}
+
+/**
+ * @brief Subtracts rhs from the viewed bits (modulo 2^W)
+ */
+template <size_t W, typename T, typename O,
+          typename = std::enable_if_t<implementation::is_word_container_v<O>>>
+constexpr auto operator-=(const word_array_view<W, T>& lhs, const O& rhs)
+    -> const word_array_view<W, T>&
+{
+    static_assert(::aarith::same_word_type<word_array_view<W, T>, O>);
+
+    typename O::word_type borrow{0U};
+    for (size_t i = 0; i < lhs.word_count(); ++i)
+    {
+        const auto subtrahend = implementation::word_or_zero(rhs, i);
+        lhs.set_word(i, implementation::sub_borrow(lhs.word(i), subtrahend, borrow, borrow));
+    }
+    return lhs;
+}
+
+/**
+ * @brief Multiplies the viewed bits by rhs (modulo 2^W)
+ *
+ * Only the words of the truncated product are computed, the factors are copied as the product must
+ * not overlap with them.
+ */
+template <size_t W, typename T, typename O,
+          typename = std::enable_if_t<implementation::is_word_container_v<O>>>
+constexpr auto operator*=(const word_array_view<W, T>& lhs, const O& rhs)
+    -> const word_array_view<W, T>&
+{
+    using V = word_array_view<W, T>;
+    using word_type = typename V::word_type;
+    static_assert(::aarith::same_word_type<V, O>);
+
+    implementation::word_storage_t<word_type, V::word_count()> a{};
+    implementation::word_storage_t<word_type, V::word_count()> b{};
+    implementation::word_storage_t<word_type, V::word_count()> product{};
+    for (size_t i = 0; i < V::word_count(); ++i)
+    {
+        a[i] = lhs.word(i);
+        b[i] = implementation::word_or_zero(rhs, i);
+    }
+    implementation::mul_words_truncated(product.data(), V::word_count(), a.data(), b.data());
+    for (size_t i = 0; i < V::word_count(); ++i)
+    {
+        lhs.set_word(i, product[i]);
+    }
+    return lhs;
+}
+
+/**
+ * @brief Logical left shift of the viewed bits
+ */
+template <size_t W, typename T>
+constexpr auto operator<<=(const word_array_view<W, T>& lhs, const size_t rhs)
+    -> const word_array_view<W, T>&
+{
+    using V = word_array_view<W, T>;
+    using word_type = typename V::word_type;
+
+    if (rhs >= W)
+    {
+        lhs.fill(word_type{0U});
+        return lhs;
+    }
+
+    const size_t skip_words = rhs / V::word_width();
+    const size_t shift = rhs % V::word_width();
+    for (size_t i = V::word_count(); i > skip_words; --i)
+    {
+        const size_t source = i - 1 - skip_words;
+        auto new_word = static_cast<word_type>(lhs.word(source) << shift);
+        if (shift != 0 && source > 0)
+        {
+            new_word |= static_cast<word_type>(lhs.word(source - 1) >> (V::word_width() - shift));
+        }
+        lhs.set_word(i - 1, new_word);
+    }
+    for (size_t i = 0; i < skip_words; ++i)
+    {
+        lhs.set_word(i, word_type{0U});
+    }
+    return lhs;
+}
+
+/**
+ * @brief Logical right shift of the viewed bits
+ */
+template <size_t W, typename T>
+constexpr auto operator>>=(const word_array_view<W, T>& lhs, const size_t rhs)
+    -> const word_array_view<W, T>&
+{
+    using V = word_array_view<W, T>;
+    using word_type = typename V::word_type;
+
+    if (rhs >= W)
+    {
+        lhs.fill(word_type{0U});
+        return lhs;
+    }
+
+    const size_t skip_words = rhs / V::word_width();
+    const size_t shift = rhs % V::word_width();
+    for (size_t i = 0; i + skip_words < V::word_count(); ++i)
+    {
+        const size_t source = i + skip_words;
+        auto new_word = static_cast<word_type>(lhs.word(source) >> shift);
+        if (shift != 0 && source + 1 < V::word_count())
+        {
+            new_word |= static_cast<word_type>(lhs.word(source + 1) << (V::word_width() - shift));
+        }
+        lhs.set_word(i, new_word);
+    }
+    for (size_t i = V::word_count() - skip_words; i < V::word_count(); ++i)
+    {
+        lhs.set_word(i, word_type{0U});
+    }
+    return lhs;
+}
+
+/*
+ * Operations returning a new word array
+ *
+ * The result is a word_array of the width of the view, the viewed words are left untouched. The
+ * right-hand side is handled as for the in-place operations.
+ */
+
+namespace implementation {
+
+/**
+ * @brief Applies an in-place operation to a copy of the viewed bits
+ *
+ * @param view The view whose bits are copied
+ * @param f The function modifying the view of the copy
+ * @return The modified copy
+ */
+template <size_t W, typename T, typename F>
+[[nodiscard]] constexpr auto modified_copy(const word_array_view<W, T>& view, F&& f)
+    -> word_array<W, std::remove_const_t<T>>
+{
+    using word_type = std::remove_const_t<T>;
+    word_storage_t<word_type, word_array_view<W, T>::word_count()> words{};
+    const word_array_view<W, word_type> copy{words.data()};
+    copy.set_bits(view);
+    std::forward<F>(f)(copy);
+    return copy.to_word_array();
+}
+
+} // namespace implementation
+
+template <size_t W, typename T, typename O,
+          typename = std::enable_if_t<implementation::is_word_container_v<O>>>
+[[nodiscard]] constexpr auto operator&(const word_array_view<W, T>& lhs, const O& rhs)
+    -> word_array<W, std::remove_const_t<T>>
+{
+    return implementation::modified_copy(lhs, [&rhs](const auto& copy) { copy &= rhs; });
+}
+
+template <size_t W, typename T, typename O,
+          typename = std::enable_if_t<implementation::is_word_container_v<O>>>
+[[nodiscard]] constexpr auto operator|(const word_array_view<W, T>& lhs, const O& rhs)
+    -> word_array<W, std::remove_const_t<T>>
+{
+    return implementation::modified_copy(lhs, [&rhs](const auto& copy) { copy |= rhs; });
+}
+
+template <size_t W, typename T, typename O,
+          typename = std::enable_if_t<implementation::is_word_container_v<O>>>
+[[nodiscard]] constexpr auto operator^(const word_array_view<W, T>& lhs, const O& rhs)
+    -> word_array<W, std::remove_const_t<T>>
+{
+    return implementation::modified_copy(lhs, [&rhs](const auto& copy) { copy ^= rhs; });
+}
+
+template <size_t W, typename T>
+[[nodiscard]] constexpr auto operator~(const word_array_view<W, T>& value)
+    -> word_array<W, std::remove_const_t<T>>
+{
+    using word_type = std::remove_const_t<T>;
+    return implementation::modified_copy(value, [](const auto& copy) {
+        for (size_t i = 0; i < copy.word_count(); ++i)
+        {
+            copy.set_word(i, static_cast<word_type>(~copy.word(i)));
+        }
+    });
+}
+
+/**
+ * @brief Adds two numbers (modulo 2^W)
+ */
+template <size_t W, typename T, typename O,
+          typename = std::enable_if_t<implementation::is_word_container_v<O>>>
+[[nodiscard]] constexpr auto operator+(const word_array_view<W, T>& lhs, const O& rhs)
+    -> word_array<W, std::remove_const_t<T>>
+{
+    return implementation::modified_copy(lhs, [&rhs](const auto& copy) { copy += rhs; });
+}
+
+/**
+ * @brief Subtracts two numbers (modulo 2^W)
+ */
+template <size_t W, typename T, typename O,
+          typename = std::enable_if_t<implementation::is_word_container_v<O>>>
+[[nodiscard]] constexpr auto operator-(const word_array_view<W, T>& lhs, const O& rhs)
+    -> word_array<W, std::remove_const_t<T>>
+{
+    return implementation::modified_copy(lhs, [&rhs](const auto& copy) { copy -= rhs; });
+}
+
+/**
+ * @brief Multiplies two numbers (modulo 2^W)
+ */
+template <size_t W, typename T, typename O,
+          typename = std::enable_if_t<implementation::is_word_container_v<O>>>
+[[nodiscard]] constexpr auto operator*(const word_array_view<W, T>& lhs, const O& rhs)
+    -> word_array<W, std::remove_const_t<T>>
+{
+    return implementation::modified_copy(lhs, [&rhs](const auto& copy) { copy *= rhs; });
+}
+
+/**
+ * @brief Logical left shift of the viewed bits
+ */
+template <size_t W, typename T>
+[[nodiscard]] constexpr auto operator<<(const word_array_view<W, T>& lhs, const size_t rhs)
+    -> word_array<W, std::remove_const_t<T>>
+{
+    return implementation::modified_copy(lhs, [rhs](const auto& copy) { copy <<= rhs; });
+}
+
+/**
+ * @brief Logical right shift of the viewed bits
+ */
+template <size_t W, typename T>
+[[nodiscard]] constexpr auto operator>>(const word_array_view<W, T>& lhs, const size_t rhs)
+    -> word_array<W, std::remove_const_t<T>>
+{
+    return implementation::modified_copy(lhs, [rhs](const auto& copy) { copy >>= rhs; });
+}
+
+} // namespace aarith
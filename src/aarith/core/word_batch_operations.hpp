@@ -0,0 +1,974 @@
+#pragma once
+
+#include <aarith/core/word_operations.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#include <immintrin.h>
+#define AARITH_HAS_X86_SIMD_KERNELS
+#define AARITH_TARGET_AVX2 __attribute__((target("avx2")))
+#define AARITH_TARGET_AVX512 __attribute__((target("avx512f")))
+// forces generic kernels to be inlined into the functions compiled for a SIMD instruction set
+#define AARITH_BATCH_INLINE __attribute__((always_inline)) inline
+#else
+#define AARITH_BATCH_INLINE inline
+#endif
+
+namespace aarith {
+
+/**
+ * @brief The instruction set extensions that can be used for operations on batches of numbers
+ */
+enum class simd_level
+{
+    scalar,
+    avx2,
+    avx512
+};
+
+namespace implementation {
+
+/**
+ * @brief Determines the best instruction set extension supported by the processor
+ */
+[[nodiscard]] inline simd_level detect_simd_level()
+{
+#if defined(AARITH_HAS_X86_SIMD_KERNELS)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return simd_level::avx512;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return simd_level::avx2;
+    }
+#endif
+    return simd_level::scalar;
+}
+
+/**
+ * @brief The setting of the instruction set extension used for batches of numbers
+ *
+ * The setting may be changed while other threads compute with batches. It does not guard any other
+ * data, hence relaxed loads and stores suffice.
+ */
+[[nodiscard]] inline std::atomic<simd_level>& simd_level_setting()
+{
+    static std::atomic<simd_level> level{detect_simd_level()};
+    return level;
+}
+
+/**
+ * @brief The instruction set extension that is currently used for batches of numbers
+ */
+[[nodiscard]] inline simd_level active_simd_level()
+{
+    return simd_level_setting().load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief The bitwise operations on batches of words
+ */
+enum class batch_logic_op
+{
+    bitwise_and,
+    bitwise_or,
+    bitwise_xor,
+    bitwise_not
+};
+
+/*
+ * The batch kernels work on numbers stored limb-major: the word i of the number in lane l is
+ * stored at index i * lanes + l. The scalar kernels process the lanes [begin, end), the SIMD
+ * kernels process as many lanes as fit into complete vectors and return the number of lanes they
+ * processed. The result may alias the operands.
+ */
+
+template <size_t Words, typename WordType>
+void batch_add_scalar(WordType* r, const WordType* a, const WordType* b, const size_t lanes,
+                      const size_t begin, const WordType top_mask)
+{
+    for (size_t l = begin; l < lanes; ++l)
+    {
+        WordType carry{0U};
+        for (size_t i = 0; i < Words; ++i)
+        {
+            r[i * lanes + l] = add_carry(a[i * lanes + l], b[i * lanes + l], carry, carry);
+        }
+        r[(Words - 1) * lanes + l] &= top_mask;
+    }
+}
+
+template <size_t Words, typename WordType>
+void batch_sub_scalar(WordType* r, const WordType* a, const WordType* b, const size_t lanes,
+                      const size_t begin, const WordType top_mask)
+{
+    for (size_t l = begin; l < lanes; ++l)
+    {
+        WordType borrow{0U};
+        for (size_t i = 0; i < Words; ++i)
+        {
+            r[i * lanes + l] = sub_borrow(a[i * lanes + l], b[i * lanes + l], borrow, borrow);
+        }
+        r[(Words - 1) * lanes + l] &= top_mask;
+    }
+}
+
+template <size_t Words, typename WordType>
+void batch_mul_scalar(WordType* r, const WordType* a, const WordType* b, const size_t lanes,
+                      const size_t begin, const WordType top_mask)
+{
+    for (size_t l = begin; l < lanes; ++l)
+    {
+        std::array<WordType, Words> x{};
+        std::array<WordType, Words> y{};
+        std::array<WordType, Words> product{};
+        for (size_t i = 0; i < Words; ++i)
+        {
+            x[i] = a[i * lanes + l];
+            y[i] = b[i * lanes + l];
+        }
+        mul_words_truncated(product.data(), Words, x.data(), y.data());
+        for (size_t i = 0; i < Words; ++i)
+        {
+            r[i * lanes + l] = product[i];
+        }
+        r[(Words - 1) * lanes + l] &= top_mask;
+    }
+}
+
+template <size_t Words, typename WordType>
+void batch_logic_scalar(WordType* r, const WordType* a, const WordType* b, const size_t lanes,
+                        const size_t begin, const batch_logic_op op, const WordType top_mask)
+{
+    for (size_t i = 0; i < Words; ++i)
+    {
+        const WordType mask = (i == Words - 1) ? top_mask : static_cast<WordType>(~WordType{0U});
+        for (size_t l = begin; l < lanes; ++l)
+        {
+            const WordType x = a[i * lanes + l];
+            WordType result{0U};
+            switch (op)
+            {
+            case batch_logic_op::bitwise_and: result = x & b[i * lanes + l]; break;
+            case batch_logic_op::bitwise_or: result = x | b[i * lanes + l]; break;
+            case batch_logic_op::bitwise_xor: result = x ^ b[i * lanes + l]; break;
+            case batch_logic_op::bitwise_not: result = static_cast<WordType>(~x); break;
+            }
+            r[i * lanes + l] = static_cast<WordType>(result & mask);
+        }
+    }
+}
+
+template <size_t Words, typename WordType>
+void batch_compare_scalar(bool* less, bool* equal, const WordType* a, const WordType* b,
+                          const size_t lanes, const size_t begin, const WordType top_flip)
+{
+    for (size_t l = begin; l < lanes; ++l)
+    {
+        WordType borrow{0U};
+        WordType difference{0U};
+        for (size_t i = 0; i < Words; ++i)
+        {
+            const WordType flip = (i == Words - 1) ? top_flip : WordType{0U};
+            const auto x = static_cast<WordType>(a[i * lanes + l] ^ flip);
+            const auto y = static_cast<WordType>(b[i * lanes + l] ^ flip);
+            difference |= static_cast<WordType>(x ^ y);
+            [[maybe_unused]] const WordType d = sub_borrow(x, y, borrow, borrow);
+        }
+        less[l] = borrow != WordType{0U};
+        equal[l] = difference == WordType{0U};
+    }
+}
+
+template <size_t Words, typename WordType>
+void batch_shift_left_scalar(WordType* r, const WordType* a, const size_t lanes, const size_t begin,
+                             const size_t shift, const WordType top_mask)
+{
+    constexpr size_t word_width = bits_per_word<WordType>();
+    const size_t skip = shift / word_width;
+    const size_t offset = shift % word_width;
+
+    for (size_t l = begin; l < lanes; ++l)
+    {
+        // the words are processed from the most significant one to allow in place shifts
+        for (size_t i = Words; i > 0; --i)
+        {
+            const size_t j = i - 1;
+            WordType w{0U};
+            if (j >= skip)
+            {
+                w = static_cast<WordType>(a[(j - skip) * lanes + l] << offset);
+                if (offset != 0 && j > skip)
+                {
+                    w |= static_cast<WordType>(a[(j - skip - 1) * lanes + l] >>
+                                               (word_width - offset));
+                }
+            }
+            r[j * lanes + l] = w;
+        }
+        r[(Words - 1) * lanes + l] &= top_mask;
+    }
+}
+
+template <size_t Words, typename WordType>
+void batch_shift_right_scalar(WordType* r, const WordType* a, const size_t lanes,
+                              const size_t begin, const size_t shift, const WordType* fill,
+                              const size_t sign_bit)
+{
+    constexpr size_t word_width = bits_per_word<WordType>();
+    const size_t skip = shift / word_width;
+    const size_t offset = shift % word_width;
+
+    for (size_t l = begin; l < lanes; ++l)
+    {
+        const auto sign = static_cast<WordType>(
+            WordType{0U} - ((a[(Words - 1) * lanes + l] >> sign_bit) & WordType{1U}));
+        // the words are processed from the least significant one to allow in place shifts
+        for (size_t i = 0; i < Words; ++i)
+        {
+            WordType w{0U};
+            if (i + skip < Words)
+            {
+                w = static_cast<WordType>(a[(i + skip) * lanes + l] >> offset);
+                if (offset != 0 && i + skip + 1 < Words)
+                {
+                    w |= static_cast<WordType>(a[(i + skip + 1) * lanes + l]
+                                               << (word_width - offset));
+                }
+            }
+            if (fill != nullptr)
+            {
+                w |= static_cast<WordType>(fill[i] & sign);
+            }
+            r[i * lanes + l] = w;
+        }
+    }
+}
+
+#if defined(AARITH_HAS_X86_SIMD_KERNELS)
+
+AARITH_TARGET_AVX2 inline __m256i load_avx2(const uint64_t* p)
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+AARITH_TARGET_AVX2 inline void store_avx2(uint64_t* p, const __m256i v)
+{
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+}
+
+// AVX2 only offers signed comparisons, flipping the sign bits turns them into unsigned ones
+AARITH_TARGET_AVX2 inline __m256i less_epu64_avx2(const __m256i x, const __m256i y)
+{
+    const __m256i sign = _mm256_set1_epi64x(static_cast<int64_t>(uint64_t{1U} << 63U));
+    return _mm256_cmpgt_epi64(_mm256_xor_si256(y, sign), _mm256_xor_si256(x, sign));
+}
+
+template <size_t Words>
+AARITH_TARGET_AVX2 size_t batch_add_avx2(uint64_t* r, const uint64_t* a, const uint64_t* b,
+                                         const size_t lanes, const uint64_t top_mask)
+{
+    const size_t end = lanes - lanes % 4;
+    const __m256i mask = _mm256_set1_epi64x(static_cast<int64_t>(top_mask));
+    for (size_t l = 0; l < end; l += 4)
+    {
+        // the carry is stored as mask, i.e., a carry of one is represented by -1
+        __m256i carry = _mm256_setzero_si256();
+        for (size_t i = 0; i < Words; ++i)
+        {
+            const __m256i x = load_avx2(a + i * lanes + l);
+            const __m256i s = _mm256_add_epi64(x, load_avx2(b + i * lanes + l));
+            const __m256i sc = _mm256_sub_epi64(s, carry);
+            carry = _mm256_or_si256(less_epu64_avx2(s, x), less_epu64_avx2(sc, s));
+            store_avx2(r + i * lanes + l, (i == Words - 1) ? _mm256_and_si256(sc, mask) : sc);
+        }
+    }
+    return end;
+}
+
+template <size_t Words>
+AARITH_TARGET_AVX2 size_t batch_sub_avx2(uint64_t* r, const uint64_t* a, const uint64_t* b,
+                                         const size_t lanes, const uint64_t top_mask)
+{
+    const size_t end = lanes - lanes % 4;
+    const __m256i mask = _mm256_set1_epi64x(static_cast<int64_t>(top_mask));
+    const __m256i zero = _mm256_setzero_si256();
+    for (size_t l = 0; l < end; l += 4)
+    {
+        // the borrow is stored as mask, i.e., a borrow of one is represented by -1
+        __m256i borrow = zero;
+        for (size_t i = 0; i < Words; ++i)
+        {
+            const __m256i x = load_avx2(a + i * lanes + l);
+            const __m256i y = load_avx2(b + i * lanes + l);
+            const __m256i d = _mm256_sub_epi64(x, y);
+            const __m256i db = _mm256_add_epi64(d, borrow);
+            borrow = _mm256_or_si256(less_epu64_avx2(x, y),
+                                     _mm256_and_si256(borrow, _mm256_cmpeq_epi64(d, zero)));
+            store_avx2(r + i * lanes + l, (i == Words - 1) ? _mm256_and_si256(db, mask) : db);
+        }
+    }
+    return end;
+}
+
+template <size_t Words>
+AARITH_TARGET_AVX2 size_t batch_mul_avx2(uint64_t* r, const uint64_t* a, const uint64_t* b,
+                                         const size_t lanes, const uint64_t top_mask)
+{
+    // AVX2 only multiplies 32 bit numbers, hence the numbers are split into 32 bit digits
+    constexpr size_t digits = 2 * Words;
+    const size_t end = lanes - lanes % 4;
+    const __m256i mask = _mm256_set1_epi64x(static_cast<int64_t>(top_mask));
+    const __m256i low = _mm256_set1_epi64x(0xFFFFFFFF);
+    for (size_t l = 0; l < end; l += 4)
+    {
+        __m256i x[digits]{}; // NOLINT
+        __m256i y[digits]{}; // NOLINT
+        __m256i t[digits]{}; // NOLINT
+        for (size_t i = 0; i < Words; ++i)
+        {
+            const __m256i va = load_avx2(a + i * lanes + l);
+            const __m256i vb = load_avx2(b + i * lanes + l);
+            x[2 * i] = _mm256_and_si256(va, low);
+            x[2 * i + 1] = _mm256_srli_epi64(va, 32);
+            y[2 * i] = _mm256_and_si256(vb, low);
+            y[2 * i + 1] = _mm256_srli_epi64(vb, 32);
+        }
+        for (size_t i = 0; i < digits; ++i)
+        {
+            __m256i carry = _mm256_setzero_si256();
+            for (size_t j = 0; i + j < digits; ++j)
+            {
+                // (2^32 - 1)^2 + 2 * (2^32 - 1) = 2^64 - 1, hence this never overflows
+                __m256i p = _mm256_mul_epu32(x[i], y[j]);
+                p = _mm256_add_epi64(p, t[i + j]);
+                p = _mm256_add_epi64(p, carry);
+                t[i + j] = _mm256_and_si256(p, low);
+                carry = _mm256_srli_epi64(p, 32);
+            }
+        }
+        for (size_t i = 0; i < Words; ++i)
+        {
+            const __m256i w = _mm256_or_si256(t[2 * i], _mm256_slli_epi64(t[2 * i + 1], 32));
+            store_avx2(r + i * lanes + l, (i == Words - 1) ? _mm256_and_si256(w, mask) : w);
+        }
+    }
+    return end;
+}
+
+template <size_t Words>
+AARITH_TARGET_AVX2 size_t batch_logic_avx2(uint64_t* r, const uint64_t* a, const uint64_t* b,
+                                           const size_t lanes, const batch_logic_op op,
+                                           const uint64_t top_mask)
+{
+    const size_t end = lanes - lanes % 4;
+    const __m256i ones = _mm256_set1_epi64x(-1);
+    for (size_t i = 0; i < Words; ++i)
+    {
+        const __m256i mask =
+            (i == Words - 1) ? _mm256_set1_epi64x(static_cast<int64_t>(top_mask)) : ones;
+        for (size_t l = 0; l < end; l += 4)
+        {
+            const __m256i x = load_avx2(a + i * lanes + l);
+            __m256i result = _mm256_xor_si256(x, ones);
+            switch (op)
+            {
+            case batch_logic_op::bitwise_and:
+                result = _mm256_and_si256(x, load_avx2(b + i * lanes + l));
+                break;
+            case batch_logic_op::bitwise_or:
+                result = _mm256_or_si256(x, load_avx2(b + i * lanes + l));
+                break;
+            case batch_logic_op::bitwise_xor:
+                result = _mm256_xor_si256(x, load_avx2(b + i * lanes + l));
+                break;
+            case batch_logic_op::bitwise_not: break;
+            }
+            store_avx2(r + i * lanes + l, _mm256_and_si256(result, mask));
+        }
+    }
+    return end;
+}
+
+template <size_t Words>
+AARITH_TARGET_AVX2 size_t batch_compare_avx2(bool* less, bool* equal, const uint64_t* a,
+                                             const uint64_t* b, const size_t lanes,
+                                             const uint64_t top_flip)
+{
+    const size_t end = lanes - lanes % 4;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i flip = _mm256_set1_epi64x(static_cast<int64_t>(top_flip));
+    for (size_t l = 0; l < end; l += 4)
+    {
+        __m256i borrow = zero;
+        __m256i difference = zero;
+        for (size_t i = 0; i < Words; ++i)
+        {
+            __m256i x = load_avx2(a + i * lanes + l);
+            __m256i y = load_avx2(b + i * lanes + l);
+            if (i == Words - 1)
+            {
+                x = _mm256_xor_si256(x, flip);
+                y = _mm256_xor_si256(y, flip);
+            }
+            const __m256i d = _mm256_sub_epi64(x, y);
+            borrow = _mm256_or_si256(less_epu64_avx2(x, y),
+                                     _mm256_and_si256(borrow, _mm256_cmpeq_epi64(d, zero)));
+            difference = _mm256_or_si256(difference, d);
+        }
+        const int less_bits = _mm256_movemask_pd(_mm256_castsi256_pd(borrow));
+        const int equal_bits =
+            _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(difference, zero)));
+        for (size_t k = 0; k < 4; ++k)
+        {
+            less[l + k] = ((less_bits >> k) & 1) != 0;
+            equal[l + k] = ((equal_bits >> k) & 1) != 0;
+        }
+    }
+    return end;
+}
+
+template <size_t Words>
+AARITH_TARGET_AVX2 size_t batch_shift_left_avx2(uint64_t* r, const uint64_t* a,
+                                                const size_t lanes, const size_t shift,
+                                                const uint64_t top_mask)
+{
+    const size_t end = lanes - lanes % 4;
+    const size_t skip = shift / 64;
+    // shifts by 64 bits yield zero, i.e., no special handling of offset 0 is needed
+    const __m128i offset = _mm_cvtsi64_si128(static_cast<int64_t>(shift % 64));
+    const __m128i back = _mm_cvtsi64_si128(static_cast<int64_t>(64 - shift % 64));
+    const __m256i mask = _mm256_set1_epi64x(static_cast<int64_t>(top_mask));
+    for (size_t l = 0; l < end; l += 4)
+    {
+        for (size_t i = Words; i > 0; --i)
+        {
+            const size_t j = i - 1;
+            __m256i w = _mm256_setzero_si256();
+            if (j >= skip)
+            {
+                w = _mm256_sll_epi64(load_avx2(a + (j - skip) * lanes + l), offset);
+                if (j > skip)
+                {
+                    w = _mm256_or_si256(
+                        w, _mm256_srl_epi64(load_avx2(a + (j - skip - 1) * lanes + l), back));
+                }
+            }
+            store_avx2(r + j * lanes + l, (j == Words - 1) ? _mm256_and_si256(w, mask) : w);
+        }
+    }
+    return end;
+}
+
+template <size_t Words>
+AARITH_TARGET_AVX2 size_t batch_shift_right_avx2(uint64_t* r, const uint64_t* a,
+                                                 const size_t lanes, const size_t shift,
+                                                 const uint64_t* fill, const size_t sign_bit)
+{
+    const size_t end = lanes - lanes % 4;
+    const size_t skip = shift / 64;
+    const __m128i offset = _mm_cvtsi64_si128(static_cast<int64_t>(shift % 64));
+    const __m128i back = _mm_cvtsi64_si128(static_cast<int64_t>(64 - shift % 64));
+    const __m128i sign_offset = _mm_cvtsi64_si128(static_cast<int64_t>(sign_bit));
+    const __m256i one = _mm256_set1_epi64x(1);
+    for (size_t l = 0; l < end; l += 4)
+    {
+        const __m256i sign = _mm256_sub_epi64(
+            _mm256_setzero_si256(),
+            _mm256_and_si256(_mm256_srl_epi64(load_avx2(a + (Words - 1) * lanes + l), sign_offset),
+                             one));
+        for (size_t i = 0; i < Words; ++i)
+        {
+            __m256i w = _mm256_setzero_si256();
+            if (i + skip < Words)
+            {
+                w = _mm256_srl_epi64(load_avx2(a + (i + skip) * lanes + l), offset);
+                if (i + skip + 1 < Words)
+                {
+                    w = _mm256_or_si256(
+                        w, _mm256_sll_epi64(load_avx2(a + (i + skip + 1) * lanes + l), back));
+                }
+            }
+            if (fill != nullptr)
+            {
+                w = _mm256_or_si256(
+                    w, _mm256_and_si256(_mm256_set1_epi64x(static_cast<int64_t>(fill[i])), sign));
+            }
+            store_avx2(r + i * lanes + l, w);
+        }
+    }
+    return end;
+}
+
+AARITH_TARGET_AVX512 inline __m512i load_avx512(const uint64_t* p)
+{
+    return _mm512_loadu_si512(p);
+}
+
+AARITH_TARGET_AVX512 inline void store_avx512(uint64_t* p, const __m512i v)
+{
+    _mm512_storeu_si512(p, v);
+}
+
+/*
+ * The unmasked AVX-512 shifts and multiplications of GCC merge into _mm512_undefined_epi32(), which
+ * GCC itself reports as uninitialized. Their zero-masking variants selecting all lanes compute the
+ * same without reading an uninitialized register.
+ */
+
+AARITH_TARGET_AVX512 inline __m512i mul_epu32_avx512(const __m512i x, const __m512i y)
+{
+    return _mm512_maskz_mul_epu32(0xFF, x, y);
+}
+
+template <unsigned int Shift> AARITH_TARGET_AVX512 inline __m512i slli_avx512(const __m512i v)
+{
+    return _mm512_maskz_slli_epi64(0xFF, v, Shift);
+}
+
+template <unsigned int Shift> AARITH_TARGET_AVX512 inline __m512i srli_avx512(const __m512i v)
+{
+    return _mm512_maskz_srli_epi64(0xFF, v, Shift);
+}
+
+AARITH_TARGET_AVX512 inline __m512i sll_avx512(const __m512i v, const __m128i count)
+{
+    return _mm512_maskz_sll_epi64(0xFF, v, count);
+}
+
+AARITH_TARGET_AVX512 inline __m512i srl_avx512(const __m512i v, const __m128i count)
+{
+    return _mm512_maskz_srl_epi64(0xFF, v, count);
+}
+
+template <size_t Words>
+AARITH_TARGET_AVX512 size_t batch_add_avx512(uint64_t* r, const uint64_t* a, const uint64_t* b,
+                                             const size_t lanes, const uint64_t top_mask)
+{
+    const size_t end = lanes - lanes % 8;
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(top_mask));
+    const __m512i one = _mm512_set1_epi64(1);
+    for (size_t l = 0; l < end; l += 8)
+    {
+        __mmask8 carry = 0;
+        for (size_t i = 0; i < Words; ++i)
+        {
+            const __m512i x = load_avx512(a + i * lanes + l);
+            const __m512i s = _mm512_add_epi64(x, load_avx512(b + i * lanes + l));
+            const __m512i sc = _mm512_mask_add_epi64(s, carry, s, one);
+            carry = static_cast<__mmask8>(_mm512_cmplt_epu64_mask(s, x) |
+                                          _mm512_cmplt_epu64_mask(sc, s));
+            store_avx512(r + i * lanes + l, (i == Words - 1) ? _mm512_and_si512(sc, mask) : sc);
+        }
+    }
+    return end;
+}
+
+template <size_t Words>
+AARITH_TARGET_AVX512 size_t batch_sub_avx512(uint64_t* r, const uint64_t* a, const uint64_t* b,
+                                             const size_t lanes, const uint64_t top_mask)
+{
+    const size_t end = lanes - lanes % 8;
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(top_mask));
+    const __m512i one = _mm512_set1_epi64(1);
+    for (size_t l = 0; l < end; l += 8)
+    {
+        __mmask8 borrow = 0;
+        for (size_t i = 0; i < Words; ++i)
+        {
+            const __m512i x = load_avx512(a + i * lanes + l);
+            const __m512i y = load_avx512(b + i * lanes + l);
+            const __m512i d = _mm512_sub_epi64(x, y);
+            const __m512i db = _mm512_mask_sub_epi64(d, borrow, d, one);
+            borrow = static_cast<__mmask8>(
+                _mm512_cmplt_epu64_mask(x, y) |
+                (borrow & _mm512_cmpeq_epu64_mask(d, _mm512_setzero_si512())));
+            store_avx512(r + i * lanes + l, (i == Words - 1) ? _mm512_and_si512(db, mask) : db);
+        }
+    }
+    return end;
+}
+
+template <size_t Words>
+AARITH_TARGET_AVX512 size_t batch_mul_avx512(uint64_t* r, const uint64_t* a, const uint64_t* b,
+                                             const size_t lanes, const uint64_t top_mask)
+{
+    // see batch_mul_avx2 for the splitting into 32 bit digits
+    constexpr size_t digits = 2 * Words;
+    const size_t end = lanes - lanes % 8;
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(top_mask));
+    const __m512i low = _mm512_set1_epi64(0xFFFFFFFF);
+    for (size_t l = 0; l < end; l += 8)
+    {
+        __m512i x[digits]{}; // NOLINT
+        __m512i y[digits]{}; // NOLINT
+        __m512i t[digits]{}; // NOLINT
+        for (size_t i = 0; i < Words; ++i)
+        {
+            const __m512i va = load_avx512(a + i * lanes + l);
+            const __m512i vb = load_avx512(b + i * lanes + l);
+            x[2 * i] = _mm512_and_si512(va, low);
+            x[2 * i + 1] = srli_avx512<32>(va);
+            y[2 * i] = _mm512_and_si512(vb, low);
+            y[2 * i + 1] = srli_avx512<32>(vb);
+        }
+        for (size_t i = 0; i < digits; ++i)
+        {
+            __m512i carry = _mm512_setzero_si512();
+            for (size_t j = 0; i + j < digits; ++j)
+            {
+                __m512i p = mul_epu32_avx512(x[i], y[j]);
+                p = _mm512_add_epi64(p, t[i + j]);
+                p = _mm512_add_epi64(p, carry);
+                t[i + j] = _mm512_and_si512(p, low);
+                carry = srli_avx512<32>(p);
+            }
+        }
+        for (size_t i = 0; i < Words; ++i)
+        {
+            const __m512i w = _mm512_or_si512(t[2 * i], slli_avx512<32>(t[2 * i + 1]));
+            store_avx512(r + i * lanes + l, (i == Words - 1) ? _mm512_and_si512(w, mask) : w);
+        }
+    }
+    return end;
+}
+
+template <size_t Words>
+AARITH_TARGET_AVX512 size_t batch_logic_avx512(uint64_t* r, const uint64_t* a, const uint64_t* b,
+                                               const size_t lanes, const batch_logic_op op,
+                                               const uint64_t top_mask)
+{
+    const size_t end = lanes - lanes % 8;
+    const __m512i ones = _mm512_set1_epi64(-1);
+    for (size_t i = 0; i < Words; ++i)
+    {
+        const __m512i mask =
+            (i == Words - 1) ? _mm512_set1_epi64(static_cast<int64_t>(top_mask)) : ones;
+        for (size_t l = 0; l < end; l += 8)
+        {
+            const __m512i x = load_avx512(a + i * lanes + l);
+            __m512i result = _mm512_xor_si512(x, ones);
+            switch (op)
+            {
+            case batch_logic_op::bitwise_and:
+                result = _mm512_and_si512(x, load_avx512(b + i * lanes + l));
+                break;
+            case batch_logic_op::bitwise_or:
+                result = _mm512_or_si512(x, load_avx512(b + i * lanes + l));
+                break;
+            case batch_logic_op::bitwise_xor:
+                result = _mm512_xor_si512(x, load_avx512(b + i * lanes + l));
+                break;
+            case batch_logic_op::bitwise_not: break;
+            }
+            store_avx512(r + i * lanes + l, _mm512_and_si512(result, mask));
+        }
+    }
+    return end;
+}
+
+template <size_t Words>
+AARITH_TARGET_AVX512 size_t batch_compare_avx512(bool* less, bool* equal, const uint64_t* a,
+                                                 const uint64_t* b, const size_t lanes,
+                                                 const uint64_t top_flip)
+{
+    const size_t end = lanes - lanes % 8;
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i flip = _mm512_set1_epi64(static_cast<int64_t>(top_flip));
+    for (size_t l = 0; l < end; l += 8)
+    {
+        __mmask8 borrow = 0;
+        __mmask8 different = 0;
+        for (size_t i = 0; i < Words; ++i)
+        {
+            __m512i x = load_avx512(a + i * lanes + l);
+            __m512i y = load_avx512(b + i * lanes + l);
+            if (i == Words - 1)
+            {
+                x = _mm512_xor_si512(x, flip);
+                y = _mm512_xor_si512(y, flip);
+            }
+            const __m512i d = _mm512_sub_epi64(x, y);
+            borrow = static_cast<__mmask8>(_mm512_cmplt_epu64_mask(x, y) |
+                                           (borrow & _mm512_cmpeq_epu64_mask(d, zero)));
+            different = static_cast<__mmask8>(different | _mm512_cmpneq_epu64_mask(x, y));
+        }
+        for (size_t k = 0; k < 8; ++k)
+        {
+            less[l + k] = ((borrow >> k) & 1U) != 0U;
+            equal[l + k] = ((different >> k) & 1U) == 0U;
+        }
+    }
+    return end;
+}
+
+template <size_t Words>
+AARITH_TARGET_AVX512 size_t batch_shift_left_avx512(uint64_t* r, const uint64_t* a,
+                                                    const size_t lanes, const size_t shift,
+                                                    const uint64_t top_mask)
+{
+    const size_t end = lanes - lanes % 8;
+    const size_t skip = shift / 64;
+    const __m128i offset = _mm_cvtsi64_si128(static_cast<int64_t>(shift % 64));
+    const __m128i back = _mm_cvtsi64_si128(static_cast<int64_t>(64 - shift % 64));
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(top_mask));
+    for (size_t l = 0; l < end; l += 8)
+    {
+        for (size_t i = Words; i > 0; --i)
+        {
+            const size_t j = i - 1;
+            __m512i w = _mm512_setzero_si512();
+            if (j >= skip)
+            {
+                w = sll_avx512(load_avx512(a + (j - skip) * lanes + l), offset);
+                if (j > skip)
+                {
+                    w = _mm512_or_si512(
+                        w, srl_avx512(load_avx512(a + (j - skip - 1) * lanes + l), back));
+                }
+            }
+            store_avx512(r + j * lanes + l, (j == Words - 1) ? _mm512_and_si512(w, mask) : w);
+        }
+    }
+    return end;
+}
+
+template <size_t Words>
+AARITH_TARGET_AVX512 size_t batch_shift_right_avx512(uint64_t* r, const uint64_t* a,
+                                                     const size_t lanes, const size_t shift,
+                                                     const uint64_t* fill, const size_t sign_bit)
+{
+    const size_t end = lanes - lanes % 8;
+    const size_t skip = shift / 64;
+    const __m128i offset = _mm_cvtsi64_si128(static_cast<int64_t>(shift % 64));
+    const __m128i back = _mm_cvtsi64_si128(static_cast<int64_t>(64 - shift % 64));
+    const __m128i sign_offset = _mm_cvtsi64_si128(static_cast<int64_t>(sign_bit));
+    const __m512i one = _mm512_set1_epi64(1);
+    for (size_t l = 0; l < end; l += 8)
+    {
+        const __m512i sign = _mm512_sub_epi64(
+            _mm512_setzero_si512(),
+            _mm512_and_si512(
+                srl_avx512(load_avx512(a + (Words - 1) * lanes + l), sign_offset), one));
+        for (size_t i = 0; i < Words; ++i)
+        {
+            __m512i w = _mm512_setzero_si512();
+            if (i + skip < Words)
+            {
+                w = srl_avx512(load_avx512(a + (i + skip) * lanes + l), offset);
+                if (i + skip + 1 < Words)
+                {
+                    w = _mm512_or_si512(
+                        w, sll_avx512(load_avx512(a + (i + skip + 1) * lanes + l), back));
+                }
+            }
+            if (fill != nullptr)
+            {
+                w = _mm512_or_si512(
+                    w, _mm512_and_si512(_mm512_set1_epi64(static_cast<int64_t>(fill[i])), sign));
+            }
+            store_avx512(r + i * lanes + l, w);
+        }
+    }
+    return end;
+}
+
+#endif
+
+/*
+ * The dispatching functions use the SIMD kernels selected by active_simd_level for 64 bit words
+ * and process the remaining lanes (and all other word types) with the scalar kernels.
+ */
+
+template <size_t Words, typename WordType>
+void batch_add(WordType* r, const WordType* a, const WordType* b, const size_t lanes,
+               const WordType top_mask)
+{
+    size_t done = 0;
+#if defined(AARITH_HAS_X86_SIMD_KERNELS)
+    if constexpr (std::is_same_v<WordType, uint64_t>)
+    {
+        switch (active_simd_level())
+        {
+        case simd_level::avx512: done = batch_add_avx512<Words>(r, a, b, lanes, top_mask); break;
+        case simd_level::avx2: done = batch_add_avx2<Words>(r, a, b, lanes, top_mask); break;
+        case simd_level::scalar: break;
+        }
+    }
+#endif
+    batch_add_scalar<Words>(r, a, b, lanes, done, top_mask);
+}
+
+template <size_t Words, typename WordType>
+void batch_sub(WordType* r, const WordType* a, const WordType* b, const size_t lanes,
+               const WordType top_mask)
+{
+    size_t done = 0;
+#if defined(AARITH_HAS_X86_SIMD_KERNELS)
+    if constexpr (std::is_same_v<WordType, uint64_t>)
+    {
+        switch (active_simd_level())
+        {
+        case simd_level::avx512: done = batch_sub_avx512<Words>(r, a, b, lanes, top_mask); break;
+        case simd_level::avx2: done = batch_sub_avx2<Words>(r, a, b, lanes, top_mask); break;
+        case simd_level::scalar: break;
+        }
+    }
+#endif
+    batch_sub_scalar<Words>(r, a, b, lanes, done, top_mask);
+}
+
+template <size_t Words, typename WordType>
+void batch_mul(WordType* r, const WordType* a, const WordType* b, const size_t lanes,
+               const WordType top_mask)
+{
+    size_t done = 0;
+#if defined(AARITH_HAS_X86_SIMD_KERNELS)
+    if constexpr (std::is_same_v<WordType, uint64_t>)
+    {
+        switch (active_simd_level())
+        {
+        case simd_level::avx512: done = batch_mul_avx512<Words>(r, a, b, lanes, top_mask); break;
+        case simd_level::avx2: done = batch_mul_avx2<Words>(r, a, b, lanes, top_mask); break;
+        case simd_level::scalar: break;
+        }
+    }
+#endif
+    batch_mul_scalar<Words>(r, a, b, lanes, done, top_mask);
+}
+
+template <size_t Words, typename WordType>
+void batch_logic(WordType* r, const WordType* a, const WordType* b, const size_t lanes,
+                 const batch_logic_op op, const WordType top_mask)
+{
+    size_t done = 0;
+#if defined(AARITH_HAS_X86_SIMD_KERNELS)
+    if constexpr (std::is_same_v<WordType, uint64_t>)
+    {
+        switch (active_simd_level())
+        {
+        case simd_level::avx512:
+            done = batch_logic_avx512<Words>(r, a, b, lanes, op, top_mask);
+            break;
+        case simd_level::avx2: done = batch_logic_avx2<Words>(r, a, b, lanes, op, top_mask); break;
+        case simd_level::scalar: break;
+        }
+    }
+#endif
+    batch_logic_scalar<Words>(r, a, b, lanes, done, op, top_mask);
+}
+
+template <size_t Words, typename WordType>
+void batch_compare(bool* less, bool* equal, const WordType* a, const WordType* b,
+                   const size_t lanes, const WordType top_flip)
+{
+    size_t done = 0;
+#if defined(AARITH_HAS_X86_SIMD_KERNELS)
+    if constexpr (std::is_same_v<WordType, uint64_t>)
+    {
+        switch (active_simd_level())
+        {
+        case simd_level::avx512:
+            done = batch_compare_avx512<Words>(less, equal, a, b, lanes, top_flip);
+            break;
+        case simd_level::avx2:
+            done = batch_compare_avx2<Words>(less, equal, a, b, lanes, top_flip);
+            break;
+        case simd_level::scalar: break;
+        }
+    }
+#endif
+    batch_compare_scalar<Words>(less, equal, a, b, lanes, done, top_flip);
+}
+
+template <size_t Words, typename WordType>
+void batch_shift_left(WordType* r, const WordType* a, const size_t lanes, const size_t shift,
+                      const WordType top_mask)
+{
+    size_t done = 0;
+#if defined(AARITH_HAS_X86_SIMD_KERNELS)
+    if constexpr (std::is_same_v<WordType, uint64_t>)
+    {
+        switch (active_simd_level())
+        {
+        case simd_level::avx512:
+            done = batch_shift_left_avx512<Words>(r, a, lanes, shift, top_mask);
+            break;
+        case simd_level::avx2:
+            done = batch_shift_left_avx2<Words>(r, a, lanes, shift, top_mask);
+            break;
+        case simd_level::scalar: break;
+        }
+    }
+#endif
+    batch_shift_left_scalar<Words>(r, a, lanes, done, shift, top_mask);
+}
+
+template <size_t Words, typename WordType>
+void batch_shift_right(WordType* r, const WordType* a, const size_t lanes, const size_t shift,
+                       const WordType* fill, const size_t sign_bit)
+{
+    size_t done = 0;
+#if defined(AARITH_HAS_X86_SIMD_KERNELS)
+    if constexpr (std::is_same_v<WordType, uint64_t>)
+    {
+        switch (active_simd_level())
+        {
+        case simd_level::avx512:
+            done = batch_shift_right_avx512<Words>(r, a, lanes, shift, fill, sign_bit);
+            break;
+        case simd_level::avx2:
+            done = batch_shift_right_avx2<Words>(r, a, lanes, shift, fill, sign_bit);
+            break;
+        case simd_level::scalar: break;
+        }
+    }
+#endif
+    batch_shift_right_scalar<Words>(r, a, lanes, done, shift, fill, sign_bit);
+}
+
+} // namespace implementation
+
+/**
+ * @brief Returns the best instruction set extension for batches of numbers supported by the
+ * processor
+ */
+[[nodiscard]] inline simd_level supported_simd_level()
+{
+    static const simd_level level = implementation::detect_simd_level();
+    return level;
+}
+
+/**
+ * @brief Returns the instruction set extension that is used for batches of numbers
+ */
+[[nodiscard]] inline simd_level batch_simd_level()
+{
+    return implementation::active_simd_level();
+}
+
+/**
+ * @brief Selects the instruction set extension used for batches of numbers
+ *
+ * By default, the best extension supported by the processor is used. Requesting an extension that
+ * is not supported selects the best supported one instead. The setting is shared by all threads, it
+ * may be changed while other threads compute with batches (their results do not depend on it).
+ *
+ * @param level The requested instruction set extension
+ */
+inline void set_batch_simd_level(const simd_level level)
+{
+    const simd_level supported = supported_simd_level();
+    implementation::simd_level_setting().store(
+        (static_cast<int>(level) <= static_cast<int>(supported)) ? level : supported,
+        std::memory_order_relaxed);
+}
+
+} // namespace aarith
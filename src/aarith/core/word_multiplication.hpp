@@ -0,0 +1,1198 @@
+#pragma once
+
+#include <aarith/core/thresholds.hpp>
+#include <aarith/core/word_operations.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace aarith {
+
+/**
+ * Namespace to prevent accidental usage. The functions in here multiply natural numbers of
+ * arbitrary size stored as vectors of words (least significant word first). In contrast to the
+ * functions operating on (u)integers, the sizes are only known at run time.
+ */
+namespace implementation {
+
+/**
+ * @brief Removes the leading zero words of a number
+ * @tparam WordType The word type
+ * @param words The words of the number
+ */
+template <typename WordType> void trim_words(std::vector<WordType>& words)
+{
+    while (!words.empty() && words.back() == WordType{0U})
+    {
+        words.pop_back();
+    }
+}
+
+/**
+ * @brief Compares two numbers without leading zero words
+ *
+ * @tparam WordType The word type
+ * @param a The first number
+ * @param b The second number
+ * @return A negative value if a < b, zero if a == b and a positive value if a > b
+ */
+template <typename WordType>
+[[nodiscard]] int compare_words(const std::vector<WordType>& a, const std::vector<WordType>& b)
+{
+    if (a.size() != b.size())
+    {
+        return (a.size() < b.size()) ? -1 : 1;
+    }
+    for (size_t i = a.size(); i > 0; --i)
+    {
+        if (a[i - 1] != b[i - 1])
+        {
+            return (a[i - 1] < b[i - 1]) ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Adds a number to another number shifted by a number of words
+ *
+ * @tparam WordType The word type
+ * @param accumulator The number the other number is added to, grows if necessary
+ * @param b The number to add
+ * @param offset The number of words b is shifted to the left
+ */
+template <typename WordType>
+void add_words_at(std::vector<WordType>& accumulator, const std::vector<WordType>& b,
+                  const size_t offset)
+{
+    if (b.empty())
+    {
+        return;
+    }
+    if (accumulator.size() < offset + b.size())
+    {
+        accumulator.resize(offset + b.size(), WordType{0U});
+    }
+
+    WordType carry{0U};
+    size_t i = 0;
+    for (; i < b.size(); ++i)
+    {
+        accumulator[offset + i] = add_carry(accumulator[offset + i], b[i], carry, carry);
+    }
+    for (i += offset; carry != WordType{0U} && i < accumulator.size(); ++i)
+    {
+        accumulator[i] = add_carry(accumulator[i], WordType{0U}, carry, carry);
+    }
+    if (carry != WordType{0U})
+    {
+        accumulator.push_back(carry);
+    }
+}
+
+/**
+ * @brief Subtracts a number from a larger or equal number
+ *
+ * @tparam WordType The word type
+ * @param a The minuend, it is overwritten with the difference
+ * @param b The subtrahend, has to be at most as large as a
+ */
+template <typename WordType>
+void sub_words_inplace(std::vector<WordType>& a, const std::vector<WordType>& b)
+{
+    WordType borrow{0U};
+    size_t i = 0;
+    for (; i < b.size(); ++i)
+    {
+        a[i] = sub_borrow(a[i], b[i], borrow, borrow);
+    }
+    for (; borrow != WordType{0U} && i < a.size(); ++i)
+    {
+        a[i] = sub_borrow(a[i], WordType{0U}, borrow, borrow);
+    }
+    trim_words(a);
+}
+
+/**
+ * @brief Subtracts a number from a larger or equal number, storing the result in the subtrahend
+ *
+ * @tparam WordType The word type
+ * @param a The subtrahend, it is overwritten with the difference
+ * @param b The minuend, has to be at least as large as a
+ */
+template <typename WordType>
+void sub_words_reverse_inplace(std::vector<WordType>& a, const std::vector<WordType>& b)
+{
+    a.resize(b.size(), WordType{0U});
+    WordType borrow{0U};
+    for (size_t i = 0; i < b.size(); ++i)
+    {
+        a[i] = sub_borrow(b[i], a[i], borrow, borrow);
+    }
+    trim_words(a);
+}
+
+/**
+ * @brief Multiplies a number with a single word in place
+ * @tparam WordType The word type
+ * @param a The number, it is overwritten with the product
+ * @param m The word to multiply with
+ */
+template <typename WordType> void mul_word_inplace(std::vector<WordType>& a, const WordType m)
+{
+    WordType carry{0U};
+    for (auto& word : a)
+    {
+        WordType acc{0U};
+        carry = mul_add_word(acc, word, m, carry);
+        word = acc;
+    }
+    if (carry != WordType{0U})
+    {
+        a.push_back(carry);
+    }
+    trim_words(a);
+}
+
+/**
+ * @brief Divides a number by a single word that is known to divide the number
+ *
+ * As the division is exact, it can be computed from the least significant word upwards using
+ * multiplications with the inverse of the divisor modulo the word size instead of divisions.
+ *
+ * @see Tudor Jebelean: An Algorithm for Exact Division
+ *
+ * @tparam WordType The word type
+ * @param a The number, it is overwritten with the quotient
+ * @param d The non-zero divisor
+ */
+template <typename WordType> void div_word_exact_inplace(std::vector<WordType>& a, WordType d)
+{
+    size_t shift = 0;
+    while ((d & WordType{1U}) == WordType{0U})
+    {
+        d = static_cast<WordType>(d >> 1U);
+        ++shift;
+    }
+
+    if (shift > 0 && !a.empty())
+    {
+        constexpr size_t word_width = bits_per_word<WordType>();
+        for (size_t i = 0; i + 1 < a.size(); ++i)
+        {
+            a[i] = static_cast<WordType>((a[i] >> shift) | (a[i + 1] << (word_width - shift)));
+        }
+        a.back() = static_cast<WordType>(a.back() >> shift);
+    }
+
+    if (d != WordType{1U})
+    {
+        const WordType inverse = inverse_word(d);
+
+        WordType borrow{0U};
+        for (auto& word : a)
+        {
+            WordType borrow_out{0U};
+            const WordType t = sub_borrow(word, borrow, WordType{0U}, borrow_out);
+            const auto q = static_cast<WordType>(uint64_t{t} * inverse);
+            word = q;
+            WordType high{0U};
+            [[maybe_unused]] const WordType low = mul_wide(q, d, high);
+            borrow = static_cast<WordType>(high + borrow_out);
+        }
+    }
+    trim_words(a);
+}
+
+/**
+ * @brief A signed number of arbitrary size in sign-magnitude representation
+ *
+ * Intermediate values of the Toom-Cook multiplications can become negative, this type supports
+ * exactly the operations needed there.
+ *
+ * @tparam WordType The word type
+ */
+template <typename WordType> struct signed_words
+{
+    bool negative{false};
+    std::vector<WordType> magnitude;
+
+    [[nodiscard]] bool is_zero() const
+    {
+        return magnitude.empty();
+    }
+
+    /// Adds (or subtracts) another number
+    signed_words& add(const signed_words& other, const bool subtract)
+    {
+        const bool other_negative = (other.negative != subtract) && !other.is_zero();
+        if (negative == other_negative)
+        {
+            add_words_at(magnitude, other.magnitude, 0);
+            return *this;
+        }
+
+        if (compare_words(magnitude, other.magnitude) >= 0)
+        {
+            sub_words_inplace(magnitude, other.magnitude);
+        }
+        else
+        {
+            sub_words_reverse_inplace(magnitude, other.magnitude);
+            negative = other_negative;
+        }
+        if (magnitude.empty())
+        {
+            negative = false;
+        }
+        return *this;
+    }
+
+    signed_words& operator+=(const signed_words& other)
+    {
+        return add(other, false);
+    }
+
+    signed_words& operator-=(const signed_words& other)
+    {
+        return add(other, true);
+    }
+
+    /// Multiplies the number with a small integer
+    signed_words& mul_small(const int m)
+    {
+        const auto abs_m = static_cast<WordType>(m < 0 ? -m : m);
+        if (abs_m != WordType{1U})
+        {
+            mul_word_inplace(magnitude, abs_m);
+        }
+        negative = !magnitude.empty() && (negative != (m < 0));
+        return *this;
+    }
+
+    /// Divides the number by a small integer that is known to divide the number
+    signed_words& div_small_exact(const int d)
+    {
+        const auto abs_d = static_cast<WordType>(d < 0 ? -d : d);
+        if (abs_d != WordType{1U})
+        {
+            div_word_exact_inplace(magnitude, abs_d);
+        }
+        negative = !magnitude.empty() && (negative != (d < 0));
+        return *this;
+    }
+};
+
+/**
+ * @brief Returns the minimal number of words of the operands for which Karatsuba is used
+ * @tparam WordType The word type
+ */
+template <typename WordType> [[nodiscard]] constexpr size_t karatsuba_words()
+{
+    constexpr size_t word_width = bits_per_word<WordType>();
+    return std::max<size_t>(2U, (AARITH_KARATSUBA_THRESHOLD + word_width - 1) / word_width);
+}
+
+/**
+ * @brief Adds a number to another number in place, propagating the carry
+ *
+ * @tparam WordType The word type
+ * @param r The nr words of the number the other number is added to
+ * @param nr Number of words of r
+ * @param x The nx words of the number to add, nx has to be at most nr
+ * @param nx Number of words of x
+ * @return The carry out of the most significant word of r
+ */
+template <typename WordType>
+constexpr WordType add_words_into(WordType* r, const size_t nr, const WordType* x, const size_t nx)
+{
+    WordType carry{0U};
+    size_t i = 0;
+    for (; i < nx; ++i)
+    {
+        r[i] = add_carry(r[i], x[i], carry, carry);
+    }
+    for (; carry != WordType{0U} && i < nr; ++i)
+    {
+        r[i] = add_carry(r[i], WordType{0U}, carry, carry);
+    }
+    return carry;
+}
+
+/**
+ * @brief Subtracts a number from another number in place, propagating the borrow
+ *
+ * @tparam WordType The word type
+ * @param r The nr words of the minuend, it is overwritten with the difference
+ * @param nr Number of words of r
+ * @param x The nx words of the subtrahend, nx has to be at most nr
+ * @param nx Number of words of x
+ * @return The borrow out of the most significant word of r
+ */
+template <typename WordType>
+constexpr WordType sub_words_from(WordType* r, const size_t nr, const WordType* x, const size_t nx)
+{
+    WordType borrow{0U};
+    size_t i = 0;
+    for (; i < nx; ++i)
+    {
+        r[i] = sub_borrow(r[i], x[i], borrow, borrow);
+    }
+    for (; borrow != WordType{0U} && i < nr; ++i)
+    {
+        r[i] = sub_borrow(r[i], WordType{0U}, borrow, borrow);
+    }
+    return borrow;
+}
+
+/**
+ * @brief Computes the absolute difference of two numbers
+ *
+ * @tparam WordType The word type
+ * @param result The nx words the absolute difference is stored in
+ * @param x The nx words of the first number
+ * @param nx Number of words of x
+ * @param y The ny words of the second number, ny has to be at most nx
+ * @param ny Number of words of y
+ * @return True iff x is less than y
+ */
+template <typename WordType>
+constexpr bool abs_diff_words(WordType* result, const WordType* x, const size_t nx,
+                              const WordType* y, const size_t ny)
+{
+    bool less = false;
+    for (size_t i = nx; i > 0; --i)
+    {
+        const WordType yi = (i <= ny) ? y[i - 1] : WordType{0U};
+        if (x[i - 1] != yi)
+        {
+            less = x[i - 1] < yi;
+            break;
+        }
+    }
+
+    const WordType* larger = less ? y : x;
+    const WordType* smaller = less ? x : y;
+    const size_t n_larger = less ? ny : nx;
+    const size_t n_smaller = less ? nx : ny;
+
+    // the words of the larger number beyond its size are zero, so are the ones of the difference
+    WordType borrow{0U};
+    for (size_t i = 0; i < nx; ++i)
+    {
+        const WordType l = (i < n_larger) ? larger[i] : WordType{0U};
+        const WordType s = (i < n_smaller) ? smaller[i] : WordType{0U};
+        result[i] = sub_borrow(l, s, borrow, borrow);
+    }
+    return less;
+}
+
+/**
+ * @brief Returns the number of scratch words mul_words_karatsuba_balanced needs
+ * @tparam WordType The word type
+ * @param n Number of words of each factor
+ */
+template <typename WordType>
+[[nodiscard]] constexpr size_t karatsuba_balanced_scratch_words(size_t n)
+{
+    size_t words = 0;
+    while (n >= karatsuba_words<WordType>())
+    {
+        const size_t l = (n + 1) / 2;
+        words += 6 * l + 1;
+        n = l;
+    }
+    return words;
+}
+
+/**
+ * @brief Multiplies two numbers of the same number of words using the Karatsuba method
+ *
+ * The factors are split into a low part of l = ceil(n/2) words and a high part. The three products
+ * lo = al * bl, hi = ah * bh and m = |al - ah| * |bl - bh| are computed recursively, the middle
+ * part al * bh + ah * bl = lo + hi -/+ m is then added at word l. Using the absolute differences
+ * instead of the sums keeps all intermediate values at l words, so no recursion on wider
+ * numbers is needed. Below karatsuba_words(), the schoolbook method is used.
+ *
+ * The function does not allocate memory, all intermediate values are stored in the scratch words.
+ *
+ * @note The result array must not overlap with the inputs or the scratch words.
+ *
+ * @tparam WordType The word type
+ * @param result The 2n words the product is stored in
+ * @param a The n words of the first factor (least significant word first)
+ * @param b The n words of the second factor (least significant word first)
+ * @param n Number of words of each factor
+ * @param scratch At least karatsuba_balanced_scratch_words(n) words of scratch space
+ */
+template <typename WordType>
+constexpr void mul_words_karatsuba_balanced(WordType* result, const WordType* a,
+                                            const WordType* b, const size_t n,
+                                            WordType* scratch)
+{
+    if (n < karatsuba_words<WordType>())
+    {
+        mul_words(result, a, n, b, n);
+        return;
+    }
+
+    const size_t l = (n + 1) / 2;
+    const size_t h = n - l;
+
+    WordType* da = scratch;
+    WordType* db = da + l;
+    WordType* m = db + l;
+    WordType* mid = m + 2 * l;
+    WordType* rest = mid + 2 * l + 1;
+
+    const bool a_negative = abs_diff_words(da, a, l, a + l, h);
+    const bool b_negative = abs_diff_words(db, b, l, b + l, h);
+
+    mul_words_karatsuba_balanced(m, da, db, l, rest);
+    mul_words_karatsuba_balanced(result, a, b, l, rest);
+    mul_words_karatsuba_balanced(result + 2 * l, a + l, b + l, h, rest);
+
+    // mid = lo + hi -/+ m is never negative as it equals al * bh + ah * bl
+    for (size_t i = 0; i < 2 * l; ++i)
+    {
+        mid[i] = result[i];
+    }
+    mid[2 * l] = WordType{0U};
+    add_words_into(mid, 2 * l + 1, result + 2 * l, 2 * h);
+    if (a_negative == b_negative)
+    {
+        sub_words_from(mid, 2 * l + 1, m, 2 * l);
+    }
+    else
+    {
+        add_words_into(mid, 2 * l + 1, m, 2 * l);
+    }
+
+    // the product fits into 2n words, so the words of mid beyond them are zero
+    const size_t mid_words = std::min(2 * l + 1, 2 * n - l);
+    add_words_into(result + l, 2 * n - l, mid, mid_words);
+}
+
+/**
+ * @brief Returns the number of scratch words mul_words_karatsuba needs
+ * @tparam WordType The word type
+ * @param na Number of words of the first factor
+ * @param nb Number of words of the second factor
+ */
+template <typename WordType>
+[[nodiscard]] constexpr size_t karatsuba_scratch_words(const size_t na, const size_t nb)
+{
+    const size_t large = std::max(na, nb);
+    const size_t small = std::min(na, nb);
+    if (small < karatsuba_words<WordType>())
+    {
+        return 0;
+    }
+    if (large == small)
+    {
+        return karatsuba_balanced_scratch_words<WordType>(small);
+    }
+    // the remainder is multiplied after the full chunks, reusing the scratch words of the chunks
+    const size_t remainder = large % small;
+    const size_t remainder_words =
+        (remainder == 0) ? 0 : karatsuba_scratch_words<WordType>(remainder, small);
+    return 2 * small + std::max(karatsuba_balanced_scratch_words<WordType>(small), remainder_words);
+}
+
+/**
+ * @brief Multiplies two numbers of arbitrary numbers of words using the Karatsuba method
+ *
+ * If the numbers of words differ, the larger factor is cut into chunks of the size of the smaller
+ * factor. The chunks are multiplied with the smaller factor using balanced Karatsuba and the
+ * products are accumulated, so the smaller factor is never widened to the size of the larger one.
+ *
+ * The function does not allocate memory, all intermediate values are stored in the scratch words.
+ *
+ * @note The result array must not overlap with the inputs or the scratch words.
+ *
+ * @tparam WordType The word type
+ * @param result The na + nb words the product is stored in
+ * @param a Words of the first factor (least significant word first)
+ * @param na Number of words of the first factor
+ * @param b Words of the second factor (least significant word first)
+ * @param nb Number of words of the second factor
+ * @param scratch At least karatsuba_scratch_words(na, nb) words of scratch space
+ */
+template <typename WordType>
+constexpr void mul_words_karatsuba(WordType* result, const WordType* a, const size_t na,
+                                   const WordType* b, const size_t nb, WordType* scratch)
+{
+    if (na < nb)
+    {
+        mul_words_karatsuba(result, b, nb, a, na, scratch);
+        return;
+    }
+    if (nb < karatsuba_words<WordType>())
+    {
+        mul_words(result, a, na, b, nb);
+        return;
+    }
+    if (na == nb)
+    {
+        mul_words_karatsuba_balanced(result, a, b, nb, scratch);
+        return;
+    }
+
+    for (size_t i = 0; i < na + nb; ++i)
+    {
+        result[i] = WordType{0U};
+    }
+
+    WordType* chunk_product = scratch;
+    WordType* rest = scratch + 2 * nb;
+
+    size_t offset = 0;
+    for (; offset + nb <= na; offset += nb)
+    {
+        mul_words_karatsuba_balanced(chunk_product, a + offset, b, nb, rest);
+        add_words_into(result + offset, na + nb - offset, chunk_product, 2 * nb);
+    }
+    if (offset < na)
+    {
+        const size_t remainder = na - offset;
+        mul_words_karatsuba(chunk_product, a + offset, remainder, b, nb, rest);
+        add_words_into(result + offset, na + nb - offset, chunk_product, remainder + nb);
+    }
+}
+
+template <typename WordType>
+[[nodiscard]] std::vector<WordType> mul_words_dispatch(const std::vector<WordType>& a,
+                                                       const std::vector<WordType>& b);
+
+/**
+ * @brief Multiplies two numbers using the schoolbook method
+ * @tparam WordType The word type
+ * @param a First factor
+ * @param b Second factor
+ * @return The product of a and b
+ */
+template <typename WordType>
+[[nodiscard]] std::vector<WordType> mul_words_schoolbook(const std::vector<WordType>& a,
+                                                         const std::vector<WordType>& b)
+{
+    if (a.empty() || b.empty())
+    {
+        return {};
+    }
+    std::vector<WordType> product(a.size() + b.size());
+    mul_words(product.data(), a.data(), a.size(), b.data(), b.size());
+    trim_words(product);
+    return product;
+}
+
+/**
+ * @brief Multiplies two numbers of very different size
+ *
+ * The larger number is cut into chunks of the size of the smaller number. The products of the
+ * chunks with the smaller number are then accumulated.
+ *
+ * @tparam WordType The word type
+ * @param large The larger factor
+ * @param small The smaller factor
+ * @return The product of large and small
+ */
+template <typename WordType>
+[[nodiscard]] std::vector<WordType> mul_words_unbalanced(const std::vector<WordType>& large,
+                                                         const std::vector<WordType>& small)
+{
+    std::vector<WordType> product;
+    product.reserve(large.size() + small.size());
+
+    const size_t chunk = small.size();
+    for (size_t offset = 0; offset < large.size(); offset += chunk)
+    {
+        const size_t end = std::min(offset + chunk, large.size());
+        std::vector<WordType> piece(large.begin() + static_cast<std::ptrdiff_t>(offset),
+                                    large.begin() + static_cast<std::ptrdiff_t>(end));
+        trim_words(piece);
+        add_words_at(product, mul_words_dispatch(piece, small), offset);
+    }
+    trim_words(product);
+    return product;
+}
+
+/**
+ * @brief Multiplies two numbers using the Toom-Cook method
+ *
+ * The numbers are split into the given number of parts which are interpreted as coefficients of
+ * polynomials. The polynomials are evaluated at 2 * parts - 2 small integers and infinity, the
+ * values are multiplied pointwise and the product polynomial is recovered exactly using Newton
+ * interpolation. All divisions during the interpolation are exact. Evaluating the product
+ * polynomial at the split point yields the product of the numbers.
+ *
+ * Toom-Cook 3 (parts = 3) evaluates at 0, 1, -1, 2 and infinity, Toom-Cook 4 (parts = 4) at 0, 1,
+ * -1, 2, -2, 3 and infinity.
+ *
+ * @see Marco Bodrato, Alberto Zanoni: Integer and Polynomial Multiplication: Towards Optimal
+ * Toom-Cook Matrices
+ *
+ * @tparam WordType The word type
+ * @param a First factor
+ * @param b Second factor
+ * @param parts The number of parts the factors are split into (three or four)
+ * @return The product of a and b
+ */
+template <typename WordType>
+[[nodiscard]] std::vector<WordType> mul_words_toom(const std::vector<WordType>& a,
+                                                   const std::vector<WordType>& b,
+                                                   const size_t parts)
+{
+    if (a.empty() || b.empty())
+    {
+        return {};
+    }
+
+    constexpr int points[] = {0, 1, -1, 2, -2, 3};
+    const size_t degree = 2 * parts - 2;
+    const size_t finite_points = degree;
+
+    const size_t k = (std::max(a.size(), b.size()) + parts - 1) / parts;
+
+    const auto split_number = [k, parts](const std::vector<WordType>& n) {
+        std::vector<std::vector<WordType>> split_parts(parts);
+        for (size_t i = 0; i < parts; ++i)
+        {
+            const size_t begin = std::min(i * k, n.size());
+            const size_t end = std::min((i + 1) * k, n.size());
+            split_parts[i].assign(n.begin() + static_cast<std::ptrdiff_t>(begin),
+                                  n.begin() + static_cast<std::ptrdiff_t>(end));
+            trim_words(split_parts[i]);
+        }
+        return split_parts;
+    };
+
+    const auto evaluate = [parts](const std::vector<std::vector<WordType>>& coefficients,
+                                  const int x) {
+        signed_words<WordType> value{false, coefficients[parts - 1]};
+        for (size_t i = parts - 1; i > 0; --i)
+        {
+            value.mul_small(x);
+            value += signed_words<WordType>{false, coefficients[i - 1]};
+        }
+        return value;
+    };
+
+    const auto a_parts = split_number(a);
+    const auto b_parts = split_number(b);
+
+    // pointwise products
+    const std::vector<WordType> r_inf = mul_words_dispatch(a_parts[parts - 1], b_parts[parts - 1]);
+
+    std::vector<signed_words<WordType>> values(finite_points);
+    for (size_t i = 0; i < finite_points; ++i)
+    {
+        const auto a_value = evaluate(a_parts, points[i]);
+        const auto b_value = evaluate(b_parts, points[i]);
+        values[i].magnitude = mul_words_dispatch(a_value.magnitude, b_value.magnitude);
+        values[i].negative = !values[i].is_zero() && (a_value.negative != b_value.negative);
+
+        // remove the contribution of the leading coefficient
+        signed_words<WordType> leading{false, r_inf};
+        for (size_t j = 0; j < degree && !leading.is_zero(); ++j)
+        {
+            leading.mul_small(points[i]);
+        }
+        values[i] -= leading;
+    }
+
+    // divided differences
+    for (size_t j = 1; j < finite_points; ++j)
+    {
+        for (size_t i = finite_points - 1; i >= j; --i)
+        {
+            values[i] -= values[i - 1];
+            values[i].div_small_exact(points[i] - points[i - j]);
+        }
+    }
+
+    // convert the Newton form into the coefficients of the product polynomial
+    // (the coefficients are stored with the highest degree first while they are computed)
+    std::vector<signed_words<WordType>> coefficients;
+    coefficients.reserve(finite_points);
+    coefficients.push_back(std::move(values[finite_points - 1]));
+    signed_words<WordType> scaled;
+    for (size_t i = finite_points - 1; i > 0; --i)
+    {
+        // multiply with (x - points[i - 1]) and add the next divided difference
+        coefficients.emplace_back();
+        if (points[i - 1] != 0)
+        {
+            for (size_t j = coefficients.size() - 1; j > 0; --j)
+            {
+                scaled = coefficients[j - 1];
+                scaled.mul_small(points[i - 1]);
+                coefficients[j] -= scaled;
+            }
+        }
+        coefficients.back() += values[i - 1];
+    }
+    std::reverse(coefficients.begin(), coefficients.end());
+
+    // recompose the product from the coefficients
+    std::vector<WordType> product;
+    product.reserve(a.size() + b.size());
+    for (size_t i = 0; i < coefficients.size(); ++i)
+    {
+        if (coefficients[i].negative)
+        {
+            throw std::logic_error("Toom-Cook interpolation yielded a negative coefficient");
+        }
+        add_words_at(product, coefficients[i].magnitude, i * k);
+    }
+    add_words_at(product, r_inf, degree * k);
+    trim_words(product);
+    return product;
+}
+
+/**
+ * @brief Arithmetic modulo a prime of less than 63 bits using Montgomery's representation
+ *
+ * All values passed to and returned from the member functions (except for to_montgomery and
+ * from_montgomery) are in Montgomery representation, i.e., the value x is stored as x * 2^64 mod p.
+ *
+ * @see Peter L. Montgomery: Modular multiplication without trial division
+ */
+class ntt_prime_field
+{
+public:
+    /**
+     * @brief Creates the field
+     * @param modulus The odd prime modulus (less than 2^63)
+     * @param generator A primitive root modulo the prime
+     */
+    ntt_prime_field(const uint64_t modulus, const uint64_t generator)
+        : p{modulus}
+    {
+        // Newton iteration doubling the number of correct bits of the inverse in every step
+        uint64_t inverse = modulus;
+        for (int i = 0; i < 5; ++i)
+        {
+            inverse *= uint64_t{2U} - modulus * inverse;
+        }
+        p_inverse = inverse;
+
+        // 2^64 mod p is doubled 64 times to get 2^128 mod p
+        r_squared = (uint64_t{0U} - modulus) % modulus;
+        for (int i = 0; i < 64; ++i)
+        {
+            r_squared = add(r_squared, r_squared);
+        }
+
+        g = to_montgomery(generator);
+    }
+
+    [[nodiscard]] uint64_t modulus() const
+    {
+        return p;
+    }
+
+    [[nodiscard]] uint64_t to_montgomery(const uint64_t a) const
+    {
+        return mul(a, r_squared);
+    }
+
+    [[nodiscard]] uint64_t from_montgomery(const uint64_t a) const
+    {
+        return reduce(0U, a);
+    }
+
+    [[nodiscard]] uint64_t add(const uint64_t a, const uint64_t b) const
+    {
+        const uint64_t sum = a + b;
+        return (sum >= p) ? sum - p : sum;
+    }
+
+    [[nodiscard]] uint64_t sub(const uint64_t a, const uint64_t b) const
+    {
+        return (a >= b) ? a - b : a + (p - b);
+    }
+
+    [[nodiscard]] uint64_t mul(const uint64_t a, const uint64_t b) const
+    {
+        uint64_t high{0U};
+        const uint64_t low = mul_wide(a, b, high);
+        return reduce(high, low);
+    }
+
+    [[nodiscard]] uint64_t pow(uint64_t base, uint64_t exponent) const
+    {
+        uint64_t result = to_montgomery(1U);
+        while (exponent > 0U)
+        {
+            if ((exponent & 1U) != 0U)
+            {
+                result = mul(result, base);
+            }
+            base = mul(base, base);
+            exponent >>= 1U;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Returns the inverse of an element using Fermat's little theorem
+     */
+    [[nodiscard]] uint64_t inverse(const uint64_t a) const
+    {
+        return pow(a, p - 2U);
+    }
+
+    /**
+     * @brief Returns a primitive n-th root of unity (n has to divide p - 1)
+     */
+    [[nodiscard]] uint64_t root_of_unity(const uint64_t n) const
+    {
+        return pow(g, (p - 1U) / n);
+    }
+
+private:
+    /**
+     * @brief Computes high:low * 2^-64 mod p for high:low < p * 2^64 (Montgomery reduction)
+     */
+    [[nodiscard]] uint64_t reduce(const uint64_t high, const uint64_t low) const
+    {
+        // m * p has the same least significant word as high:low, so it cancels out
+        const uint64_t m = low * p_inverse;
+        uint64_t mp_high{0U};
+        static_cast<void>(mul_wide(m, p, mp_high));
+        const uint64_t t = high - mp_high;
+        return (high < mp_high) ? t + p : t;
+    }
+
+    uint64_t p;
+    uint64_t p_inverse{0U};
+    uint64_t r_squared{0U};
+    uint64_t g{0U};
+};
+
+/**
+ * @brief Computes the number theoretic transform of a sequence in place
+ *
+ * The sequence has to be in Montgomery representation and its length has to be a power of two
+ * dividing p - 1. The inverse transform is not scaled by the inverse of the length.
+ *
+ * @param values The sequence to transform
+ * @param field The prime field the transform is computed in
+ * @param inverse Whether the inverse transform is computed
+ */
+inline void ntt_transform(std::vector<uint64_t>& values, const ntt_prime_field& field,
+                          const bool inverse)
+{
+    const size_t n = values.size();
+
+    // bit reversal permutation
+    for (size_t i = 1, j = 0; i < n; ++i)
+    {
+        size_t bit = n >> 1U;
+        for (; (j & bit) != 0U; bit >>= 1U)
+        {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j)
+        {
+            std::swap(values[i], values[j]);
+        }
+    }
+
+    std::vector<uint64_t> twiddles(std::max<size_t>(n / 2, 1));
+    twiddles[0] = field.to_montgomery(1U);
+    for (size_t length = 2; length <= n; length <<= 1U)
+    {
+        const size_t half = length / 2;
+        uint64_t root = field.root_of_unity(length);
+        if (inverse)
+        {
+            root = field.inverse(root);
+        }
+        for (size_t j = 1; j < half; ++j)
+        {
+            twiddles[j] = field.mul(twiddles[j - 1], root);
+        }
+
+        for (size_t i = 0; i < n; i += length)
+        {
+            for (size_t j = 0; j < half; ++j)
+            {
+                const uint64_t u = values[i + j];
+                const uint64_t v = field.mul(values[i + j + half], twiddles[j]);
+                values[i + j] = field.add(u, v);
+                values[i + j + half] = field.sub(u, v);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Converts a number into a vector of 64 bit words
+ * @tparam WordType The word type of the number (at most 64 bits wide)
+ * @param words The number (least significant word first)
+ * @return The same number stored as 64 bit words
+ */
+template <typename WordType>
+[[nodiscard]] std::vector<uint64_t> to_uint64_words(const std::vector<WordType>& words)
+{
+    static_assert(64 % bits_per_word<WordType>() == 0, "Unsupported word type");
+    constexpr size_t per_word = 64 / bits_per_word<WordType>();
+
+    std::vector<uint64_t> result((words.size() + per_word - 1) / per_word, 0U);
+    for (size_t i = 0; i < words.size(); ++i)
+    {
+        result[i / per_word] |= static_cast<uint64_t>(words[i])
+                                << ((i % per_word) * bits_per_word<WordType>());
+    }
+    return result;
+}
+
+/**
+ * @brief Converts a vector of 64 bit words into a vector of words of the given type
+ * @tparam WordType The word type of the result (at most 64 bits wide)
+ * @param words The number (least significant word first)
+ * @return The same number stored as words of the given type
+ */
+template <typename WordType>
+[[nodiscard]] std::vector<WordType> from_uint64_words(const std::vector<uint64_t>& words)
+{
+    static_assert(64 % bits_per_word<WordType>() == 0, "Unsupported word type");
+    constexpr size_t per_word = 64 / bits_per_word<WordType>();
+
+    std::vector<WordType> result(words.size() * per_word);
+    for (size_t i = 0; i < result.size(); ++i)
+    {
+        result[i] = static_cast<WordType>(words[i / per_word] >>
+                                          ((i % per_word) * bits_per_word<WordType>()));
+    }
+    trim_words(result);
+    return result;
+}
+
+/**
+ * @brief Multiplies two numbers using number theoretic transforms
+ *
+ * The numbers are split into 64 bit coefficients whose convolution is computed modulo three primes
+ * of the form k * 2^n + 1 with n >= 55. As the product of the primes exceeds 2^183, the exact
+ * convolution is recovered by the Chinese remainder theorem (using Garner's algorithm) for
+ * transforms of length up to 2^55. The coefficients are then added with carry propagation.
+ *
+ * @see Arnold Schönhage, Volker Strassen: Schnelle Multiplikation großer Zahlen
+ *
+ * @tparam WordType The word type
+ * @param a First factor
+ * @param b Second factor
+ * @return The product of a and b
+ */
+template <typename WordType>
+[[nodiscard]] std::vector<WordType> mul_words_ntt(const std::vector<WordType>& a,
+                                                  const std::vector<WordType>& b)
+{
+    if (a.empty() || b.empty())
+    {
+        return {};
+    }
+
+    const std::vector<uint64_t> a64 = to_uint64_words(a);
+    const std::vector<uint64_t> b64 = to_uint64_words(b);
+    const size_t coefficients = a64.size() + b64.size() - 1;
+
+    size_t n = 1;
+    while (n < coefficients)
+    {
+        n <<= 1U;
+    }
+    if (n > (size_t{1} << 55U))
+    {
+        throw std::length_error("Factors are too large for the number theoretic transform");
+    }
+
+    const ntt_prime_field fields[] = {ntt_prime_field{4179340454199820289ULL, 3U},
+                                      ntt_prime_field{2485986994308513793ULL, 5U},
+                                      ntt_prime_field{1945555039024054273ULL, 5U}};
+
+    std::vector<uint64_t> residues[3];
+    std::vector<uint64_t> fb(n);
+    for (size_t k = 0; k < 3; ++k)
+    {
+        const ntt_prime_field& field = fields[k];
+        std::vector<uint64_t>& fa = residues[k];
+        fa.assign(n, 0U);
+        std::fill(fb.begin(), fb.end(), uint64_t{0U});
+        for (size_t i = 0; i < a64.size(); ++i)
+        {
+            fa[i] = field.to_montgomery(a64[i]);
+        }
+        for (size_t i = 0; i < b64.size(); ++i)
+        {
+            fb[i] = field.to_montgomery(b64[i]);
+        }
+
+        ntt_transform(fa, field, false);
+        ntt_transform(fb, field, false);
+        for (size_t i = 0; i < n; ++i)
+        {
+            fa[i] = field.mul(fa[i], fb[i]);
+        }
+        ntt_transform(fa, field, true);
+
+        // scaling with n^-1 and leaving the Montgomery representation can be done at once
+        const uint64_t n_inverse =
+            field.from_montgomery(field.inverse(field.to_montgomery(static_cast<uint64_t>(n))));
+        for (size_t i = 0; i < coefficients; ++i)
+        {
+            fa[i] = field.mul(fa[i], n_inverse);
+        }
+    }
+
+    const uint64_t p0 = fields[0].modulus();
+    const uint64_t p1 = fields[1].modulus();
+    // constants for Garner's algorithm in Montgomery representation, multiplying a value in
+    // standard representation with them yields a result in standard representation
+    const uint64_t p0_inverse_mod_p1 = fields[1].inverse(fields[1].to_montgomery(p0 % p1));
+    const uint64_t p0_inverse_mod_p2 =
+        fields[2].inverse(fields[2].to_montgomery(p0 % fields[2].modulus()));
+    const uint64_t p1_inverse_mod_p2 =
+        fields[2].inverse(fields[2].to_montgomery(p1 % fields[2].modulus()));
+
+    std::vector<uint64_t> product(coefficients + 2, 0U);
+    uint64_t carry_low{0U};
+    uint64_t carry_high{0U};
+    for (size_t i = 0; i < coefficients; ++i)
+    {
+        const uint64_t x0 = residues[0][i];
+        const uint64_t x1 =
+            fields[1].mul(fields[1].sub(residues[1][i], x0 % p1), p0_inverse_mod_p1);
+        const uint64_t x2 = fields[2].mul(
+            fields[2].sub(fields[2].mul(fields[2].sub(residues[2][i], x0 % fields[2].modulus()),
+                                        p0_inverse_mod_p2),
+                          x1 % fields[2].modulus()),
+            p1_inverse_mod_p2);
+
+        // value = x0 + p0 * (x1 + p1 * x2)
+        uint64_t t_high{0U};
+        uint64_t c{0U};
+        uint64_t t_low = mul_wide(p1, x2, t_high);
+        t_low = add_carry(t_low, x1, uint64_t{0U}, c);
+        t_high += c;
+
+        uint64_t v1{0U};
+        uint64_t v2{0U};
+        uint64_t v0 = mul_wide(p0, t_low, v1);
+        uint64_t h_low = mul_wide(p0, t_high, v2);
+        v1 = add_carry(v1, h_low, uint64_t{0U}, c);
+        v2 += c;
+        v0 = add_carry(v0, x0, uint64_t{0U}, c);
+        v1 = add_carry(v1, uint64_t{0U}, c, c);
+        v2 += c;
+
+        // add the carry of the previous coefficients
+        product[i] = add_carry(v0, carry_low, uint64_t{0U}, c);
+        carry_low = add_carry(v1, carry_high, c, c);
+        carry_high = v2 + c;
+    }
+    product[coefficients] = carry_low;
+    product[coefficients + 1] = carry_high;
+
+    return from_uint64_words<WordType>(product);
+}
+
+/**
+ * @brief Multiplies two numbers choosing the multiplication algorithm based on their sizes
+ *
+ * @tparam WordType The word type
+ * @param a First factor
+ * @param b Second factor
+ * @return The product of a and b
+ */
+template <typename WordType>
+[[nodiscard]] std::vector<WordType> mul_words_dispatch(const std::vector<WordType>& a,
+                                                       const std::vector<WordType>& b)
+{
+    constexpr size_t word_width = bits_per_word<WordType>();
+    constexpr size_t toom3_words = (AARITH_TOOM3_THRESHOLD + word_width - 1) / word_width;
+    constexpr size_t toom4_words = (AARITH_TOOM4_THRESHOLD + word_width - 1) / word_width;
+    constexpr size_t ntt_words = (AARITH_NTT_THRESHOLD + word_width - 1) / word_width;
+
+    const auto& large = (a.size() >= b.size()) ? a : b;
+    const auto& small = (a.size() >= b.size()) ? b : a;
+
+    if (small.empty())
+    {
+        return {};
+    }
+    if (small.size() < karatsuba_words<WordType>())
+    {
+        return mul_words_schoolbook(large, small);
+    }
+    if (small.size() < toom3_words)
+    {
+        std::vector<WordType> product(large.size() + small.size());
+        std::vector<WordType> scratch(
+            karatsuba_scratch_words<WordType>(large.size(), small.size()));
+        mul_words_karatsuba(product.data(), large.data(), large.size(), small.data(), small.size(),
+                            scratch.data());
+        trim_words(product);
+        return product;
+    }
+    if (small.size() >= ntt_words)
+    {
+        return mul_words_ntt(large, small);
+    }
+    if (large.size() >= 2 * small.size())
+    {
+        return mul_words_unbalanced(large, small);
+    }
+    if (small.size() < toom4_words)
+    {
+        return mul_words_toom(large, small, 3);
+    }
+    return mul_words_toom(large, small, 4);
+}
+
+/**
+ * @brief Copies the words of a word_array like container into a vector without leading zero words
+ * @tparam W The word_array like type
+ * @param w The container whose words are copied
+ * @return Vector containing the significant words of w (least significant word first)
+ */
+template <typename W> [[nodiscard]] auto to_word_vector(const W& w)
+{
+    std::vector<typename W::word_type> words(W::word_count());
+    for (size_t i = 0; i < W::word_count(); ++i)
+    {
+        words[i] = w.word(i);
+    }
+    trim_words(words);
+    return words;
+}
+
+/**
+ * @brief Stores the words of a vector in a word_array like container
+ *
+ * Words and bits exceeding the width of the container are discarded.
+ *
+ * @tparam W The word_array like type
+ * @param words The words to store (least significant word first)
+ * @return The container holding the words
+ */
+template <typename W>
+[[nodiscard]] W from_word_vector(const std::vector<typename W::word_type>& words)
+{
+    W result;
+    for (size_t i = 0; i < std::min(words.size(), W::word_count()); ++i)
+    {
+        result.set_word(i, words[i]);
+    }
+    return result;
+}
+
+} // namespace implementation
+
+} // namespace aarith
@@ -0,0 +1,1310 @@
+#pragma once
+
+#include <aarith/core/traits.hpp>
+#include <aarith/core/word_storage.hpp>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_addcll) && __has_builtin(__builtin_subcll)
+#define AARITH_HAS_BUILTIN_ADDCLL
+#endif
+#endif
+
+// GCC only provides __builtin_is_constant_evaluated since version 9, which has no __has_builtin
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define AARITH_HAS_BUILTIN_IS_CONSTANT_EVALUATED
+#endif
+#elif (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define AARITH_HAS_BUILTIN_IS_CONSTANT_EVALUATED
+#endif
+
+#if !defined(AARITH_HAS_BUILTIN_ADDCLL)
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#define AARITH_HAS_ADDCARRY_U64
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#include <x86intrin.h>
+#define AARITH_HAS_ADDCARRY_U64
+#endif
+#endif
+
+namespace aarith {
+
+/**
+ * Namespace to prevent accidental usage. The functions in here operate on single words or on plain
+ * arrays of words and are the building blocks for the operations on (unsigned) integers.
+ */
+namespace implementation {
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 uint128_t; // NOLINT
+__extension__ typedef __int128 int128_t;           // NOLINT
+#endif
+
+/**
+ * @brief Type trait yielding a native unsigned integer type that is twice as wide as the given word
+ * type.
+ *
+ * The type member is void if there is no such type (i.e. for 64 bit words on platforms without
+ * 128 bit integers).
+ *
+ * @tparam WordType The word type to double
+ */
+template <typename WordType> struct double_word
+{
+    using type = void;
+};
+
+template <> struct double_word<uint8_t>
+{
+    using type = uint16_t;
+};
+
+template <> struct double_word<uint16_t>
+{
+    using type = uint32_t;
+};
+
+template <> struct double_word<uint32_t>
+{
+    using type = uint64_t;
+};
+
+#if defined(__SIZEOF_INT128__)
+template <> struct double_word<uint64_t>
+{
+    using type = uint128_t;
+};
+#endif
+
+/**
+ * @brief Helper for the `double_word` type trait
+ * @tparam WordType The word type to double
+ */
+template <typename WordType> using double_word_t = typename double_word<WordType>::type;
+
+/**
+ * @brief Returns the number of bits stored in a word of the given type
+ * @tparam WordType The word type
+ * @return The bit width of the word type
+ */
+template <typename WordType> [[nodiscard]] constexpr size_t bits_per_word() noexcept
+{
+    return sizeof(WordType) * CHAR_BIT;
+}
+
+/**
+ * @brief Checks whether the function is evaluated in a constant expression
+ *
+ * Intrinsics can only be used if the evaluation does not happen at compile time. For compilers
+ * that do not allow to detect this, the evaluation is always assumed to happen at compile time.
+ *
+ * @return True if the evaluation happens at compile time
+ */
+[[nodiscard]] constexpr bool is_constant_evaluated() noexcept
+{
+#if defined(AARITH_HAS_BUILTIN_IS_CONSTANT_EVALUATED)
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+}
+
+/**
+ * @brief Adds two words and an incoming carry
+ *
+ * For 64 bit words, the add-with-carry intrinsics of the compiler are used if available so that
+ * the carry is propagated using the carry flag of the processor.
+ *
+ * @tparam WordType The word type
+ * @param a First summand
+ * @param b Second summand
+ * @param carry_in Incoming carry, has to be zero or one
+ * @param carry_out Outgoing carry (may be the same variable as carry_in)
+ * @return The sum of a, b and carry_in modulo 2^(word width)
+ */
+template <typename WordType>
+[[nodiscard]] constexpr WordType add_carry(const WordType a, const WordType b,
+                                           const WordType carry_in, WordType& carry_out)
+{
+    static_assert(::aarith::is_unsigned_int<WordType>);
+
+    if constexpr (std::is_same_v<WordType, uint64_t>)
+    {
+        if (!is_constant_evaluated())
+        {
+#if defined(AARITH_HAS_BUILTIN_ADDCLL)
+            unsigned long long out{0U}; // NOLINT
+            const auto sum = __builtin_addcll(a, b, carry_in, &out);
+            carry_out = out;
+            return sum;
+#elif defined(AARITH_HAS_ADDCARRY_U64)
+            unsigned long long sum{0U}; // NOLINT
+            carry_out = _addcarry_u64(static_cast<unsigned char>(carry_in), a, b, &sum);
+            return sum;
+#endif
+        }
+    }
+
+    const auto partial_sum = static_cast<WordType>(a + b);
+    const auto sum = static_cast<WordType>(partial_sum + carry_in);
+    carry_out = static_cast<WordType>(((partial_sum < a) || (sum < partial_sum)) ? 1U : 0U);
+    return sum;
+}
+
+/**
+ * @brief Subtracts two words and an incoming borrow
+ *
+ * For 64 bit words, the subtract-with-borrow intrinsics of the compiler are used if available so
+ * that the borrow is propagated using the carry flag of the processor.
+ *
+ * @tparam WordType The word type
+ * @param a Minuend
+ * @param b Subtrahend
+ * @param borrow_in Incoming borrow, has to be zero or one
+ * @param borrow_out Outgoing borrow (may be the same variable as borrow_in)
+ * @return The difference a - b - borrow_in modulo 2^(word width)
+ */
+template <typename WordType>
+[[nodiscard]] constexpr WordType sub_borrow(const WordType a, const WordType b,
+                                            const WordType borrow_in, WordType& borrow_out)
+{
+    static_assert(::aarith::is_unsigned_int<WordType>);
+
+    if constexpr (std::is_same_v<WordType, uint64_t>)
+    {
+        if (!is_constant_evaluated())
+        {
+#if defined(AARITH_HAS_BUILTIN_ADDCLL)
+            unsigned long long out{0U}; // NOLINT
+            const auto difference = __builtin_subcll(a, b, borrow_in, &out);
+            borrow_out = out;
+            return difference;
+#elif defined(AARITH_HAS_ADDCARRY_U64)
+            unsigned long long difference{0U}; // NOLINT
+            borrow_out = _subborrow_u64(static_cast<unsigned char>(borrow_in), a, b, &difference);
+            return difference;
+#endif
+        }
+    }
+
+    const auto partial_difference = static_cast<WordType>(a - b);
+    const auto difference = static_cast<WordType>(partial_difference - borrow_in);
+    borrow_out =
+        static_cast<WordType>(((a < b) || (partial_difference < borrow_in)) ? 1U : 0U);
+    return difference;
+}
+
+/**
+ * @brief Computes the full product of two words by multiplying their halves
+ *
+ * This is the portable fallback for word types that have no native type twice as wide.
+ *
+ * @tparam WordType The word type
+ * @param a First factor
+ * @param b Second factor
+ * @param high The most significant word of the product
+ * @return The least significant word of the product
+ */
+template <typename WordType>
+[[nodiscard]] constexpr WordType mul_wide_halves(const WordType a, const WordType b,
+                                                 WordType& high)
+{
+    static_assert(::aarith::is_unsigned_int<WordType>);
+
+    constexpr size_t half_width = bits_per_word<WordType>() / 2;
+    constexpr auto half_mask =
+        static_cast<WordType>((static_cast<WordType>(1U) << half_width) - 1U);
+
+    const auto a_lo = static_cast<WordType>(a & half_mask);
+    const auto a_hi = static_cast<WordType>(a >> half_width);
+    const auto b_lo = static_cast<WordType>(b & half_mask);
+    const auto b_hi = static_cast<WordType>(b >> half_width);
+
+    const auto lo_lo = static_cast<WordType>(a_lo * b_lo);
+    const auto hi_lo = static_cast<WordType>(a_hi * b_lo);
+    const auto lo_hi = static_cast<WordType>(a_lo * b_hi);
+    const auto hi_hi = static_cast<WordType>(a_hi * b_hi);
+
+    const auto cross =
+        static_cast<WordType>((lo_lo >> half_width) + (hi_lo & half_mask) + lo_hi);
+
+    high = static_cast<WordType>(hi_hi + (hi_lo >> half_width) + (cross >> half_width));
+    return static_cast<WordType>((cross << half_width) | (lo_lo & half_mask));
+}
+
+/**
+ * @brief Computes the full product of two words
+ *
+ * If there is a native type twice as wide as the word type, this type is used. Otherwise, the
+ * product is assembled from the four products of the half words.
+ *
+ * @tparam WordType The word type
+ * @param a First factor
+ * @param b Second factor
+ * @param high The most significant word of the product
+ * @return The least significant word of the product
+ */
+template <typename WordType>
+[[nodiscard]] constexpr WordType mul_wide(const WordType a, const WordType b, WordType& high)
+{
+    static_assert(::aarith::is_unsigned_int<WordType>);
+
+    if constexpr (!std::is_void_v<double_word_t<WordType>>)
+    {
+        using D = double_word_t<WordType>;
+        const D product = static_cast<D>(a) * static_cast<D>(b);
+        high = static_cast<WordType>(product >> bits_per_word<WordType>());
+        return static_cast<WordType>(product);
+    }
+    else
+    {
+        return mul_wide_halves(a, b, high);
+    }
+}
+
+/**
+ * @brief Computes a += b * m + carry for one word position and returns the new carry
+ *
+ * The result can never overflow the two words as (2^n-1)^2 + 2(2^n-1) = 2^(2n) - 1.
+ *
+ * @tparam WordType The word type
+ * @param accumulator The word the product is added to
+ * @param b First factor
+ * @param m Second factor
+ * @param carry Incoming carry word
+ * @return The outgoing carry word
+ */
+template <typename WordType>
+constexpr WordType mul_add_word(WordType& accumulator, const WordType b, const WordType m,
+                                const WordType carry)
+{
+    WordType high{0U};
+    WordType low = mul_wide(b, m, high);
+
+    low += accumulator;
+    high += (low < accumulator) ? 1U : 0U;
+    low += carry;
+    high += (low < carry) ? 1U : 0U;
+
+    accumulator = low;
+    return high;
+}
+
+/**
+ * @brief Computes the full product of two word arrays using the schoolbook method
+ *
+ * Each pair of words is multiplied using a single word times word to double word multiplication.
+ *
+ * @note The result array must not overlap with the inputs and must offer room for at least
+ * na + nb words.
+ *
+ * @tparam WordType The word type
+ * @param result The na + nb words the product is stored in
+ * @param a Words of the first factor (least significant word first)
+ * @param na Number of words of the first factor
+ * @param b Words of the second factor (least significant word first)
+ * @param nb Number of words of the second factor
+ */
+template <typename WordType>
+constexpr void mul_words(WordType* result, const WordType* a, const size_t na, const WordType* b,
+                         const size_t nb)
+{
+    for (size_t i = 0; i < na + nb; ++i)
+    {
+        result[i] = WordType{0U};
+    }
+
+    for (size_t j = 0; j < nb; ++j)
+    {
+        const WordType m = b[j];
+        if (m == WordType{0U})
+        {
+            continue;
+        }
+
+        WordType carry{0U};
+        for (size_t i = 0; i < na; ++i)
+        {
+            carry = mul_add_word(result[i + j], a[i], m, carry);
+        }
+        result[j + na] = carry;
+    }
+}
+
+/**
+ * @brief Computes the n least significant words of the product of two word arrays
+ *
+ * Partial products that only contribute to words of index n or higher are never computed.
+ *
+ * @note The result array must not overlap with the inputs.
+ *
+ * @tparam WordType The word type
+ * @param result The n words the truncated product is stored in
+ * @param n Number of words to compute
+ * @param a Words of the first factor (least significant word first), at least n words
+ * @param b Words of the second factor (least significant word first), at least n words
+ */
+template <typename WordType>
+constexpr void mul_words_truncated(WordType* result, const size_t n, const WordType* a,
+                                   const WordType* b)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        result[i] = WordType{0U};
+    }
+
+    for (size_t j = 0; j < n; ++j)
+    {
+        const WordType m = b[j];
+        if (m == WordType{0U})
+        {
+            continue;
+        }
+
+        WordType carry{0U};
+        for (size_t i = 0; i + j < n; ++i)
+        {
+            carry = mul_add_word(result[i + j], a[i], m, carry);
+        }
+    }
+}
+
+/**
+ * @brief Computes the square of a word array
+ *
+ * Every cross product a[i] * a[j] with i < j is computed only once and doubled afterwards by a
+ * shift, so squaring needs roughly half the word multiplications of a general multiplication.
+ *
+ * @note The result array must not overlap with the input and must offer room for 2n words.
+ *
+ * @tparam WordType The word type
+ * @param result The 2n words the square is stored in
+ * @param a Words of the number (least significant word first)
+ * @param n Number of words of the number
+ */
+template <typename WordType>
+constexpr void square_words(WordType* result, const WordType* a, const size_t n)
+{
+    for (size_t i = 0; i < 2 * n; ++i)
+    {
+        result[i] = WordType{0U};
+    }
+
+    // cross products
+    for (size_t i = 0; i + 1 < n; ++i)
+    {
+        const WordType m = a[i];
+        if (m == WordType{0U})
+        {
+            continue;
+        }
+
+        WordType carry{0U};
+        for (size_t j = i + 1; j < n; ++j)
+        {
+            carry = mul_add_word(result[i + j], a[j], m, carry);
+        }
+        result[i + n] = carry;
+    }
+
+    // double the cross products
+    constexpr size_t word_width = bits_per_word<WordType>();
+    WordType shifted_out{0U};
+    for (size_t i = 0; i < 2 * n; ++i)
+    {
+        const WordType w = result[i];
+        result[i] = static_cast<WordType>(w << 1U) | shifted_out;
+        shifted_out = static_cast<WordType>(w >> (word_width - 1U));
+    }
+
+    // add the squares of the single words
+    WordType carry{0U};
+    for (size_t i = 0; i < n; ++i)
+    {
+        WordType high{0U};
+        const WordType low = mul_wide(a[i], a[i], high);
+        result[2 * i] = add_carry(result[2 * i], low, carry, carry);
+        result[2 * i + 1] = add_carry(result[2 * i + 1], high, carry, carry);
+    }
+}
+
+/**
+ * @brief Computes the inverse of an odd word modulo 2^(word width)
+ *
+ * Newton's iteration is used where every step doubles the number of correct bits (starting with
+ * three correct bits as d * d = 1 mod 8 for odd d).
+ *
+ * @tparam WordType The word type
+ * @param d The odd word to invert
+ * @return The word x with d * x = 1 mod 2^(word width)
+ */
+template <typename WordType> [[nodiscard]] constexpr WordType inverse_word(const WordType d)
+{
+    // small word types are computed with 64 bits to prevent the promotion to signed int
+    using U = std::conditional_t<(bits_per_word<WordType>() < 64), uint64_t, WordType>;
+    U inverse = d;
+    for (size_t bits = 3; bits < bits_per_word<WordType>(); bits *= 2)
+    {
+        inverse *= U{2U} - U{d} * inverse;
+    }
+    return static_cast<WordType>(inverse);
+}
+
+/**
+ * @brief Computes the Montgomery reduction t * 2^(-n * word width) mod m of a word array
+ *
+ * @see Çetin Kaya Koç, Tolga Acar, Burton S. Kaliski: Analyzing and Comparing Montgomery
+ * Multiplication Algorithms (separated operand scanning)
+ *
+ * @note The number t has to be smaller than m * 2^(n * word width).
+ *
+ * @tparam WordType The word type
+ * @param result The n words the reduced number (less than m) is stored in
+ * @param t The 2n + 1 words of the number to reduce, the most significant word has to be zero. The
+ * array is used as scratch space.
+ * @param m The words of the odd modulus
+ * @param n The number of words of the modulus
+ * @param m_neg_inverse The word -m^(-1) mod 2^(word width)
+ */
+template <typename WordType>
+constexpr void montgomery_reduce_words(WordType* result, WordType* t, const WordType* m,
+                                       const size_t n, const WordType m_neg_inverse)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        // choose q such that t + q * m * 2^(i * word width) has i + 1 trailing zero words
+        const auto q = static_cast<WordType>(uint64_t{t[i]} * m_neg_inverse);
+        WordType carry{0U};
+        for (size_t j = 0; j < n; ++j)
+        {
+            carry = mul_add_word(t[i + j], m[j], q, carry);
+        }
+        WordType c{0U};
+        t[i + n] = add_carry(t[i + n], carry, WordType{0U}, c);
+        for (size_t k = i + n + 1; c != WordType{0U} && k <= 2 * n; ++k)
+        {
+            t[k] = add_carry(t[k], WordType{0U}, c, c);
+        }
+    }
+
+    // the upper half is less than 2m
+    bool subtract = true;
+    if (t[2 * n] == WordType{0U})
+    {
+        for (size_t i = n; i > 0; --i)
+        {
+            if (t[n + i - 1] != m[i - 1])
+            {
+                subtract = t[n + i - 1] > m[i - 1];
+                break;
+            }
+        }
+    }
+
+    WordType borrow{0U};
+    for (size_t i = 0; i < n; ++i)
+    {
+        result[i] = subtract ? sub_borrow(t[n + i], m[i], borrow, borrow) : t[n + i];
+    }
+}
+
+/**
+ * @brief Counts the leading zeroes of a single word
+ *
+ * @tparam WordType The word type
+ * @param w The word
+ * @return The number of leading zeroes (the word width for w == 0)
+ */
+template <typename WordType> [[nodiscard]] constexpr size_t count_leading_zeroes_word(WordType w)
+{
+    static_assert(::aarith::is_unsigned_int<WordType>);
+
+    constexpr size_t word_width = bits_per_word<WordType>();
+    if (w == WordType{0U})
+    {
+        return word_width;
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr (word_width <= bits_per_word<unsigned int>())
+    {
+        return static_cast<size_t>(__builtin_clz(w)) -
+               (bits_per_word<unsigned int>() - word_width);
+    }
+    else
+    {
+        return static_cast<size_t>(__builtin_clzll(w));
+    }
+#else
+    size_t count = 0;
+    while ((w & (static_cast<WordType>(1U) << (word_width - 1))) == WordType{0U})
+    {
+        w = static_cast<WordType>(w << 1U);
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/**
+ * @brief Counts the trailing zeroes of a single word
+ *
+ * @tparam WordType The word type
+ * @param w The word
+ * @return The number of trailing zeroes (the word width for w == 0)
+ */
+template <typename WordType> [[nodiscard]] constexpr size_t count_trailing_zeroes_word(WordType w)
+{
+    static_assert(::aarith::is_unsigned_int<WordType>);
+
+    constexpr size_t word_width = bits_per_word<WordType>();
+    if (w == WordType{0U})
+    {
+        return word_width;
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr (word_width <= bits_per_word<unsigned int>())
+    {
+        return static_cast<size_t>(__builtin_ctz(w));
+    }
+    else
+    {
+        return static_cast<size_t>(__builtin_ctzll(w));
+    }
+#else
+    size_t count = 0;
+    while ((w & WordType{1U}) == WordType{0U})
+    {
+        w = static_cast<WordType>(w >> 1U);
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/**
+ * @brief Counts the bits set to one in a single word
+ *
+ * @tparam WordType The word type
+ * @param w The word
+ * @return The number of ones in w
+ */
+template <typename WordType> [[nodiscard]] constexpr size_t popcount_word(WordType w)
+{
+    static_assert(::aarith::is_unsigned_int<WordType>);
+
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr (bits_per_word<WordType>() <= bits_per_word<unsigned int>())
+    {
+        return static_cast<size_t>(__builtin_popcount(w));
+    }
+    else
+    {
+        return static_cast<size_t>(__builtin_popcountll(w));
+    }
+#else
+    size_t count = 0;
+    while (w != WordType{0U})
+    {
+        // clear the lowest bit set to one
+        w = static_cast<WordType>(w & (w - 1U));
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/**
+ * @brief Shifts the double word (high, low) to the left and returns its upper word
+ *
+ * Compilers translate this into a single double precision shift (e.g., shld on x86).
+ *
+ * @tparam Offset The number of bits to shift, smaller than the word width
+ * @tparam WordType The word type
+ * @param high The upper word
+ * @param low The lower word
+ * @return The upper word of (high, low) << Offset
+ */
+template <size_t Offset, typename WordType>
+[[nodiscard]] constexpr WordType funnel_shift_left(const WordType high, const WordType low)
+{
+    constexpr size_t word_width = bits_per_word<WordType>();
+    static_assert(Offset < word_width, "The offset has to be smaller than the word width");
+
+    if constexpr (Offset == 0)
+    {
+        return high;
+    }
+    else
+    {
+        return static_cast<WordType>(static_cast<WordType>(high << Offset) |
+                                     static_cast<WordType>(low >> (word_width - Offset)));
+    }
+}
+
+/**
+ * @brief Shifts the double word (high, low) to the right and returns its lower word
+ *
+ * Compilers translate this into a single double precision shift (e.g., shrd on x86).
+ *
+ * @tparam Offset The number of bits to shift, smaller than the word width
+ * @tparam WordType The word type
+ * @param high The upper word
+ * @param low The lower word
+ * @return The lower word of (high, low) >> Offset
+ */
+template <size_t Offset, typename WordType>
+[[nodiscard]] constexpr WordType funnel_shift_right(const WordType high, const WordType low)
+{
+    constexpr size_t word_width = bits_per_word<WordType>();
+    static_assert(Offset < word_width, "The offset has to be smaller than the word width");
+
+    if constexpr (Offset == 0)
+    {
+        return low;
+    }
+    else
+    {
+        return static_cast<WordType>(static_cast<WordType>(low >> Offset) |
+                                     static_cast<WordType>(high << (word_width - Offset)));
+    }
+}
+
+/**
+ * @brief Extracts a word from an arbitrary bit position of an array of words
+ *
+ * The result is combined from the two words containing the requested bits (funnel shift). Bits
+ * beyond the end of the array are read as zeroes.
+ *
+ * @tparam WordType The word type
+ * @param source The words to extract the bits from
+ * @param n The number of words in source
+ * @param offset The index of the least significant bit to extract
+ * @return The word consisting of the bits [offset + word width - 1, offset] of source
+ */
+template <typename WordType>
+[[nodiscard]] constexpr WordType extract_word(const WordType* source, const size_t n,
+                                              const size_t offset)
+{
+    constexpr size_t word_width = bits_per_word<WordType>();
+    const size_t index = offset / word_width;
+    const size_t shift = offset % word_width;
+
+    if (index >= n)
+    {
+        return WordType{0U};
+    }
+
+    auto result = static_cast<WordType>(source[index] >> shift);
+    if (shift != 0 && index + 1 < n)
+    {
+        result |= static_cast<WordType>(source[index + 1] << (word_width - shift));
+    }
+    return result;
+}
+
+/**
+ * @brief Overwrites a range of bits in an array of words with the lowest bits of another array
+ *
+ * Only the words containing the range [offset + count - 1, offset] are modified.
+ *
+ * @tparam WordType The word type
+ * @param destination The words to write the bits into
+ * @param n The number of words in destination
+ * @param source The words containing the bits to insert (at least count bits)
+ * @param offset The index of the least significant bit to overwrite
+ * @param count The number of bits to overwrite
+ */
+template <typename WordType>
+constexpr void insert_bits(WordType* destination, const size_t n, const WordType* source,
+                           const size_t offset, const size_t count)
+{
+    constexpr size_t word_width = bits_per_word<WordType>();
+    constexpr auto ones = static_cast<WordType>(~WordType{0U});
+    const size_t shift = offset % word_width;
+
+    for (size_t j = 0; j * word_width < count; ++j)
+    {
+        const size_t bits = std::min(word_width, count - j * word_width);
+        const auto mask =
+            (bits == word_width) ? ones : static_cast<WordType>((WordType{1U} << bits) - 1U);
+        const auto value = static_cast<WordType>(source[j] & mask);
+        const size_t index = offset / word_width + j;
+
+        if (index < n)
+        {
+            destination[index] = static_cast<WordType>(
+                (destination[index] & ~static_cast<WordType>(mask << shift)) |
+                static_cast<WordType>(value << shift));
+        }
+        // the bits that did not fit into the word at index spill over into the next one
+        if (shift != 0 && bits > word_width - shift && index + 1 < n)
+        {
+            destination[index + 1] = static_cast<WordType>(
+                (destination[index + 1] &
+                 ~static_cast<WordType>(mask >> (word_width - shift))) |
+                static_cast<WordType>(value >> (word_width - shift)));
+        }
+    }
+}
+
+/**
+ * @brief Divides a double word by a single word using half word divisions
+ *
+ * This is the portable fallback for word types that have no native type twice as wide. It follows
+ * the algorithm divlu from Hacker's Delight (Figure 9-3).
+ *
+ * @note The high word has to be strictly smaller than the divisor, i.e. the quotient fits into
+ * a single word
+ *
+ * @tparam WordType The word type
+ * @param high Most significant word of the numerator
+ * @param low Least significant word of the numerator
+ * @param divisor The divisor
+ * @param remainder The remainder of the division
+ * @return The quotient of the division
+ */
+template <typename WordType>
+[[nodiscard]] constexpr WordType div_wide_halves(const WordType high, const WordType low,
+                                                 const WordType divisor, WordType& remainder)
+{
+    static_assert(::aarith::is_unsigned_int<WordType>);
+
+    constexpr size_t word_width = bits_per_word<WordType>();
+    constexpr size_t half_width = word_width / 2;
+    constexpr auto base = static_cast<WordType>(static_cast<WordType>(1U) << half_width);
+    constexpr auto half_mask = static_cast<WordType>(base - 1U);
+
+    // normalize the divisor so that its most significant bit is set
+    const size_t shift = count_leading_zeroes_word(divisor);
+    const auto v = static_cast<WordType>(divisor << shift);
+    const auto vn1 = static_cast<WordType>(v >> half_width);
+    const auto vn0 = static_cast<WordType>(v & half_mask);
+
+    const auto un32 =
+        (shift == 0) ? high
+                     : static_cast<WordType>((high << shift) | (low >> (word_width - shift)));
+    const auto un10 = static_cast<WordType>(low << shift);
+    const auto un1 = static_cast<WordType>(un10 >> half_width);
+    const auto un0 = static_cast<WordType>(un10 & half_mask);
+
+    auto q1 = static_cast<WordType>(un32 / vn1);
+    auto rhat = static_cast<WordType>(un32 - q1 * vn1);
+    while (q1 >= base || static_cast<WordType>(q1 * vn0) > static_cast<WordType>(base * rhat + un1))
+    {
+        --q1;
+        rhat = static_cast<WordType>(rhat + vn1);
+        if (rhat >= base)
+        {
+            break;
+        }
+    }
+
+    const auto un21 = static_cast<WordType>(un32 * base + un1 - q1 * v);
+
+    auto q0 = static_cast<WordType>(un21 / vn1);
+    rhat = static_cast<WordType>(un21 - q0 * vn1);
+    while (q0 >= base || static_cast<WordType>(q0 * vn0) > static_cast<WordType>(base * rhat + un0))
+    {
+        --q0;
+        rhat = static_cast<WordType>(rhat + vn1);
+        if (rhat >= base)
+        {
+            break;
+        }
+    }
+
+    remainder = static_cast<WordType>(static_cast<WordType>(un21 * base + un0 - q0 * v) >> shift);
+    return static_cast<WordType>(q1 * base + q0);
+}
+
+/**
+ * @brief Divides a double word by a single word
+ *
+ * @note The high word has to be strictly smaller than the divisor, i.e. the quotient fits into
+ * a single word
+ *
+ * @tparam WordType The word type
+ * @param high Most significant word of the numerator
+ * @param low Least significant word of the numerator
+ * @param divisor The divisor
+ * @param remainder The remainder of the division
+ * @return The quotient of the division
+ */
+template <typename WordType>
+[[nodiscard]] constexpr WordType div_wide(const WordType high, const WordType low,
+                                          const WordType divisor, WordType& remainder)
+{
+    static_assert(::aarith::is_unsigned_int<WordType>);
+
+    if constexpr (!std::is_void_v<double_word_t<WordType>>)
+    {
+        using D = double_word_t<WordType>;
+        const D numerator = (static_cast<D>(high) << bits_per_word<WordType>()) | low;
+        remainder = static_cast<WordType>(numerator % divisor);
+        return static_cast<WordType>(numerator / divisor);
+    }
+    else
+    {
+        return div_wide_halves(high, low, divisor, remainder);
+    }
+}
+
+/**
+ * @brief Divides a word array by a single word
+ *
+ * This is the fast path of the long division for divisors fitting into a single word: the
+ * quotient is computed word by word starting with the most significant word.
+ *
+ * @note The quotient array may be the same as the numerator array.
+ *
+ * @tparam WordType The word type
+ * @param quotient The n words the quotient is stored in
+ * @param numerator Words of the numerator (least significant word first)
+ * @param n Number of words of the numerator
+ * @param divisor The non-zero divisor
+ * @return The remainder of the division
+ */
+template <typename WordType>
+constexpr WordType divmod_word(WordType* quotient, const WordType* numerator, const size_t n,
+                               const WordType divisor)
+{
+    WordType remainder{0U};
+    for (size_t i = n; i > 0; --i)
+    {
+        quotient[i - 1] = div_wide(remainder, numerator[i - 1], divisor, remainder);
+    }
+    return remainder;
+}
+
+/**
+ * @brief Computes the reciprocal floor((B^2 - 1) / d) - B of a normalized word d (B = 2^(word
+ * width))
+ *
+ * @see Niels Möller, Torbjörn Granlund: Improved division by invariant integers
+ *
+ * @tparam WordType The word type
+ * @param d The divisor, its most significant bit has to be set
+ * @return The reciprocal of d
+ */
+template <typename WordType> [[nodiscard]] constexpr WordType reciprocal_word(const WordType d)
+{
+    // B^2 - 1 - B * d = (B - 1 - d) * B + (B - 1)
+    WordType remainder{0U};
+    return div_wide(static_cast<WordType>(~d), static_cast<WordType>(~WordType{0U}), d, remainder);
+}
+
+/**
+ * @brief Divides a double word by a normalized single word using its precomputed reciprocal
+ *
+ * The quotient is computed with two multiplications and at most two corrections instead of a
+ * hardware division.
+ *
+ * @see Niels Möller, Torbjörn Granlund: Improved division by invariant integers, Algorithm 4
+ *
+ * @note The high word has to be strictly smaller than the divisor
+ *
+ * @tparam WordType The word type
+ * @param high Most significant word of the numerator
+ * @param low Least significant word of the numerator
+ * @param d The divisor, its most significant bit has to be set
+ * @param reciprocal The reciprocal of the divisor (see reciprocal_word)
+ * @param remainder The remainder of the division
+ * @return The quotient of the division
+ */
+template <typename WordType>
+[[nodiscard]] constexpr WordType div_wide_preinv(const WordType high, const WordType low,
+                                                 const WordType d, const WordType reciprocal,
+                                                 WordType& remainder)
+{
+    WordType q1{0U};
+    WordType q0 = mul_wide(reciprocal, high, q1);
+    WordType carry{0U};
+    q0 = add_carry(q0, low, WordType{0U}, carry);
+    q1 = add_carry(q1, high, carry, carry);
+    q1 = static_cast<WordType>(q1 + 1U);
+
+    WordType q1_d_high{0U};
+    WordType r = static_cast<WordType>(low - mul_wide(q1, d, q1_d_high));
+    if (r > q0)
+    {
+        q1 = static_cast<WordType>(q1 - 1U);
+        r = static_cast<WordType>(r + d);
+    }
+    if (r >= d)
+    {
+        q1 = static_cast<WordType>(q1 + 1U);
+        r = static_cast<WordType>(r - d);
+    }
+    remainder = r;
+    return q1;
+}
+
+/**
+ * @brief Divides a word array by a single word using its precomputed reciprocal
+ *
+ * @note The quotient array may be the same as the numerator array.
+ *
+ * @tparam WordType The word type
+ * @param quotient The n words the quotient is stored in
+ * @param numerator Words of the numerator (least significant word first)
+ * @param n Number of words of the numerator
+ * @param d The divisor shifted to the left such that its most significant bit is set
+ * @param shift The number of bits the divisor has been shifted
+ * @param reciprocal The reciprocal of the shifted divisor (see reciprocal_word)
+ * @return The remainder of the division
+ */
+template <typename WordType>
+constexpr WordType divmod_word_preinv(WordType* quotient, const WordType* numerator,
+                                      const size_t n, const WordType d, const size_t shift,
+                                      const WordType reciprocal)
+{
+    constexpr size_t word_width = bits_per_word<WordType>();
+
+    // the numerator is shifted by the same amount as the divisor while it is being processed
+    WordType remainder =
+        (shift == 0 || n == 0) ? WordType{0U}
+                               : static_cast<WordType>(numerator[n - 1] >> (word_width - shift));
+    for (size_t i = n; i > 0; --i)
+    {
+        WordType word = numerator[i - 1];
+        if (shift > 0)
+        {
+            word = static_cast<WordType>(word << shift);
+            if (i > 1)
+            {
+                word |= static_cast<WordType>(numerator[i - 2] >> (word_width - shift));
+            }
+        }
+        quotient[i - 1] = div_wide_preinv(remainder, word, d, reciprocal, remainder);
+    }
+    return static_cast<WordType>(remainder >> shift);
+}
+
+/**
+ * @brief Divides two word arrays using Knuth's Algorithm D
+ *
+ * The divisor is normalized such that its most significant bit is set. Each quotient word is then
+ * estimated by dividing the two most significant words of the current remainder by the most
+ * significant word of the divisor. The estimate is at most two too large and is corrected before
+ * and after multiplying the divisor with it.
+ *
+ * @see Donald E. Knuth: The Art of Computer Programming, Volume 2, Section 4.3.1
+ *
+ * @note The most significant word of the divisor has to be non-zero and n <= m has to hold.
+ *
+ * @tparam WordType The word type
+ * @param quotient The m - n + 1 words the quotient is stored in
+ * @param remainder The n words the remainder is stored in
+ * @param u Words of the numerator (least significant word first)
+ * @param m Number of words of the numerator
+ * @param v Words of the divisor (least significant word first)
+ * @param n Number of words of the divisor, has to be at least two
+ * @param un Scratch space for m + 1 words holding the normalized numerator
+ * @param vn Scratch space for n words holding the normalized divisor
+ * @param v_top_reciprocal The reciprocal (see reciprocal_word) of the most significant word of
+ * the normalized divisor or zero if the quotient words are to be estimated using divisions
+ */
+template <typename WordType>
+constexpr void divmod_words(WordType* quotient, WordType* remainder, const WordType* u,
+                            const size_t m, const WordType* v, const size_t n, WordType* un,
+                            WordType* vn, const WordType v_top_reciprocal = WordType{0U})
+{
+    constexpr size_t word_width = bits_per_word<WordType>();
+
+    // D1: normalize
+    const size_t shift = count_leading_zeroes_word(v[n - 1]);
+    if (shift == 0)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            vn[i] = v[i];
+        }
+        for (size_t i = 0; i < m; ++i)
+        {
+            un[i] = u[i];
+        }
+        un[m] = WordType{0U};
+    }
+    else
+    {
+        for (size_t i = n - 1; i > 0; --i)
+        {
+            vn[i] = static_cast<WordType>((v[i] << shift) | (v[i - 1] >> (word_width - shift)));
+        }
+        vn[0] = static_cast<WordType>(v[0] << shift);
+
+        un[m] = static_cast<WordType>(u[m - 1] >> (word_width - shift));
+        for (size_t i = m - 1; i > 0; --i)
+        {
+            un[i] = static_cast<WordType>((u[i] << shift) | (u[i - 1] >> (word_width - shift)));
+        }
+        un[0] = static_cast<WordType>(u[0] << shift);
+    }
+
+    const WordType v_top = vn[n - 1];
+    const WordType v_second = vn[n - 2];
+
+    // D2 to D7: compute one quotient word per iteration
+    for (size_t j = m - n + 1; j > 0; --j)
+    {
+        const size_t k = j - 1;
+
+        // D3: estimate the quotient word
+        WordType qhat{0U};
+        WordType rhat{0U};
+        bool rhat_overflow = false;
+        if (un[k + n] >= v_top)
+        {
+            qhat = static_cast<WordType>(~WordType{0U});
+            rhat = static_cast<WordType>(un[k + n - 1] + v_top);
+            rhat_overflow = rhat < v_top;
+        }
+        else
+        {
+            qhat = (v_top_reciprocal != WordType{0U})
+                       ? div_wide_preinv(un[k + n], un[k + n - 1], v_top, v_top_reciprocal, rhat)
+                       : div_wide(un[k + n], un[k + n - 1], v_top, rhat);
+        }
+
+        while (!rhat_overflow)
+        {
+            WordType p_high{0U};
+            const WordType p_low = mul_wide(qhat, v_second, p_high);
+            if (p_high < rhat || (p_high == rhat && p_low <= un[k + n - 2]))
+            {
+                break;
+            }
+            --qhat;
+            rhat = static_cast<WordType>(rhat + v_top);
+            rhat_overflow = rhat < v_top;
+        }
+
+        // D4: multiply and subtract
+        WordType carry{0U};
+        WordType borrow{0U};
+        for (size_t i = 0; i < n; ++i)
+        {
+            WordType p_high{0U};
+            auto p_low = mul_wide(qhat, vn[i], p_high);
+            p_low = static_cast<WordType>(p_low + carry);
+            carry = static_cast<WordType>(p_high + ((p_low < carry) ? 1U : 0U));
+
+            const WordType t = un[i + k];
+            const auto diff = static_cast<WordType>(t - p_low);
+            const auto diff_borrowed = static_cast<WordType>(diff - borrow);
+            borrow = static_cast<WordType>(((t < p_low) ? 1U : 0U) + ((diff < borrow) ? 1U : 0U));
+            un[i + k] = diff_borrowed;
+        }
+        const WordType t = un[k + n];
+        const auto diff = static_cast<WordType>(t - carry);
+        un[k + n] = static_cast<WordType>(diff - borrow);
+        const bool negative = (t < carry) || (diff < borrow);
+
+        // D5/D6: the estimate was one too large, add back
+        if (negative)
+        {
+            --qhat;
+            WordType add_carry{0U};
+            for (size_t i = 0; i < n; ++i)
+            {
+                const auto sum = static_cast<WordType>(un[i + k] + vn[i]);
+                const auto sum_carried = static_cast<WordType>(sum + add_carry);
+                add_carry = static_cast<WordType>(((sum < vn[i]) ? 1U : 0U) +
+                                                  ((sum_carried < sum) ? 1U : 0U));
+                un[i + k] = sum_carried;
+            }
+            un[k + n] = static_cast<WordType>(un[k + n] + add_carry);
+        }
+
+        quotient[k] = qhat;
+    }
+
+    // D8: unnormalize the remainder
+    if (shift == 0)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            remainder[i] = un[i];
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            remainder[i] =
+                static_cast<WordType>((un[i] >> shift) | (un[i + 1] << (word_width - shift)));
+        }
+    }
+}
+
+/**
+ * @brief The largest bit width that can be stored in a native unsigned integer
+ */
+#if defined(__SIZEOF_INT128__)
+constexpr size_t max_native_width = 128U;
+#else
+constexpr size_t max_native_width = 64U;
+#endif
+
+/**
+ * @brief Type trait yielding the smallest native unsigned integer type (of at least 64 bits) that
+ * can store the given number of bits
+ *
+ * The type member is void if there is no such type.
+ *
+ * @tparam Width The number of bits to store
+ */
+template <size_t Width, typename = void> struct native_uint
+{
+    using type = void;
+};
+
+template <size_t Width> struct native_uint<Width, std::enable_if_t<(Width <= 64U)>>
+{
+    using type = uint64_t;
+};
+
+#if defined(__SIZEOF_INT128__)
+template <size_t Width> struct native_uint<Width, std::enable_if_t<(64U < Width && Width <= 128U)>>
+{
+    using type = uint128_t;
+};
+#endif
+
+/**
+ * @brief Helper for the `native_uint` type trait
+ * @tparam Width The number of bits to store
+ */
+template <size_t Width> using native_uint_t = typename native_uint<Width>::type;
+
+/**
+ * @brief Type trait yielding the signed counterpart of a native unsigned integer type
+ *
+ * In contrast to std::make_signed, this also works for 128 bit integers in strict standard mode.
+ *
+ * @tparam N The native unsigned integer type
+ */
+template <typename N> struct native_signed
+{
+    using type = std::make_signed_t<N>;
+};
+
+#if defined(__SIZEOF_INT128__)
+template <> struct native_signed<uint128_t>
+{
+    using type = int128_t;
+};
+#endif
+
+/**
+ * @brief Helper for the `native_signed` type trait
+ * @tparam N The native unsigned integer type
+ */
+template <typename N> using native_signed_t = typename native_signed<N>::type;
+
+/**
+ * @brief Checks whether a word_array like type fits into a native unsigned integer
+ * @tparam W The word_array like type
+ */
+template <typename W> constexpr bool has_native_width = (W::width() <= max_native_width);
+
+/**
+ * @brief Assembles the words of a word_array like container into a native unsigned integer
+ *
+ * @tparam W The word_array like type, has to satisfy has_native_width
+ * @param w The container to convert
+ * @return The bits of w, zero extended
+ */
+template <typename W>
+[[nodiscard]] constexpr auto to_native(const W& w) -> native_uint_t<W::width()>
+{
+    static_assert(has_native_width<W>);
+
+    using N = native_uint_t<W::width()>;
+
+    N value{w.word(0)};
+    for (size_t i = 1; i < W::word_count(); ++i)
+    {
+        value |= static_cast<N>(w.word(i)) << (i * W::word_width());
+    }
+    return value;
+}
+
+/**
+ * @brief Replicates the most significant bit of a value of the given width into the upper bits
+ * of a native unsigned integer
+ *
+ * @tparam Width The width of the value
+ * @tparam N The native unsigned integer type
+ * @param value The value to sign extend
+ * @return The sign extended value
+ */
+template <size_t Width, typename N> [[nodiscard]] constexpr N sign_extend_native(const N value)
+{
+    constexpr size_t native_width = sizeof(N) * CHAR_BIT;
+    if constexpr (Width >= native_width)
+    {
+        return value;
+    }
+    else
+    {
+        constexpr N msb = static_cast<N>(1U) << (Width - 1);
+        constexpr N upper = static_cast<N>(~N{0U}) << Width;
+        return ((value & msb) != N{0U}) ? static_cast<N>(value | upper) : value;
+    }
+}
+
+/**
+ * @brief Splits a native unsigned integer into the words of a word_array like container
+ *
+ * Bits exceeding the width of the container are discarded.
+ *
+ * @tparam W The word_array like type
+ * @tparam N The native unsigned integer type
+ * @param value The value to convert
+ * @return The container storing the least significant bits of value
+ */
+template <typename W, typename N> [[nodiscard]] constexpr W from_native(const N value)
+{
+    using word_type = typename W::word_type;
+
+    W result;
+    for (size_t i = 0; i < W::word_count(); ++i)
+    {
+        result.set_word(i, static_cast<word_type>(value >> (i * W::word_width())));
+    }
+    return result;
+}
+
+/**
+ * @brief Copies the words of a word_array like container into a plain array
+ *
+ * The array can then be handed to the functions operating on plain word arrays.
+ *
+ * @tparam W The word_array like type
+ * @param w The container whose words are copied
+ * @return Array containing the words of w (least significant word first)
+ */
+template <typename W>
+[[nodiscard]] constexpr auto copy_words(const W& w)
+    -> word_storage_t<typename W::word_type, W::word_count()>
+{
+    word_storage_t<typename W::word_type, W::word_count()> words{};
+    for (size_t i = 0; i < W::word_count(); ++i)
+    {
+        words[i] = w.word(i);
+    }
+    return words;
+}
+
+} // namespace implementation
+
+} // namespace aarith
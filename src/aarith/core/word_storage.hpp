@@ -0,0 +1,358 @@
+#pragma once
+
+#include <aarith/core/traits.hpp>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// std::pmr is missing in libstdc++ before GCC 9 and in libc++ before LLVM 16
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#if defined(__cpp_lib_memory_resource)
+#define AARITH_HAS_MEMORY_RESOURCE
+#endif
+#endif
+
+/**
+ * @brief Minimal bit width (exclusive) of word containers that store their words on the heap
+ *
+ * The value can be overwritten by defining the macro before including aarith.
+ */
+#ifndef AARITH_HEAP_STORAGE_THRESHOLD
+#define AARITH_HEAP_STORAGE_THRESHOLD 65536
+#endif
+
+namespace aarith {
+
+/**
+ * @brief Word containers of more than this number of bits store their words on the heap
+ *
+ * Smaller containers store their words inline. Storing large containers on the heap keeps them from
+ * overflowing the stack (e.g. of worker threads) and makes moving them cheap.
+ */
+inline constexpr size_t heap_storage_threshold = AARITH_HEAP_STORAGE_THRESHOLD;
+
+#if defined(AARITH_HAS_MEMORY_RESOURCE)
+
+namespace implementation {
+
+[[nodiscard]] inline std::pmr::memory_resource*& current_word_resource() noexcept
+{
+    thread_local std::pmr::memory_resource* resource = std::pmr::new_delete_resource();
+    return resource;
+}
+
+} // namespace implementation
+
+/**
+ * @brief Returns the memory resource the words of large containers are allocated from
+ *
+ * The resource is set per thread and defaults to std::pmr::new_delete_resource(). The memory
+ * resources are only available if the standard library provides std::pmr (indicated by
+ * AARITH_HAS_MEMORY_RESOURCE), otherwise the words are allocated using std::allocator.
+ */
+[[nodiscard]] inline std::pmr::memory_resource* word_memory_resource() noexcept
+{
+    return implementation::current_word_resource();
+}
+
+/**
+ * @brief Sets the memory resource the words of large containers are allocated from
+ *
+ * The setting only affects the calling thread, e.g. every worker thread can use its own arena
+ * (like a std::pmr::monotonic_buffer_resource). Every container remembers the resource its words
+ * were allocated from, so the resource has to outlive all containers allocated from it.
+ *
+ * @param resource The new memory resource, nullptr restores the default
+ * @return The previously used memory resource
+ */
+inline std::pmr::memory_resource*
+set_word_memory_resource(std::pmr::memory_resource* resource) noexcept
+{
+    std::pmr::memory_resource* previous = implementation::current_word_resource();
+    implementation::current_word_resource() =
+        (resource == nullptr) ? std::pmr::new_delete_resource() : resource;
+    return previous;
+}
+
+namespace implementation {
+
+using word_resource_t = std::pmr::memory_resource*;
+
+[[nodiscard]] inline word_resource_t default_word_resource() noexcept
+{
+    return word_memory_resource();
+}
+
+template <typename WordType>
+[[nodiscard]] WordType* allocate_words(const word_resource_t from, const size_t n)
+{
+    return static_cast<WordType*>(from->allocate(n * sizeof(WordType), alignof(WordType)));
+}
+
+template <typename WordType>
+void deallocate_words(const word_resource_t from, WordType* words, const size_t n) noexcept
+{
+    from->deallocate(words, n * sizeof(WordType), alignof(WordType));
+}
+
+} // namespace implementation
+
+#else
+
+namespace implementation {
+
+/**
+ * @brief Stands in for the memory resource if std::pmr is not available: the words are allocated
+ * using std::allocator
+ */
+struct allocator_word_resource
+{
+};
+
+using word_resource_t = allocator_word_resource;
+
+[[nodiscard]] inline word_resource_t default_word_resource() noexcept
+{
+    return {};
+}
+
+template <typename WordType>
+[[nodiscard]] WordType* allocate_words(const word_resource_t /* from */, const size_t n)
+{
+    return std::allocator<WordType>{}.allocate(n);
+}
+
+template <typename WordType>
+void deallocate_words(const word_resource_t /* from */, WordType* words, const size_t n) noexcept
+{
+    std::allocator<WordType>{}.deallocate(words, n);
+}
+
+} // namespace implementation
+
+#endif
+
+namespace implementation {
+
+/**
+ * @brief A fixed number of words allocated from the current word memory resource (or using
+ * std::allocator if std::pmr is not available)
+ *
+ * The interface is the part of std::array used by aarith. Copies allocate and copy the words,
+ * moves only take over the pointer. A moved-from object owns no words, they are allocated again
+ * (as zeroes) as soon as the object is accessed. Accessing a moved-from object is therefore a
+ * modification, even through the const member functions.
+ *
+ * @tparam WordType The type of the words
+ * @tparam N The number of words
+ */
+template <typename WordType, size_t N> class heap_words
+{
+public:
+    using value_type = WordType;
+    using iterator = WordType*;
+    using const_iterator = const WordType*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    heap_words()
+        : resource(default_word_resource())
+        , words(allocate_words<WordType>(resource, N))
+    {
+        std::fill_n(words, N, WordType{0U});
+    }
+
+    heap_words(const heap_words& other)
+        : resource(default_word_resource())
+        , words(allocate_words<WordType>(resource, N))
+    {
+        std::copy_n(other.data(), N, words);
+    }
+
+    heap_words(heap_words&& other) noexcept
+        : resource(other.resource)
+        , words(other.words)
+    {
+        other.words = nullptr;
+    }
+
+    heap_words& operator=(const heap_words& other)
+    {
+        if (this != &other)
+        {
+            std::copy_n(other.data(), N, data());
+        }
+        return *this;
+    }
+
+    heap_words& operator=(heap_words&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            resource = other.resource;
+            words = std::exchange(other.words, nullptr);
+        }
+        return *this;
+    }
+
+    ~heap_words()
+    {
+        release();
+    }
+
+    [[nodiscard]] WordType* data()
+    {
+        return allocated();
+    }
+
+    [[nodiscard]] const WordType* data() const
+    {
+        return allocated();
+    }
+
+    [[nodiscard]] WordType& operator[](size_t pos)
+    {
+        return data()[pos];
+    }
+
+    [[nodiscard]] const WordType& operator[](size_t pos) const
+    {
+        return data()[pos];
+    }
+
+    [[nodiscard]] const WordType& at(size_t pos) const
+    {
+        if (pos >= N)
+        {
+            throw std::out_of_range("word index out of range");
+        }
+        return data()[pos];
+    }
+
+    [[nodiscard]] const WordType& front() const
+    {
+        return data()[0];
+    }
+
+    [[nodiscard]] const WordType& back() const
+    {
+        return data()[N - 1];
+    }
+
+    [[nodiscard]] static constexpr size_t size() noexcept
+    {
+        return N;
+    }
+
+    void fill(const WordType& value)
+    {
+        std::fill_n(data(), N, value);
+    }
+
+    [[nodiscard]] iterator begin()
+    {
+        return data();
+    }
+
+    [[nodiscard]] iterator end()
+    {
+        return data() + N;
+    }
+
+    [[nodiscard]] const_iterator begin() const
+    {
+        return data();
+    }
+
+    [[nodiscard]] const_iterator end() const
+    {
+        return data() + N;
+    }
+
+    [[nodiscard]] const_iterator cbegin() const
+    {
+        return data();
+    }
+
+    [[nodiscard]] const_iterator cend() const
+    {
+        return data() + N;
+    }
+
+    [[nodiscard]] const_reverse_iterator rbegin() const
+    {
+        return const_reverse_iterator{end()};
+    }
+
+    [[nodiscard]] const_reverse_iterator rend() const
+    {
+        return const_reverse_iterator{begin()};
+    }
+
+    [[nodiscard]] const_reverse_iterator crbegin() const
+    {
+        return rbegin();
+    }
+
+    [[nodiscard]] const_reverse_iterator crend() const
+    {
+        return rend();
+    }
+
+private:
+    // allocates the words of a moved-from object again
+    WordType* allocated() const
+    {
+        if (words == nullptr)
+        {
+            resource = default_word_resource();
+            words = allocate_words<WordType>(resource, N);
+            std::fill_n(words, N, WordType{0U});
+        }
+        return words;
+    }
+
+    void release() noexcept
+    {
+        if (words != nullptr)
+        {
+            deallocate_words(resource, words, N);
+            words = nullptr;
+        }
+    }
+
+    mutable word_resource_t resource;
+    mutable WordType* words;
+};
+
+/**
+ * @brief Storage for N words: inline for small numbers of words, on the heap for large ones
+ *
+ * Besides the containers themselves, the algorithms use this storage for their temporary word
+ * arrays, so that computations with huge numbers do not overflow the stack.
+ */
+template <typename WordType, size_t N>
+using word_storage_t =
+    std::conditional_t<(N * sizeof(WordType) * CHAR_BIT > heap_storage_threshold),
+                       heap_words<WordType, N>, std::array<WordType, N>>;
+
+/**
+ * @brief Whether N words of the given type are stored on the heap
+ */
+template <typename WordType, size_t N>
+inline constexpr bool is_heap_storage_v =
+    std::is_same_v<word_storage_t<WordType, N>, heap_words<WordType, N>>;
+
+} // namespace implementation
+
+} // namespace aarith
@@ -202,6 +202,35 @@ template <size_t E, size_t M>
     return normalize<E, rdmquotient.width() - 1, M>(quotient);
 }
 
+/**
+ * @brief Anytime square root of floating_points
+ *
+ * The digit recurrence of sqrt computes one bit of the mantissa per step. It is stopped after the
+ * given number of bits, the remaining bits of the mantissa are zero (i.e. the exact square root is
+ * truncated). Special values are treated like sqrt does.
+ *
+ * @param x The radicand
+ * @param bits The number of most-significant bits that are calculated of the mantissa
+ * @tparam E Width of exponent
+ * @tparam M Width of mantissa
+ *
+ * @return The square root of x
+ *
+ */
+template <size_t E, size_t M>
+[[nodiscard]] auto anytime_sqrt(const floating_point<E, M> x, const unsigned int bits = M + 1)
+    -> floating_point<E, M>
+{
+    if (x.is_nan() || x.is_zero() || x.is_negative() || x.is_inf())
+    {
+        return sqrt(x);
+    }
+
+    const auto [root, quantum] =
+        implementation::sqrt_significand(x, std::min<size_t>(bits, M + 1));
+    return implementation::round_to_nearest_even<E, M>(false, root, quantum);
+}
+
 /**
  * @brief Addition of two floating_points using the FAU adder: lhs+rhs
  *
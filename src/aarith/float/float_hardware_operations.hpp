@@ -0,0 +1,539 @@
+#pragma once
+
+#include <aarith/core/bit_cast.hpp>
+#include <aarith/float/float_native_operations.hpp>
+#include <aarith/float/float_utils.hpp>
+#include <aarith/float/floating_point.hpp>
+
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+/**
+ * @brief Whether add, sub, mul and div of floating_point use the floating-point unit of the host
+ *
+ * - 0: never (the default)
+ * - 1: for the formats matching a native type bit for bit, i.e. single_precision (float),
+ *   double_precision (double), quadruple_precision (__float128) and extended_precision (the 80 bit
+ *   long double of x87)
+ * - 2: additionally for all formats that can be computed using double without double rounding
+ *
+ * The floating-point unit rounds correctly (to nearest, ties to even) and does not reproduce the
+ * rounding of the software implementation. The value can be overwritten by defining the macro
+ * before including aarith.
+ */
+#ifndef AARITH_FLOAT_HARDWARE_ARITHMETIC
+#define AARITH_FLOAT_HARDWARE_ARITHMETIC 0
+#endif
+
+namespace aarith {
+
+namespace implementation {
+
+#if defined(__SIZEOF_FLOAT128__) && defined(__SIZEOF_INT128__)
+__extension__ typedef __float128 float128_t; // NOLINT
+inline constexpr bool has_float128 = true;
+
+/**
+ * @brief Converts quadruple_precision to __float128 (bit for bit)
+ */
+[[nodiscard]] inline float128_t to_float128(const quadruple_precision& x)
+{
+    const auto& mantissa = x.get_full_mantissa();
+    const uint128_t sign = static_cast<uint128_t>(x.get_sign()) << 127U;
+    const uint128_t exponent = static_cast<uint128_t>(x.get_exponent().word(0)) << 112U;
+    const uint128_t fraction =
+        (static_cast<uint128_t>(mantissa.word(1) & native_mask<uint64_t>(48)) << 64U) |
+        mantissa.word(0);
+    return bit_cast<float128_t>(sign | exponent | fraction);
+}
+
+/**
+ * @brief Converts __float128 to quadruple_precision (bit for bit, all NaNs become
+ * quadruple_precision::NaN())
+ */
+[[nodiscard]] inline quadruple_precision from_float128(const float128_t value)
+{
+    const auto bits = bit_cast<uint128_t>(value);
+    const bool sign = (bits >> 127U) != 0U;
+    const uint64_t exponent = static_cast<uint64_t>(bits >> 112U) & native_mask<uint64_t>(15);
+    const auto low = static_cast<uint64_t>(bits);
+    uint64_t high = static_cast<uint64_t>(bits >> 64U) & native_mask<uint64_t>(48);
+
+    if (exponent == native_mask<uint64_t>(15))
+    {
+        return ((high | low) != 0U) ? quadruple_precision::NaN()
+                                    : quadruple_precision(sign, uinteger<15>{exponent},
+                                                          uinteger<113>{});
+    }
+    if (exponent != 0U)
+    {
+        high |= uint64_t{1U} << 48U;
+    }
+    return quadruple_precision(sign, uinteger<15>{exponent}, uinteger<113>{high, low});
+}
+#else
+using float128_t = void;
+inline constexpr bool has_float128 = false;
+#endif
+
+/**
+ * @brief Whether long double is the 80 bit extended precision format of x87, which stores the
+ * integer bit of the mantissa explicitly
+ */
+#if defined(__x86_64__) && defined(__SIZEOF_INT128__) && (LDBL_MANT_DIG == 64) &&                 \
+    (LDBL_MAX_EXP == 16384)
+inline constexpr bool is_x87_long_double = true;
+
+/**
+ * @brief Converts extended_precision to the long double of x87 (bit for bit)
+ */
+[[nodiscard]] inline long double to_x87_long_double(const extended_precision& x)
+{
+    // x87 expects the integer bit to be set for all normal numbers and infinities
+    const uint64_t exponent = x.get_exponent().word(0);
+    uint64_t mantissa = x.get_full_mantissa().word(0) & native_mask<uint64_t>(63);
+    if (exponent != 0U)
+    {
+        mantissa |= uint64_t{1U} << 63U;
+    }
+    const uint64_t sign_exponent = (uint64_t{x.get_sign()} << 15U) | exponent;
+
+    // the number is moved in a single store, as loading it from several stores stalls
+    const uint128_t bits = (static_cast<uint128_t>(sign_exponent) << 64U) | mantissa;
+    long double result; // NOLINT
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+/**
+ * @brief Converts the long double of x87 to extended_precision (bit for bit, all NaNs become
+ * extended_precision::NaN())
+ */
+[[nodiscard]] inline extended_precision from_x87_long_double(const long double value)
+{
+    uint128_t bits; // NOLINT
+    std::memcpy(&bits, &value, sizeof(value));
+    const auto mantissa = static_cast<uint64_t>(bits);
+    const auto sign_exponent = static_cast<uint64_t>(bits >> 64U);
+
+    const bool sign = ((sign_exponent >> 15U) & 1U) != 0U;
+    const uint64_t exponent = sign_exponent & native_mask<uint64_t>(15);
+    if (exponent == native_mask<uint64_t>(15))
+    {
+        return ((mantissa & native_mask<uint64_t>(63)) != 0U)
+                   ? extended_precision::NaN()
+                   : make_native_float<15, 63>(sign, exponent, 0U);
+    }
+    return make_native_float<15, 63>(sign, exponent, mantissa);
+}
+#else
+inline constexpr bool is_x87_long_double = false;
+#endif
+
+/**
+ * @brief Whether floating_point<E, M> has the same bit representation as the native type F
+ */
+template <size_t E, size_t M, typename F>
+inline constexpr bool is_native_float_format =
+    std::numeric_limits<F>::is_iec559 && (E == get_exponent_width<F>()) &&
+    (M == get_mantissa_width<F>());
+
+/**
+ * @brief The native type the floating-point unit computes floating_point<E, M> in
+ *
+ * Besides the formats matching float and double exactly, every format with a precision of at most
+ * 25 bits and an exponent of at most 9 bits is computed in double: the sums, differences, products
+ * and quotients of such numbers never leave the range of normal doubles and, as the precision of
+ * double is at least twice the precision of the format plus two, rounding the result of double to
+ * the format yields the correctly rounded result (there is no double rounding). The type is void
+ * for all other formats and if float and double are not evaluated in their own precision.
+ *
+ * quadruple_precision is computed using __float128 and extended_precision using the long double of
+ * x87, if available.
+ */
+template <size_t E, size_t M>
+using float_hardware_t = std::conditional_t<
+    has_float128 && (E == 15) && (M == 112), float128_t,
+    std::conditional_t<
+        is_x87_long_double && (E == 15) && (M == 63), long double,
+        std::conditional_t<
+            (FLT_EVAL_METHOD != 0), void,
+            std::conditional_t<
+                is_native_float_format<E, M, float>, float,
+                std::conditional_t<is_native_float_format<E, M, double> ||
+                                       (std::numeric_limits<double>::is_iec559 && (2 <= E) &&
+                                        (E <= 9) && (M <= 24)),
+                                   double, void>>>>>;
+
+/**
+ * @brief Whether the floating-point unit can compute the arithmetic operations of
+ * floating_point<E, M>
+ */
+template <size_t E, size_t M>
+inline constexpr bool float_hardware_kernels = !std::is_void_v<float_hardware_t<E, M>>;
+
+/**
+ * @brief Whether floating_point<E, M> is computed using a native type with the same bit
+ * representation (instead of a wider one)
+ */
+template <size_t E, size_t M>
+inline constexpr bool float_hardware_exact =
+    float_hardware_kernels<E, M> &&
+    (is_native_float_format<E, M, float> || is_native_float_format<E, M, double> ||
+     std::is_same_v<float_hardware_t<E, M>, float128_t> ||
+     std::is_same_v<float_hardware_t<E, M>, long double>);
+
+/**
+ * @brief Whether add, sub, mul and div of floating_point<E, M, WordType> use the floating-point
+ * unit (see AARITH_FLOAT_HARDWARE_ARITHMETIC)
+ */
+template <size_t E, size_t M, typename WordType = uint64_t>
+inline constexpr bool float_hardware_dispatch =
+    std::is_same_v<WordType, uint64_t> && float_hardware_kernels<E, M> &&
+    ((AARITH_FLOAT_HARDWARE_ARITHMETIC >= 2) ||
+     ((AARITH_FLOAT_HARDWARE_ARITHMETIC == 1) && float_hardware_exact<E, M>));
+
+/**
+ * @brief Whether the fused multiply-add of the native type can compute fma of floating_point<E, M>
+ *
+ * Rounding the fused result of a wider type again is not correctly rounded, so only the formats
+ * matching a native type bit for bit qualify (except for __float128, which has no fused
+ * multiply-add in the standard library).
+ */
+template <size_t E, size_t M>
+inline constexpr bool float_hardware_fma =
+    float_hardware_exact<E, M> && !std::is_same_v<float_hardware_t<E, M>, float128_t>;
+
+/**
+ * @brief Whether sqrt of floating_point<E, M> can be computed using the floating-point unit
+ *
+ * The square root of the narrow formats is computed in double and rounded a second time, which
+ * is correct as double has more than twice as many bits as the mantissae. __float128 has no square
+ * root in the standard library.
+ */
+template <size_t E, size_t M>
+inline constexpr bool float_hardware_sqrt =
+    float_hardware_kernels<E, M> && !std::is_same_v<float_hardware_t<E, M>, float128_t>;
+
+/**
+ * @brief Converts a number that is not NaN to float or double (exactly)
+ */
+template <size_t E, size_t M>
+[[nodiscard]] float_hardware_t<E, M> to_float_or_double(const floating_point<E, M>& x)
+{
+    using H = float_hardware_t<E, M>;
+    using Bits = typename float_extraction_helper::bit_cast_to_type_trait<H>::type;
+    constexpr size_t HE = get_exponent_width<H>();
+    constexpr size_t HM = get_mantissa_width<H>();
+
+    const auto sign = static_cast<Bits>(x.get_sign()) << (HE + HM);
+    const uint64_t exponent = x.get_exponent().word(0);
+    const uint64_t mantissa = x.get_full_mantissa().word(0);
+
+    if constexpr (E == HE && M == HM)
+    {
+        const uint64_t fraction = mantissa & native_mask<uint64_t>(HM);
+        return bit_cast<H>(static_cast<Bits>(sign | (exponent << HM) | fraction));
+    }
+    else
+    {
+        if (exponent == native_mask<uint64_t>(E))
+        {
+            return bit_cast<H>(static_cast<Bits>(sign | (native_mask<uint64_t>(HE) << HM)));
+        }
+
+        // the mantissa is converted exactly and scaled by a power of two (which is a normal double)
+        constexpr uint64_t bias = native_mask<uint64_t>(E - 1);
+        constexpr uint64_t native_bias = native_mask<uint64_t>(HE - 1);
+        const uint64_t scale_exponent = ((exponent == 0U) ? 1U : exponent) + native_bias - bias - M;
+        const H magnitude =
+            static_cast<H>(mantissa) * bit_cast<H>(static_cast<Bits>(scale_exponent << HM));
+        return bit_cast<H>(static_cast<Bits>(sign | bit_cast<Bits>(magnitude)));
+    }
+}
+
+/**
+ * @brief Rounds float or double to floating_point<E, M> (to nearest, ties to even)
+ *
+ * All NaNs are converted to floating_point<E, M>::NaN().
+ */
+template <size_t E, size_t M>
+[[nodiscard]] floating_point<E, M> from_float_or_double(const float_hardware_t<E, M> value)
+{
+    using H = float_hardware_t<E, M>;
+    using Bits = typename float_extraction_helper::bit_cast_to_type_trait<H>::type;
+    constexpr size_t HE = get_exponent_width<H>();
+    constexpr size_t HM = get_mantissa_width<H>();
+    constexpr uint64_t exp_ones = native_mask<uint64_t>(E);
+
+    const uint64_t bits = bit_cast<Bits>(value);
+    const bool sign = ((bits >> (HE + HM)) & 1U) != 0U;
+    const uint64_t native_exponent = (bits >> HM) & native_mask<uint64_t>(HE);
+    const uint64_t fraction = bits & native_mask<uint64_t>(HM);
+
+    if (native_exponent == native_mask<uint64_t>(HE))
+    {
+        return (fraction != 0U) ? floating_point<E, M>::NaN()
+                                : make_native_float<E, M>(sign, exp_ones, 0U);
+    }
+
+    if constexpr (E == HE && M == HM)
+    {
+        const uint64_t hidden = (native_exponent != 0U) ? (uint64_t{1U} << M) : 0U;
+        return make_native_float<E, M>(sign, native_exponent, fraction | hidden);
+    }
+    else
+    {
+        // results below the normal range of double are far below the range of the format
+        if (native_exponent == 0U)
+        {
+            return make_native_float<E, M>(sign, 0U, 0U);
+        }
+
+        constexpr int64_t bias = static_cast<int64_t>(native_mask<uint64_t>(E - 1));
+        constexpr int64_t native_bias = static_cast<int64_t>(native_mask<uint64_t>(HE - 1));
+        int64_t exponent = static_cast<int64_t>(native_exponent) - native_bias + bias;
+        const uint64_t significand = fraction | (uint64_t{1U} << HM);
+
+        // subnormal results lose the bits right of the smallest subnormal number
+        size_t shift_by = HM - M;
+        if (exponent < 1)
+        {
+            shift_by += static_cast<size_t>(1 - exponent);
+            exponent = 0;
+        }
+        if (shift_by > HM + 1)
+        {
+            return make_native_float<E, M>(sign, 0U, 0U);
+        }
+
+        // adding half a unit in the last place (minus one for ties to odd numbers) rounds to even
+        const uint64_t half = uint64_t{1U} << (shift_by - 1);
+        const uint64_t odd = (significand >> shift_by) & 1U;
+        uint64_t mantissa = (significand + half - 1U + odd) >> shift_by;
+
+        if (exponent == 0)
+        {
+            // rounding up the largest subnormal number yields the smallest normal number
+            return make_native_float<E, M>(sign, mantissa >> M, mantissa);
+        }
+        if ((mantissa >> (M + 1)) != 0U)
+        {
+            mantissa >>= 1U;
+            ++exponent;
+        }
+        if (static_cast<uint64_t>(exponent) >= exp_ones)
+        {
+            return make_native_float<E, M>(sign, exp_ones, 0U);
+        }
+        return make_native_float<E, M>(sign, static_cast<uint64_t>(exponent), mantissa);
+    }
+}
+
+/**
+ * @brief Converts a number that is not NaN to the native type of its format (exactly)
+ */
+template <size_t E, size_t M>
+[[nodiscard]] float_hardware_t<E, M> to_hardware_float(const floating_point<E, M>& x)
+{
+    using H = float_hardware_t<E, M>;
+    if constexpr (std::is_same_v<H, float128_t>)
+    {
+        return to_float128(x);
+    }
+    else if constexpr (std::is_same_v<H, long double>)
+    {
+        return to_x87_long_double(x);
+    }
+    else
+    {
+        return to_float_or_double(x);
+    }
+}
+
+/**
+ * @brief Rounds a native number to floating_point<E, M> (to nearest, ties to even)
+ *
+ * All NaNs are converted to floating_point<E, M>::NaN().
+ */
+template <size_t E, size_t M>
+[[nodiscard]] floating_point<E, M> from_hardware_float(const float_hardware_t<E, M> value)
+{
+    using H = float_hardware_t<E, M>;
+    if constexpr (std::is_same_v<H, float128_t>)
+    {
+        return from_float128(value);
+    }
+    else if constexpr (std::is_same_v<H, long double>)
+    {
+        return from_x87_long_double(value);
+    }
+    else
+    {
+        return from_float_or_double<E, M>(value);
+    }
+}
+
+template <size_t E, size_t M, typename Operation>
+[[nodiscard]] floating_point<E, M> hardware_operation(const floating_point<E, M>& lhs,
+                                                      const floating_point<E, M>& rhs,
+                                                      Operation operation)
+{
+    static_assert(float_hardware_kernels<E, M>,
+                  "The floating-point unit can not compute with this format");
+
+    // NaN operands are treated exactly like the software implementation does
+    if (lhs.is_nan())
+    {
+        return lhs.make_quiet_nan();
+    }
+    if (rhs.is_nan())
+    {
+        return rhs.make_quiet_nan();
+    }
+
+    const float_hardware_t<E, M> result =
+        operation(to_hardware_float(lhs), to_hardware_float(rhs));
+    return from_hardware_float<E, M>(result);
+}
+
+} // namespace implementation
+
+/**
+ * @brief Adds two `floating_point` values using the floating-point unit of the host
+ *
+ * This is available for the formats described in implementation::float_hardware_t. In contrast to
+ * add, the result is correctly rounded (to nearest, ties to even). NaN operands are propagated like
+ * add does and invalid operations return floating_point<E, M>::NaN().
+ *
+ * @note The floating-point environment has to use the default rounding mode and must not flush
+ * subnormal numbers to zero.
+ *
+ * @param lhs The first number that is to be summed up
+ * @param rhs The second number that is to be summed up
+ * @return The sum
+ */
+template <size_t E, size_t M>
+[[nodiscard]] auto hardware_add(const floating_point<E, M> lhs, const floating_point<E, M> rhs)
+    -> floating_point<E, M>
+{
+    return implementation::hardware_operation(lhs, rhs, std::plus<>{});
+}
+
+/**
+ * @brief Subtracts two `floating_point` values using the floating-point unit of the host
+ *
+ * @see hardware_add
+ *
+ * @param lhs The minuend
+ * @param rhs The subtrahend
+ * @return The difference lhs-rhs
+ */
+template <size_t E, size_t M>
+[[nodiscard]] auto hardware_sub(const floating_point<E, M> lhs, const floating_point<E, M> rhs)
+    -> floating_point<E, M>
+{
+    return implementation::hardware_operation(lhs, rhs, std::minus<>{});
+}
+
+/**
+ * @brief Multiplies two `floating_point` values using the floating-point unit of the host
+ *
+ * @see hardware_add
+ *
+ * @param lhs The multiplicand
+ * @param rhs The multiplicator
+ * @return The product lhs*rhs
+ */
+template <size_t E, size_t M>
+[[nodiscard]] auto hardware_mul(const floating_point<E, M> lhs, const floating_point<E, M> rhs)
+    -> floating_point<E, M>
+{
+    return implementation::hardware_operation(lhs, rhs, std::multiplies<>{});
+}
+
+/**
+ * @brief Divides two `floating_point` values using the floating-point unit of the host
+ *
+ * @see hardware_add
+ *
+ * @param lhs The dividend
+ * @param rhs The divisor
+ * @return The quotient lhs/rhs
+ */
+template <size_t E, size_t M>
+[[nodiscard]] auto hardware_div(const floating_point<E, M> lhs, const floating_point<E, M> rhs)
+    -> floating_point<E, M>
+{
+    return implementation::hardware_operation(lhs, rhs, std::divides<>{});
+}
+
+/**
+ * @brief Computes the fused multiply-add a*b+c of `floating_point` values using the floating-point
+ * unit of the host
+ *
+ * This is available for the formats described in implementation::float_hardware_fma. NaN operands
+ * are propagated like fma does.
+ *
+ * @param a The multiplicand
+ * @param b The multiplicator
+ * @param c The addend
+ * @return The correctly rounded value of a*b+c
+ */
+template <size_t E, size_t M>
+[[nodiscard]] auto hardware_fma(const floating_point<E, M> a, const floating_point<E, M> b,
+                                const floating_point<E, M> c) -> floating_point<E, M>
+{
+    static_assert(implementation::float_hardware_fma<E, M>,
+                  "The floating-point unit can not compute the fused multiply-add of this format");
+
+    if (a.is_nan())
+    {
+        return a.make_quiet_nan();
+    }
+    if (b.is_nan())
+    {
+        return b.make_quiet_nan();
+    }
+    if (c.is_nan())
+    {
+        return c.make_quiet_nan();
+    }
+
+    using implementation::to_hardware_float;
+    return implementation::from_hardware_float<E, M>(
+        std::fma(to_hardware_float(a), to_hardware_float(b), to_hardware_float(c)));
+}
+
+/**
+ * @brief Computes the square root of a `floating_point` value using the floating-point unit of the
+ * host
+ *
+ * This is available for the formats described in implementation::float_hardware_sqrt. NaNs are
+ * propagated like sqrt does.
+ *
+ * @param x The radicand
+ * @return The correctly rounded square root of x
+ */
+template <size_t E, size_t M>
+[[nodiscard]] auto hardware_sqrt(const floating_point<E, M> x) -> floating_point<E, M>
+{
+    static_assert(implementation::float_hardware_sqrt<E, M>,
+                  "The floating-point unit can not compute the square root of this format");
+
+    if (x.is_nan())
+    {
+        return x.make_quiet_nan();
+    }
+
+    using implementation::to_hardware_float;
+    return implementation::from_hardware_float<E, M>(std::sqrt(to_hardware_float(x)));
+}
+
+} // namespace aarith
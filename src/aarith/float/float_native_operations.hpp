@@ -0,0 +1,660 @@
+#pragma once
+
+#include <aarith/core/word_operations.hpp>
+#include <aarith/float/floating_point.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace aarith {
+
+namespace implementation {
+
+/*
+ * The native kernels compute the arithmetic operations of small formats on the exponents and
+ * mantissae stored in plain 64 bit (and, for intermediate results, 128 bit) integers instead of
+ * uinteger objects: the product of the mantissae is a single multiplication, the quotient a single
+ * division and the normalization counts the leading zeroes in one instruction.
+ *
+ * Every kernel mimics the generic implementation of the operation in float_operations.hpp step by
+ * step, so that the results are bit-identical (including the NaN payloads and the quirks of the
+ * generic operations). The generic implementations remain available as generic_add, generic_sub,
+ * generic_mul, generic_div, generic_fma and generic_sqrt.
+ */
+
+/**
+ * @brief Whether the arithmetic operations of floating_point<E, M, WordType> use the native kernels
+ *
+ * This is the case for all formats whose full mantissa (including the hidden bit) fits into a
+ * single 64 bit word, e.g., half_precision, bfloat16, tensorfloat32, single_precision and
+ * double_precision. The kernels need 128 bit integers for the intermediate results.
+ */
+#if defined(__SIZEOF_INT128__)
+template <size_t E, size_t M, typename WordType = uint64_t>
+inline constexpr bool float_native_kernels =
+    std::is_same_v<WordType, uint64_t> && (E + 1 < 64) && (M + 1 <= 64);
+#else
+template <size_t E, size_t M, typename WordType = uint64_t>
+inline constexpr bool float_native_kernels = false;
+#endif
+
+/**
+ * @brief Whether fma of floating_point<E, M, WordType> uses the native kernel
+ *
+ * The exact product of the mantissae has to fit into 125 bits to leave room for aligning it with
+ * the addend in a 128 bit integer, which excludes the widest formats of the native kernels.
+ */
+template <size_t E, size_t M, typename WordType = uint64_t>
+inline constexpr bool float_native_fma_kernels = float_native_kernels<E, M, WordType> && (M <= 61);
+
+/**
+ * @brief Whether sqrt of floating_point<E, M, WordType> uses the native kernel
+ *
+ * The significand is shifted to 2M+4 bits, which have to fit into a 128 bit integer.
+ */
+template <size_t E, size_t M, typename WordType = uint64_t>
+inline constexpr bool float_native_sqrt_kernels = float_native_kernels<E, M, WordType> && (M <= 62);
+
+/**
+ * @brief The sign, the exponent and the full mantissa (including the hidden bit) of a number
+ */
+struct native_float
+{
+    bool sign;
+    uint64_t exponent;
+    uint64_t mantissa;
+};
+
+template <typename T> [[nodiscard]] constexpr T native_mask(const size_t width)
+{
+    return (width >= sizeof(T) * 8) ? ~T{0U} : static_cast<T>((T{1U} << width) - 1U);
+}
+
+/**
+ * @brief Computes the number of bits needed to represent x
+ */
+template <typename T> [[nodiscard]] constexpr size_t native_bit_length(const T x)
+{
+    if constexpr (std::is_same_v<T, uint64_t>)
+    {
+        return 64 - count_leading_zeroes_word(x);
+    }
+    else
+    {
+        const auto high = static_cast<uint64_t>(x >> 64U);
+        return (high != 0U) ? 128 - count_leading_zeroes_word(high)
+                            : 64 - count_leading_zeroes_word(static_cast<uint64_t>(x));
+    }
+}
+
+template <size_t E, size_t M>
+[[nodiscard]] native_float native_fields(const floating_point<E, M>& x)
+{
+    return {x.get_sign() != 0U, x.get_exponent().word(0), x.get_full_mantissa().word(0)};
+}
+
+template <size_t E, size_t M>
+[[nodiscard]] floating_point<E, M> make_native_float(const bool sign, const uint64_t exponent,
+                                                     const uint64_t mantissa)
+{
+    return floating_point<E, M>(sign, uinteger<E>{exponent}, uinteger<M + 1>{mantissa});
+}
+
+/**
+ * @brief Native version of rshift_and_round for a mantissa of the given width
+ */
+template <size_t Width, typename T>
+[[nodiscard]] constexpr T native_rshift_and_round(const T m, const size_t shift_by)
+{
+    if (shift_by == 0)
+    {
+        return m;
+    }
+    if (shift_by > Width || shift_by > sizeof(T) * 8)
+    {
+        return T{0U};
+    }
+
+    const T half = T{1U} << (shift_by - 1);
+    const bool round = ((m & half) != 0U) && ((m & (half - 1U)) != 0U);
+    const T shifted = (shift_by < sizeof(T) * 8) ? (m >> shift_by) : T{0U};
+    return static_cast<T>(shifted + (round ? 1U : 0U)) & native_mask<T>(Width);
+}
+
+/**
+ * @brief Native version of normalize<E, M1, M2>
+ *
+ * @param sign The sign of the number
+ * @param exponent The exponent of the number (E bits)
+ * @param mantissa The full mantissa of the number (M1 + 1 bits)
+ * @return The normalized number
+ */
+template <size_t E, size_t M1, size_t M2, typename T>
+[[nodiscard]] floating_point<E, M2> native_normalize(const bool sign, uint64_t exponent, T mantissa)
+{
+    constexpr uint64_t exp_mask = native_mask<uint64_t>(E + 1);
+    constexpr T mant_mask = native_mask<T>(M1 + 1);
+
+    const size_t length = native_bit_length(mantissa);
+    if (length == 0)
+    {
+        exponent = 0U;
+    }
+    else if (length - 1 >= M2)
+    {
+        const size_t shift_by = length - 1 - M2;
+        mantissa = native_rshift_and_round<M1 + 1>(mantissa, shift_by);
+        exponent = (exponent + shift_by + ((exponent == 0U) ? 1U : 0U)) & exp_mask;
+    }
+    else if (exponent != 0U)
+    {
+        const size_t shift_by = M2 - (length - 1);
+        if (exponent <= (shift_by & exp_mask))
+        {
+            mantissa = (mantissa << (exponent - 1)) & mant_mask;
+            exponent = 0U;
+        }
+        else
+        {
+            mantissa = (mantissa << shift_by) & mant_mask;
+            exponent -= shift_by;
+        }
+    }
+
+    const uint64_t result_exponent = exponent & native_mask<uint64_t>(E);
+    const auto result_mantissa = static_cast<uint64_t>(mantissa & native_mask<T>(M2 + 1));
+
+    // NaNs and numbers whose exponent overflowed become infinity
+    const bool is_nan = (result_exponent == native_mask<uint64_t>(E)) &&
+                        ((result_mantissa & native_mask<uint64_t>(M2)) != 0U);
+    if (is_nan || ((exponent >> E) & 1U) != 0U)
+    {
+        return make_native_float<E, M2>(sign, native_mask<uint64_t>(E), 0U);
+    }
+    return make_native_float<E, M2>(sign, result_exponent, result_mantissa);
+}
+
+/**
+ * @brief Native version of add<E, M> and sub<E, M>
+ *
+ * @tparam Subtract Whether to compute lhs - rhs instead of lhs + rhs
+ */
+template <size_t E, size_t M, bool Subtract>
+[[nodiscard]] floating_point<E, M> native_add(const floating_point<E, M>& lhs,
+                                              const floating_point<E, M>& rhs)
+{
+    using F = floating_point<E, M>;
+    constexpr uint64_t exp_ones = native_mask<uint64_t>(E);
+    constexpr uint64_t frac_mask = native_mask<uint64_t>(M);
+    constexpr uint64_t quiet_bit = uint64_t{1U} << (M - 1);
+
+    const native_float a = native_fields(lhs);
+    native_float b = native_fields(rhs);
+
+    const bool inf_a = (a.exponent == exp_ones) && ((a.mantissa & frac_mask) == 0U);
+    const bool inf_b = (b.exponent == exp_ones) && ((b.mantissa & frac_mask) == 0U);
+    if (a.exponent == exp_ones && !inf_a)
+    {
+        return make_native_float<E, M>(a.sign, exp_ones, a.mantissa | quiet_bit);
+    }
+    if (b.exponent == exp_ones && !inf_b)
+    {
+        return make_native_float<E, M>(b.sign, exp_ones, b.mantissa | quiet_bit);
+    }
+
+    // a - b is computed as a + (-b)
+    b.sign = (b.sign != Subtract);
+    if (inf_a && inf_b && (a.sign != b.sign))
+    {
+        return F::NaN();
+    }
+
+    // order the operands by their magnitude
+    const bool swap = (a.exponent < b.exponent) ||
+                      ((a.exponent == b.exponent) && (a.mantissa < b.mantissa));
+    if constexpr (Subtract)
+    {
+        // the generic subtraction only checks for infinities when the operands are swapped
+        if (swap && inf_b)
+        {
+            return make_native_float<E, M>(b.sign, b.exponent, b.mantissa);
+        }
+    }
+    else
+    {
+        if (inf_a)
+        {
+            return lhs;
+        }
+        if (inf_b)
+        {
+            return rhs;
+        }
+    }
+
+    const native_float& big = swap ? b : a;
+    const native_float& small = swap ? a : b;
+
+    const bool normal_big = (big.exponent != 0U) && (big.exponent != exp_ones);
+    const bool normal_small = (small.exponent != 0U) && (small.exponent != exp_ones);
+    const uint64_t shift_by =
+        big.exponent - small.exponent - ((normal_big && !normal_small) ? 1U : 0U);
+    const uint64_t aligned = (shift_by > M) ? 0U : (small.mantissa >> shift_by);
+
+    if (big.sign != small.sign)
+    {
+        return native_normalize<E, M, M>(big.sign, big.exponent,
+                                         (big.mantissa - aligned) & native_mask<uint64_t>(M + 1));
+    }
+    using Sum = native_uint_t<M + 2>;
+    return native_normalize<E, M + 1, M>(big.sign, big.exponent,
+                                         static_cast<Sum>(Sum{big.mantissa} + aligned));
+}
+
+/**
+ * @brief Native version of mul<E, M>
+ */
+template <size_t E, size_t M>
+[[nodiscard]] floating_point<E, M> native_mul(const floating_point<E, M>& lhs,
+                                              const floating_point<E, M>& rhs)
+{
+    using F = floating_point<E, M>;
+    constexpr uint64_t exp_ones = native_mask<uint64_t>(E);
+    constexpr uint64_t exp_mask = native_mask<uint64_t>(E + 1);
+    constexpr uint64_t frac_mask = native_mask<uint64_t>(M);
+    constexpr uint64_t quiet_bit = uint64_t{1U} << (M - 1);
+    constexpr uint64_t bias = native_mask<uint64_t>(E - 1);
+
+    const native_float a = native_fields(lhs);
+    const native_float b = native_fields(rhs);
+
+    const bool inf_a = (a.exponent == exp_ones) && ((a.mantissa & frac_mask) == 0U);
+    const bool inf_b = (b.exponent == exp_ones) && ((b.mantissa & frac_mask) == 0U);
+    if (a.exponent == exp_ones && !inf_a)
+    {
+        return make_native_float<E, M>(a.sign, exp_ones, a.mantissa | quiet_bit);
+    }
+    if (b.exponent == exp_ones && !inf_b)
+    {
+        return make_native_float<E, M>(b.sign, exp_ones, b.mantissa | quiet_bit);
+    }
+
+    const bool zero_a = (a.exponent == 0U) && (a.mantissa == 0U);
+    const bool zero_b = (b.exponent == 0U) && (b.mantissa == 0U);
+    if ((zero_a && inf_b) || (inf_a && zero_b))
+    {
+        return F::NaN();
+    }
+
+    const bool sign = a.sign != b.sign;
+    if (inf_a || inf_b)
+    {
+        return make_native_float<E, M>(sign, exp_ones, 0U);
+    }
+
+    const uint64_t exponent_sum = a.exponent + b.exponent;
+    const bool carry = ((exponent_sum >> E) & 1U) != 0U;
+    const uint64_t exponent = (exponent_sum - bias) & exp_mask;
+    const bool negative = ((exponent >> E) & 1U) != 0U;
+
+    if (carry && negative)
+    {
+        return make_native_float<E, M>(sign, exp_ones, 0U);
+    }
+
+    using Product = native_uint_t<2 * M + 2>;
+    using Mantissa = native_uint_t<M + 2>;
+    const auto product =
+        static_cast<Mantissa>((Product{a.mantissa} * Product{b.mantissa}) >> M);
+
+    if (negative)
+    {
+        // underflows are shifted into the subnormal range without rounding
+        const uint64_t shift_by = (~exponent + 2U) & exp_mask;
+        const uint64_t mantissa =
+            (shift_by < M + 1)
+                ? static_cast<uint64_t>(product >> shift_by) & native_mask<uint64_t>(M + 1)
+                : uint64_t{0U};
+        return make_native_float<E, M>(sign, 0U, mantissa);
+    }
+
+    return native_normalize<E, 2 * M + 1, M>(sign, exponent & exp_ones, product);
+}
+
+/**
+ * @brief Native version of div<E, M>
+ */
+template <size_t E, size_t M>
+[[nodiscard]] floating_point<E, M> native_div(const floating_point<E, M>& lhs,
+                                              const floating_point<E, M>& rhs)
+{
+    using F = floating_point<E, M>;
+    constexpr uint64_t exp_ones = native_mask<uint64_t>(E);
+    constexpr uint64_t exp_mask = native_mask<uint64_t>(E + 1);
+    constexpr uint64_t frac_mask = native_mask<uint64_t>(M);
+    constexpr uint64_t quiet_bit = uint64_t{1U} << (M - 1);
+    constexpr uint64_t bias = native_mask<uint64_t>(E - 1);
+
+    const native_float a = native_fields(lhs);
+    const native_float b = native_fields(rhs);
+
+    const bool inf_a = (a.exponent == exp_ones) && ((a.mantissa & frac_mask) == 0U);
+    const bool inf_b = (b.exponent == exp_ones) && ((b.mantissa & frac_mask) == 0U);
+    if (a.exponent == exp_ones && !inf_a)
+    {
+        return make_native_float<E, M>(a.sign, exp_ones, a.mantissa | quiet_bit);
+    }
+    if (b.exponent == exp_ones && !inf_b)
+    {
+        return make_native_float<E, M>(b.sign, exp_ones, b.mantissa | quiet_bit);
+    }
+
+    const bool zero_a = (a.exponent == 0U) && (a.mantissa == 0U);
+    const bool zero_b = (b.exponent == 0U) && (b.mantissa == 0U);
+    if ((zero_a && zero_b) || (inf_a && inf_b))
+    {
+        return F::NaN();
+    }
+
+    const bool sign = a.sign != b.sign;
+    if (zero_b)
+    {
+        return make_native_float<E, M>(sign, exp_ones, 0U);
+    }
+    if (inf_a || inf_b || zero_a)
+    {
+        // the generic division returns zero for infinite dividends as well
+        return make_native_float<E, M>(sign, 0U, 0U);
+    }
+
+    // the leading one of a subnormal dividend is shifted to bit 2M for more precision
+    const bool lhs_is_denormal = a.exponent == 0U;
+    const size_t denorm_exponent_lhs =
+        lhs_is_denormal ? M - (native_bit_length(a.mantissa) - 1) : 0U;
+
+    using Quotient = native_uint_t<2 * M + 1>;
+    constexpr Quotient quotient_mask = native_mask<Quotient>(2 * M + 1);
+    const Quotient dividend = (Quotient{a.mantissa} << (M + denorm_exponent_lhs)) & quotient_mask;
+    const Quotient mquotient = dividend / Quotient{b.mantissa};
+
+    uint64_t exponent = a.exponent + bias;
+    if (lhs_is_denormal)
+    {
+        exponent = (exponent - (denorm_exponent_lhs - 1U)) & exp_mask;
+    }
+    bool overflow = ((exponent >> E) & 1U) != 0U;
+
+    exponent = (exponent - b.exponent - ((b.exponent == 0U) ? 1U : 0U)) & exp_mask;
+    const bool negative = ((exponent >> E) & 1U) != 0U;
+    overflow = overflow && negative;
+
+    if (overflow)
+    {
+        return make_native_float<E, M>(sign, exp_ones, 0U);
+    }
+    if (negative)
+    {
+        // shift the mantissa in case some part of it can be expressed as subnormal number
+        const uint64_t shift_by = (~exponent + 2U) & exp_mask;
+        const uint64_t mantissa =
+            (shift_by < M + 1)
+                ? static_cast<uint64_t>(native_rshift_and_round<2 * M + 1>(mquotient, shift_by) &
+                                        native_mask<Quotient>(M + 1))
+                : uint64_t{0U};
+        return make_native_float<E, M>(sign, 0U, mantissa);
+    }
+    if ((exponent & exp_ones) == 0U)
+    {
+        return make_native_float<E, M>(
+            sign, 0U,
+            static_cast<uint64_t>(native_rshift_and_round<2 * M + 1>(mquotient, 1) &
+                                  native_mask<Quotient>(M + 1)));
+    }
+
+    return native_normalize<E, 2 * M, M>(sign, exponent & exp_ones, mquotient);
+}
+
+/**
+ * @brief Native version of round_to_nearest_even<E, M> for the value sign * m * 2^quantum
+ */
+template <size_t E, size_t M, typename T>
+[[nodiscard]] floating_point<E, M> native_round_to_nearest_even(const bool sign, const T m,
+                                                                 const int64_t quantum)
+{
+    constexpr auto bias = static_cast<int64_t>(native_mask<uint64_t>(E - 1));
+    constexpr uint64_t exp_ones = native_mask<uint64_t>(E);
+    constexpr int64_t min_quantum = 1 - bias - static_cast<int64_t>(M);
+
+    const auto length = static_cast<int64_t>(native_bit_length(m));
+    if (length == 0)
+    {
+        return make_native_float<E, M>(sign, 0U, 0U);
+    }
+
+    int64_t result_quantum =
+        std::max(quantum + length - static_cast<int64_t>(M + 1), min_quantum);
+    uint64_t mantissa = 0U;
+    if (result_quantum <= quantum)
+    {
+        mantissa = static_cast<uint64_t>(m << static_cast<size_t>(quantum - result_quantum));
+    }
+    else if (result_quantum - quantum <= length)
+    {
+        const auto shift = static_cast<size_t>(result_quantum - quantum);
+        const T half = T{1U} << (shift - 1);
+        const T rest = m & static_cast<T>((half << 1U) - 1U);
+        mantissa = (shift < sizeof(T) * 8) ? static_cast<uint64_t>(m >> shift) : uint64_t{0U};
+        const bool odd = (mantissa & 1U) != 0U;
+        mantissa += static_cast<uint64_t>((rest > half) || ((rest == half) && odd));
+    }
+
+    // rounding up may carry into the next bit
+    if ((mantissa >> (M + 1)) != 0U)
+    {
+        mantissa >>= 1U;
+        ++result_quantum;
+    }
+
+    const int64_t exponent =
+        (((mantissa >> M) & 1U) != 0U) ? result_quantum + static_cast<int64_t>(M) + bias : 0;
+    if (static_cast<uint64_t>(exponent) >= exp_ones)
+    {
+        return make_native_float<E, M>(sign, exp_ones, 0U);
+    }
+    return make_native_float<E, M>(sign, static_cast<uint64_t>(exponent), mantissa);
+}
+
+/**
+ * @brief Native version of fma<E, M>
+ */
+template <size_t E, size_t M>
+[[nodiscard]] floating_point<E, M> native_fma(const floating_point<E, M>& x,
+                                              const floating_point<E, M>& y,
+                                              const floating_point<E, M>& z)
+{
+    using F = floating_point<E, M>;
+    using Wide = native_uint_t<128>;
+    constexpr uint64_t exp_ones = native_mask<uint64_t>(E);
+    constexpr uint64_t frac_mask = native_mask<uint64_t>(M);
+    constexpr uint64_t quiet_bit = uint64_t{1U} << (M - 1);
+    constexpr auto bias = static_cast<int64_t>(native_mask<uint64_t>(E - 1));
+
+    const native_float a = native_fields(x);
+    const native_float b = native_fields(y);
+    const native_float c = native_fields(z);
+
+    for (const native_float* operand : {&a, &b, &c})
+    {
+        if (operand->exponent == exp_ones && (operand->mantissa & frac_mask) != 0U)
+        {
+            return make_native_float<E, M>(operand->sign, exp_ones, operand->mantissa | quiet_bit);
+        }
+    }
+
+    const bool inf_a = a.exponent == exp_ones;
+    const bool inf_b = b.exponent == exp_ones;
+    const bool inf_c = c.exponent == exp_ones;
+    const bool zero_a = (a.exponent == 0U) && (a.mantissa == 0U);
+    const bool zero_b = (b.exponent == 0U) && (b.mantissa == 0U);
+    const bool zero_c = (c.exponent == 0U) && (c.mantissa == 0U);
+
+    const bool product_sign = a.sign != b.sign;
+    if ((zero_a && inf_b) || (inf_a && zero_b))
+    {
+        return F::NaN();
+    }
+    if (inf_a || inf_b)
+    {
+        if (inf_c && c.sign != product_sign)
+        {
+            return F::NaN();
+        }
+        return make_native_float<E, M>(product_sign, exp_ones, 0U);
+    }
+    if (inf_c)
+    {
+        return z;
+    }
+    if (zero_a || zero_b)
+    {
+        // the sum of two zeroes is only negative if both are negative
+        if (zero_c)
+        {
+            return make_native_float<E, M>(product_sign && c.sign, 0U, 0U);
+        }
+        return z;
+    }
+
+    const auto significand = [](const native_float& v) {
+        return (v.mantissa & frac_mask) | (static_cast<uint64_t>(v.exponent != 0U) << M);
+    };
+    const auto quantum = [](const native_float& v) {
+        return std::max<int64_t>(static_cast<int64_t>(v.exponent), 1) - bias -
+               static_cast<int64_t>(M);
+    };
+
+    const Wide product = Wide{significand(a)} * significand(b);
+    const int64_t product_quantum = quantum(a) + quantum(b);
+    if (zero_c)
+    {
+        return native_round_to_nearest_even<E, M>(product_sign, product, product_quantum);
+    }
+
+    // both operands are shifted to have their leading one at bit 125, the operand with the lower
+    // leading one is shifted right and its bits shifted out are kept as a sticky bit
+    const uint64_t addend = significand(c);
+    const auto product_length = static_cast<int64_t>(native_bit_length(product));
+    const auto addend_length = static_cast<int64_t>(native_bit_length(addend));
+    const int64_t product_top = product_quantum + product_length - 1;
+    const int64_t addend_top = quantum(c) + addend_length - 1;
+
+    Wide large = product << static_cast<size_t>(126 - product_length);
+    Wide small = Wide{addend} << static_cast<size_t>(126 - addend_length);
+    bool large_sign = product_sign;
+    bool small_sign = c.sign;
+    int64_t top = product_top;
+    if (product_top < addend_top)
+    {
+        std::swap(large, small);
+        std::swap(large_sign, small_sign);
+        top = addend_top;
+    }
+
+    const auto shift = static_cast<uint64_t>(top - std::min(product_top, addend_top));
+    if (shift >= 126)
+    {
+        small = Wide{1U};
+    }
+    else if (shift > 0)
+    {
+        const bool sticky = (small & native_mask<Wide>(shift)) != 0U;
+        small = (small >> shift) | Wide{sticky};
+    }
+    const int64_t sum_quantum = top - 125;
+
+    if (large_sign == small_sign)
+    {
+        return native_round_to_nearest_even<E, M>(large_sign, large + small, sum_quantum);
+    }
+    if (large == small)
+    {
+        return F::zero();
+    }
+    if (large > small)
+    {
+        return native_round_to_nearest_even<E, M>(large_sign, large - small, sum_quantum);
+    }
+    return native_round_to_nearest_even<E, M>(small_sign, small - large, sum_quantum);
+}
+
+/**
+ * @brief Native version of sqrt<E, M>
+ */
+template <size_t E, size_t M>
+[[nodiscard]] floating_point<E, M> native_sqrt(const floating_point<E, M>& x)
+{
+    using F = floating_point<E, M>;
+    using T = std::conditional_t<(2 * M + 4 <= 64), uint64_t, native_uint_t<128>>;
+    using R = std::conditional_t<(M + 4 <= 64), uint64_t, native_uint_t<128>>;
+    constexpr size_t W = 2 * M + 4;
+    constexpr uint64_t exp_ones = native_mask<uint64_t>(E);
+    constexpr uint64_t frac_mask = native_mask<uint64_t>(M);
+    constexpr uint64_t quiet_bit = uint64_t{1U} << (M - 1);
+    constexpr auto bias = static_cast<int64_t>(native_mask<uint64_t>(E - 1));
+
+    const native_float a = native_fields(x);
+    if (a.exponent == exp_ones)
+    {
+        if ((a.mantissa & frac_mask) != 0U)
+        {
+            return make_native_float<E, M>(a.sign, exp_ones, a.mantissa | quiet_bit);
+        }
+        return a.sign ? F::NaN() : F::pos_infinity();
+    }
+    if (a.exponent == 0U && a.mantissa == 0U)
+    {
+        return x;
+    }
+    if (a.sign)
+    {
+        return F::NaN();
+    }
+
+    const uint64_t significand =
+        (a.mantissa & frac_mask) | (static_cast<uint64_t>(a.exponent != 0U) << M);
+    const int64_t quantum = std::max<int64_t>(static_cast<int64_t>(a.exponent), 1) - bias -
+                            static_cast<int64_t>(M);
+
+    // the radicand gets W - 1 or W bits, keeping its quantum even
+    auto shift = static_cast<int64_t>(W - native_bit_length(significand));
+    if ((quantum - shift) % 2 != 0)
+    {
+        --shift;
+    }
+    const T radicand = T{significand} << static_cast<size_t>(shift);
+
+    // the root has M + 2 bits and the remainder is at most twice as large
+    R root = 0U;
+    R remainder = 0U;
+    for (size_t position = W; position > 0; position -= 2)
+    {
+        remainder = (remainder << 2U) | static_cast<R>((radicand >> (position - 2)) & 3U);
+        // the digit is computed without branches as it is unpredictable
+        const R trial = (root << 2U) | 1U;
+        const R digit = static_cast<R>(remainder >= trial);
+        remainder -= trial & (R{0U} - digit);
+        root = (root << 1U) | digit;
+    }
+
+    // the remainder adds the sticky bit
+    return native_round_to_nearest_even<E, M>(false, (root << 1U) | R{remainder != 0U},
+                                              (quantum - shift) / 2 - 1);
+}
+
+} // namespace implementation
+
+} // namespace aarith
@@ -1,8 +1,14 @@
 #pragma once
 
 #include <aarith/core/traits.hpp>
+#include <aarith/float/float_hardware_operations.hpp>
+#include <aarith/float/float_native_operations.hpp>
 #include <aarith/float/floating_point.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
 namespace aarith {
 
 /**
@@ -113,19 +119,13 @@ template <size_t E, size_t M, class Function_add, class Function_sub>
     return normalize<E, mantissa_sum.width() - 1, M>(sum);
 }
 
+namespace implementation {
+
 /**
- * @brief Adds two `floating_point` values
- *
- * @param lhs The first number that is to be summed up
- * @param rhs The second number that is to be summed up
- * @tparam E Width of exponent
- * @tparam M Width of mantissa including the leading 1
- *
- * @return The sum
- *
+ * @brief Adds two `floating_point` values using the operations on the uinteger mantissae
  */
 template <size_t E, size_t M>
-[[nodiscard]] auto add(const floating_point<E, M> lhs, const floating_point<E, M> rhs)
+[[nodiscard]] auto generic_add(const floating_point<E, M> lhs, const floating_point<E, M> rhs)
     -> floating_point<E, M>
 {
     if (lhs.is_nan())
@@ -165,18 +165,10 @@ template <size_t E, size_t M>
 }
 
 /**
- * @brief Subtract two `floating_point` values
- *
- * @param lhs The minuend
- * @param rhs The subtrahend
- * @tparam E Width of exponent
- * @tparam M Width of mantissa including the leading 1
- *
- * @return The difference lhs-rhs
- *
+ * @brief Subtracts two `floating_point` values using the operations on the uinteger mantissae
  */
 template <size_t E, size_t M>
-[[nodiscard]] auto sub(const floating_point<E, M> lhs, const floating_point<E, M> rhs)
+[[nodiscard]] auto generic_sub(const floating_point<E, M> lhs, const floating_point<E, M> rhs)
     -> floating_point<E, M>
 {
     if (lhs.is_nan())
@@ -206,19 +198,12 @@ template <size_t E, size_t M>
 }
 
 /**
- * @brief Multiplies two `floating_point` numbers
- *
- * @param lhs The multiplicand
- * @param rhs The multiplicator
- * @tparam E Width of exponent
- * @tparam M Width of mantissa including the leading 1
- *
- * @return The product lhs*rhs
- *
+ * @brief Multiplies two `floating_point` values using the operations on the uinteger mantissae
  */
 template <size_t E, size_t M, typename WordType>
-[[nodiscard]] auto mul(const floating_point<E, M, WordType> lhs,
-                       const floating_point<E, M, WordType> rhs) -> floating_point<E, M, WordType>
+[[nodiscard]] auto generic_mul(const floating_point<E, M, WordType> lhs,
+                               const floating_point<E, M, WordType> rhs)
+    -> floating_point<E, M, WordType>
 {
     if (lhs.is_nan())
     {
@@ -253,7 +238,7 @@ template <size_t E, size_t M, typename WordType>
 
     // compute mantissa
     auto mproduct = schoolbook_expanding_mul(lhs.get_full_mantissa(), rhs.get_full_mantissa());
-    mproduct = mproduct >> M;
+    mproduct = shift_right<M>(mproduct);
 
     // check for over or underflow and break
     if (underflow || overflow)
@@ -286,19 +271,12 @@ template <size_t E, size_t M, typename WordType>
 }
 
 /**
- * @brief Division with floating_points: lhs/rhs.
- *
- * @param lhs The dividend
- * @param rhs The divisor
- * @tparam E Width of exponent
- * @tparam M Width of mantissa including the leading 1
- * @tparam WordType The word type used to internally store the data
- * @return The quotient lhs/rhs
- *
+ * @brief Divides two `floating_point` values using the operations on the uinteger mantissae
  */
 template <size_t E, size_t M, typename WordType>
-[[nodiscard]] auto div(const floating_point<E, M, WordType> lhs,
-                       const floating_point<E, M, WordType> rhs) -> floating_point<E, M, WordType>
+[[nodiscard]] auto generic_div(const floating_point<E, M, WordType> lhs,
+                               const floating_point<E, M, WordType> rhs)
+    -> floating_point<E, M, WordType>
 {
 
     /*=================================
@@ -422,6 +400,478 @@ template <size_t E, size_t M, typename WordType>
     return normalize<E, mquotient.width() - 1, M>(quotient);
 }
 
+/**
+ * @brief Rounds the exact value sign * m * 2^quantum to floating_point<E, M, WordType> (to nearest,
+ * ties to even)
+ *
+ * Values below half of the smallest subnormal number become zero, values beyond the largest
+ * number become infinity.
+ *
+ * @param sign Whether the value is negative
+ * @param m The magnitude of the value in units of 2^quantum
+ * @param quantum The exponent of the least significant bit of m
+ * @return The rounded value
+ */
+template <size_t E, size_t M, typename WordType, size_t W>
+[[nodiscard]] auto round_to_nearest_even(const bool sign, const uinteger<W, WordType>& m,
+                                         const int64_t quantum) -> floating_point<E, M, WordType>
+{
+    static_assert(W > M + 1, "The value needs room for the carry of the rounding");
+    static_assert(E <= 60, "The exponents are computed using int64_t");
+
+    using F = floating_point<E, M, WordType>;
+    constexpr auto bias = static_cast<int64_t>((uint64_t{1U} << (E - 1)) - 1U);
+    constexpr auto max_exponent = static_cast<int64_t>((uint64_t{1U} << E) - 1U);
+    constexpr int64_t min_quantum = 1 - bias - static_cast<int64_t>(M);
+
+    const auto length = static_cast<int64_t>(W - count_leading_zeroes(m));
+    if (length == 0)
+    {
+        return sign ? F::neg_zero() : F::zero();
+    }
+
+    // the quantum of the result keeps M + 1 bits (or less for subnormal numbers)
+    int64_t result_quantum =
+        std::max(quantum + length - static_cast<int64_t>(M + 1), min_quantum);
+    uinteger<W, WordType> mantissa;
+    if (result_quantum <= quantum)
+    {
+        mantissa = m << static_cast<size_t>(quantum - result_quantum);
+    }
+    else if (result_quantum - quantum <= length)
+    {
+        const auto shift = static_cast<size_t>(result_quantum - quantum);
+        mantissa = m >> shift;
+        const bool round_bit = m.bit(shift - 1) != 0U;
+        const bool sticky = (shift > 1) && !(m << (W - shift + 1)).is_zero();
+        if (round_bit && (sticky || mantissa.bit(0) != 0U))
+        {
+            mantissa = add(mantissa, uinteger<W, WordType>::one());
+        }
+    }
+
+    // rounding up may carry into the next bit
+    if (mantissa.bit(M + 1) != 0U)
+    {
+        mantissa = mantissa >> 1;
+        ++result_quantum;
+    }
+
+    const int64_t exponent =
+        (mantissa.bit(M) != 0U) ? result_quantum + static_cast<int64_t>(M) + bias : 0;
+    if (exponent >= max_exponent)
+    {
+        return sign ? F::neg_infinity() : F::pos_infinity();
+    }
+    return F(sign, width_cast<E>(uinteger<64, WordType>{static_cast<uint64_t>(exponent)}),
+             width_cast<M + 1>(mantissa));
+}
+
+/**
+ * @brief Computes a*b+c with a single rounding using the operations on the uinteger mantissae
+ */
+template <size_t E, size_t M, typename WordType>
+[[nodiscard]] auto generic_fma(const floating_point<E, M, WordType> a,
+                               const floating_point<E, M, WordType> b,
+                               const floating_point<E, M, WordType> c)
+    -> floating_point<E, M, WordType>
+{
+    using F = floating_point<E, M, WordType>;
+
+    if (a.is_nan())
+    {
+        return a.make_quiet_nan();
+    }
+    if (b.is_nan())
+    {
+        return b.make_quiet_nan();
+    }
+    if (c.is_nan())
+    {
+        return c.make_quiet_nan();
+    }
+
+    const bool product_sign = a.get_sign() != b.get_sign();
+    if ((a.is_zero() && b.is_inf()) || (a.is_inf() && b.is_zero()))
+    {
+        return F::NaN();
+    }
+    if (a.is_inf() || b.is_inf())
+    {
+        if (c.is_inf() && c.is_negative() != product_sign)
+        {
+            return F::NaN();
+        }
+        return product_sign ? F::neg_infinity() : F::pos_infinity();
+    }
+    if (c.is_inf())
+    {
+        return c;
+    }
+    if (a.is_zero() || b.is_zero())
+    {
+        // the sum of two zeroes is only negative if both are negative
+        if (c.is_zero())
+        {
+            return (product_sign && c.is_negative()) ? F::neg_zero() : F::zero();
+        }
+        return c;
+    }
+
+    constexpr auto bias = static_cast<int64_t>((uint64_t{1U} << (E - 1)) - 1U);
+    const auto significand = [](const F& x) {
+        auto m = x.get_full_mantissa();
+        m.set_bit(M, !x.get_exponent().is_zero());
+        return m;
+    };
+    const auto quantum = [](const F& x) {
+        const auto exponent = static_cast<int64_t>(static_cast<uint64_t>(x.get_exponent()));
+        return std::max<int64_t>(exponent, 1) - bias - static_cast<int64_t>(M);
+    };
+
+    // the exact product has 2M+2 bits, the aligned addend at most 2M+4 more
+    constexpr size_t W = 4 * M + 8;
+    constexpr auto max_shift = static_cast<int64_t>(2 * M + 4);
+
+    uinteger<W, WordType> large = width_cast<W>(expanding_mul(significand(a), significand(b)));
+    int64_t large_quantum = quantum(a) + quantum(b);
+    bool large_sign = product_sign;
+    if (c.is_zero())
+    {
+        return round_to_nearest_even<E, M>(large_sign, large, large_quantum);
+    }
+
+    uinteger<W, WordType> small = width_cast<W>(significand(c));
+    int64_t small_quantum = quantum(c);
+    bool small_sign = c.is_negative();
+    if (large_quantum < small_quantum)
+    {
+        std::swap(large, small);
+        std::swap(large_quantum, small_quantum);
+        std::swap(large_sign, small_sign);
+    }
+
+    // an operand far below the other only decides the direction of rounding, so it can be
+    // replaced by a smaller number of the same sign
+    int64_t shift = large_quantum - small_quantum;
+    if (shift > max_shift)
+    {
+        small = uinteger<W, WordType>::one();
+        shift = max_shift;
+    }
+    large = large << static_cast<size_t>(shift);
+    const int64_t sum_quantum = large_quantum - shift;
+
+    if (large_sign == small_sign)
+    {
+        return round_to_nearest_even<E, M>(large_sign, add(large, small), sum_quantum);
+    }
+    if (large == small)
+    {
+        return F::zero();
+    }
+    if (large > small)
+    {
+        return round_to_nearest_even<E, M>(large_sign, sub(large, small), sum_quantum);
+    }
+    return round_to_nearest_even<E, M>(small_sign, sub(small, large), sum_quantum);
+}
+
+/**
+ * @brief Computes the leading bits of the square root of an unsigned integer
+ *
+ * The digit recurrence consumes two bits of the radicand per step, starting with the most
+ * significant ones, and appends one bit to the root. After all W / 2 steps, the root is the
+ * square root of the radicand rounded down.
+ *
+ * @param radicand The number whose square root is computed
+ * @param digits The number of steps, i.e. the number of computed bits of the root
+ * @return The computed bits of the root and whether the remainder is not zero
+ */
+template <size_t W, typename WordType>
+[[nodiscard]] auto sqrt_digit_recurrence(const uinteger<W, WordType>& radicand, const size_t digits)
+    -> std::pair<uinteger<W / 2, WordType>, bool>
+{
+    static_assert(W % 2 == 0, "The radicand is consumed two bits at a time");
+
+    // the remainder never exceeds twice the root
+    using Remainder = uinteger<W / 2 + 2, WordType>;
+
+    Remainder root;
+    Remainder remainder;
+    for (size_t i = 0; i < std::min(digits, W / 2); ++i)
+    {
+        const size_t position = W - 2 * (i + 1);
+        remainder <<= 2;
+        remainder.set_bit(1, radicand.bit(position + 1) != 0U);
+        remainder.set_bit(0, radicand.bit(position) != 0U);
+
+        Remainder trial = root << 2;
+        trial.set_bit(0, true);
+        root <<= 1;
+        if (remainder >= trial)
+        {
+            remainder = sub(remainder, trial);
+            root.set_bit(0, true);
+        }
+    }
+    return {width_cast<W / 2>(root), !remainder.is_zero()};
+}
+
+/**
+ * @brief Computes the leading bits of the square root of a positive, finite number
+ *
+ * The significand is shifted such that the root has M + 2 bits: the mantissa and the round bit.
+ * If all of them are computed, a sticky bit telling whether the root is inexact is appended.
+ * Otherwise, the bits that are not computed are zero.
+ *
+ * @param x The radicand
+ * @param digits The number of computed bits of the root
+ * @return The root in units of 2^quantum and the quantum
+ */
+template <size_t E, size_t M, typename WordType>
+[[nodiscard]] auto sqrt_significand(const floating_point<E, M, WordType>& x, const size_t digits)
+    -> std::pair<uinteger<M + 3, WordType>, int64_t>
+{
+    constexpr size_t W = 2 * M + 4;
+    constexpr auto bias = static_cast<int64_t>((uint64_t{1U} << (E - 1)) - 1U);
+
+    auto significand = x.get_full_mantissa();
+    significand.set_bit(M, !x.get_exponent().is_zero());
+    const auto exponent = static_cast<int64_t>(static_cast<uint64_t>(x.get_exponent()));
+    const int64_t quantum = std::max<int64_t>(exponent, 1) - bias - static_cast<int64_t>(M);
+
+    // the radicand gets W - 1 or W bits, keeping its quantum even
+    size_t shift = W - (M + 1 - count_leading_zeroes(significand));
+    if ((quantum - static_cast<int64_t>(shift)) % 2 != 0)
+    {
+        --shift;
+    }
+    const auto radicand = width_cast<W>(significand) << shift;
+    const auto [root, inexact] = sqrt_digit_recurrence(radicand, digits);
+
+    auto result = width_cast<M + 3>(root) << (W / 2 + 1 - std::min(digits, W / 2));
+    result.set_bit(0, inexact && digits >= W / 2);
+    return {result, (quantum - static_cast<int64_t>(shift)) / 2 - 1};
+}
+
+/**
+ * @brief Computes the square root using the digit recurrence on the uinteger mantissa
+ */
+template <size_t E, size_t M, typename WordType>
+[[nodiscard]] auto generic_sqrt(const floating_point<E, M, WordType> x)
+    -> floating_point<E, M, WordType>
+{
+    using F = floating_point<E, M, WordType>;
+
+    if (x.is_nan())
+    {
+        return x.make_quiet_nan();
+    }
+    if (x.is_zero())
+    {
+        return x;
+    }
+    if (x.is_negative())
+    {
+        return F::NaN();
+    }
+    if (x.is_inf())
+    {
+        return F::pos_infinity();
+    }
+
+    const auto [root, quantum] = sqrt_significand(x, M + 2);
+    return round_to_nearest_even<E, M>(false, root, quantum);
+}
+
+} // namespace implementation
+
+/**
+ * @brief Adds two `floating_point` values
+ *
+ * @param lhs The first number that is to be summed up
+ * @param rhs The second number that is to be summed up
+ * @tparam E Width of exponent
+ * @tparam M Width of mantissa including the leading 1
+ *
+ * @return The sum
+ *
+ */
+template <size_t E, size_t M>
+[[nodiscard]] auto add(const floating_point<E, M> lhs, const floating_point<E, M> rhs)
+    -> floating_point<E, M>
+{
+    if constexpr (implementation::float_hardware_dispatch<E, M>)
+    {
+        return hardware_add(lhs, rhs);
+    }
+    else if constexpr (implementation::float_native_kernels<E, M>)
+    {
+        return implementation::native_add<E, M, false>(lhs, rhs);
+    }
+    else
+    {
+        return implementation::generic_add(lhs, rhs);
+    }
+}
+
+/**
+ * @brief Subtract two `floating_point` values
+ *
+ * @param lhs The minuend
+ * @param rhs The subtrahend
+ * @tparam E Width of exponent
+ * @tparam M Width of mantissa including the leading 1
+ *
+ * @return The difference lhs-rhs
+ *
+ */
+template <size_t E, size_t M>
+[[nodiscard]] auto sub(const floating_point<E, M> lhs, const floating_point<E, M> rhs)
+    -> floating_point<E, M>
+{
+    if constexpr (implementation::float_hardware_dispatch<E, M>)
+    {
+        return hardware_sub(lhs, rhs);
+    }
+    else if constexpr (implementation::float_native_kernels<E, M>)
+    {
+        return implementation::native_add<E, M, true>(lhs, rhs);
+    }
+    else
+    {
+        return implementation::generic_sub(lhs, rhs);
+    }
+}
+
+/**
+ * @brief Multiplies two `floating_point` numbers
+ *
+ * @param lhs The multiplicand
+ * @param rhs The multiplicator
+ * @tparam E Width of exponent
+ * @tparam M Width of mantissa including the leading 1
+ *
+ * @return The product lhs*rhs
+ *
+ */
+template <size_t E, size_t M, typename WordType>
+[[nodiscard]] auto mul(const floating_point<E, M, WordType> lhs,
+                       const floating_point<E, M, WordType> rhs) -> floating_point<E, M, WordType>
+{
+    if constexpr (implementation::float_hardware_dispatch<E, M, WordType>)
+    {
+        return hardware_mul(lhs, rhs);
+    }
+    else if constexpr (implementation::float_native_kernels<E, M, WordType>)
+    {
+        return implementation::native_mul(lhs, rhs);
+    }
+    else
+    {
+        return implementation::generic_mul(lhs, rhs);
+    }
+}
+
+/**
+ * @brief Division with floating_points: lhs/rhs.
+ *
+ * @param lhs The dividend
+ * @param rhs The divisor
+ * @tparam E Width of exponent
+ * @tparam M Width of mantissa including the leading 1
+ * @tparam WordType The word type used to internally store the data
+ * @return The quotient lhs/rhs
+ *
+ */
+template <size_t E, size_t M, typename WordType>
+[[nodiscard]] auto div(const floating_point<E, M, WordType> lhs,
+                       const floating_point<E, M, WordType> rhs) -> floating_point<E, M, WordType>
+{
+    if constexpr (implementation::float_hardware_dispatch<E, M, WordType>)
+    {
+        return hardware_div(lhs, rhs);
+    }
+    else if constexpr (implementation::float_native_kernels<E, M, WordType>)
+    {
+        return implementation::native_div(lhs, rhs);
+    }
+    else
+    {
+        return implementation::generic_div(lhs, rhs);
+    }
+}
+
+/**
+ * @brief Computes the fused multiply-add a*b+c of `floating_point` values
+ *
+ * The exact product is added to c and the sum is rounded once (to nearest, ties to even), as
+ * specified by IEEE 754. NaN operands are propagated like mul and add do (a first, then b, then c)
+ * and invalid operations (multiplying zero and infinity, adding infinities of different signs)
+ * return NaN.
+ *
+ * @param a The multiplicand
+ * @param b The multiplicator
+ * @param c The addend
+ * @tparam E Width of exponent
+ * @tparam M Width of mantissa
+ * @tparam WordType The word type used to internally store the data
+ *
+ * @return The correctly rounded value of a*b+c
+ */
+template <size_t E, size_t M, typename WordType>
+[[nodiscard]] auto fma(const floating_point<E, M, WordType> a,
+                       const floating_point<E, M, WordType> b,
+                       const floating_point<E, M, WordType> c) -> floating_point<E, M, WordType>
+{
+    if constexpr (implementation::float_hardware_dispatch<E, M, WordType> &&
+                  implementation::float_hardware_fma<E, M>)
+    {
+        return hardware_fma(a, b, c);
+    }
+    else if constexpr (implementation::float_native_fma_kernels<E, M, WordType>)
+    {
+        return implementation::native_fma(a, b, c);
+    }
+    else
+    {
+        return implementation::generic_fma(a, b, c);
+    }
+}
+
+/**
+ * @brief Computes the square root of a `floating_point` value
+ *
+ * The root is computed bit by bit using a digit recurrence on the mantissa and rounded once (to
+ * nearest, ties to even), as specified by IEEE 754. The square root of -0 is -0, negative numbers
+ * return NaN and NaNs are propagated (as quiet NaNs).
+ *
+ * @param x The radicand
+ * @tparam E Width of exponent
+ * @tparam M Width of mantissa
+ * @tparam WordType The word type used to internally store the data
+ *
+ * @return The correctly rounded square root of x
+ */
+template <size_t E, size_t M, typename WordType>
+[[nodiscard]] auto sqrt(const floating_point<E, M, WordType> x) -> floating_point<E, M, WordType>
+{
+    if constexpr (implementation::float_hardware_dispatch<E, M, WordType> &&
+                  implementation::float_hardware_sqrt<E, M>)
+    {
+        return hardware_sqrt(x);
+    }
+    else if constexpr (implementation::float_native_sqrt_kernels<E, M, WordType>)
+    {
+        return implementation::native_sqrt(x);
+    }
+    else
+    {
+        return implementation::generic_sqrt(x);
+    }
+}
+
 /**
  * @brief Computes the negative value of the floating-point number
  *
@@ -21,6 +21,7 @@ using half_precision = floating_point<5, 10, uint64_t>;        // NOLINT
 using single_precision = floating_point<8, 23, uint64_t>;      // NOLINT
 using double_precision = floating_point<11, 52, uint64_t>;     // NOLINT
 using quadruple_precision = floating_point<15, 112, uint64_t>; // NOLINT
+using extended_precision = floating_point<15, 63, uint64_t>;   // NOLINT
 using bfloat16 = floating_point<8, 7, uint64_t>;               // NOLINT
 using tensorfloat32 = floating_point<8, 10, uint64_t>;         // NOLINT
 
@@ -53,8 +54,9 @@ template <size_t MS, size_t E, size_t M, typename WordType>
 template <size_t E, size_t M, typename WordType>
 [[nodiscard]] word_array<1 + E + M, WordType> as_word_array(const floating_point<E, M, WordType>& f)
 {
-    word_array<E + M> exp_mantissa = concat(f.get_exponent(), f.get_mantissa());
-    auto full_float = concat(word_array<1, WordType>{f.get_sign()}, exp_mantissa);
+    word_array<1 + E + M, WordType> full_float{f.get_mantissa()};
+    full_float.set_bits(M, f.get_exponent());
+    full_float.set_bit(E + M, f.is_negative());
     return full_float;
 }
 
@@ -0,0 +1,879 @@
+#pragma once
+
+#include <aarith/core/word_batch_operations.hpp>
+#include <aarith/float/float_operations.hpp>
+#include <aarith/float/floating_point.hpp>
+#include <aarith/integer/integer_batch.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace aarith {
+
+namespace implementation {
+
+/*
+ * The batch kernels for floating-point numbers are free of branches: all cases (special values,
+ * addition and subtraction of the mantissae, rounding to the left or to the right) are computed
+ * and the result is selected using masks. They are written once for a generic lane type V which is
+ * either a single uint64_t or a vector of four (AVX2) or eight (AVX-512) uint64_t, using the vector
+ * extensions of GCC and Clang. The kernels are always inlined into the functions compiled for the
+ * respective instruction set extension, so the vectors never cross a function boundary.
+ *
+ * Every kernel mimics the corresponding scalar operation of float_operations.hpp step by step, so
+ * that the results are bit-identical (including the NaN payloads and the quirks of the scalar
+ * operations). The fields of a number are stored in a single 64 bit word each, which restricts the
+ * kernels to small formats (see float_batch_add_kernels and float_batch_mul_kernels); larger
+ * formats fall back to the scalar operations.
+ */
+
+/**
+ * @brief Whether the addition and subtraction of batches use the branch-free kernels
+ */
+template <size_t E, size_t M>
+inline constexpr bool float_batch_add_kernels = (E <= 62) && (M + 2 <= 64);
+
+/**
+ * @brief Whether the multiplication of batches uses the branch-free kernels
+ *
+ * The full product of the mantissae has to fit into a 64 bit word. It is computed by a 32 bit by
+ * 32 bit multiplication as this is available as a vector instruction.
+ */
+template <size_t E, size_t M>
+inline constexpr bool float_batch_mul_kernels = (E <= 62) && (2 * M + 2 <= 64);
+
+/**
+ * @brief Pointers to the fields of the lanes of a batch of floating-point numbers
+ */
+template <typename Word> struct float_batch_fields
+{
+    Word* sign;
+    Word* exponent;
+    Word* mantissa;
+};
+
+#if defined(AARITH_HAS_X86_SIMD_KERNELS)
+
+/**
+ * @brief A vector of Lanes 64 bit words using the vector extensions of GCC and Clang
+ *
+ * The vector is wrapped in a class as passing or returning vectors wider than 16 bytes by value
+ * from functions compiled without AVX changes the ABI (and GCC warns about it). The operators work
+ * lane by lane, comparisons return masks with all bits of a lane set if the comparison holds.
+ */
+template <size_t Lanes> struct simd_lanes
+{
+    typedef uint64_t vector __attribute__((vector_size(8 * Lanes))); // NOLINT
+
+    vector v;
+
+    AARITH_BATCH_INLINE simd_lanes()
+        : v{}
+    {
+    }
+
+    // NOLINTNEXTLINE(google-explicit-constructor): constants are broadcast to all lanes
+    AARITH_BATCH_INLINE simd_lanes(const uint64_t x)
+        : v(vector{} + x)
+    {
+    }
+
+    AARITH_BATCH_INLINE explicit simd_lanes(const vector& x)
+        : v(x)
+    {
+    }
+
+    friend AARITH_BATCH_INLINE simd_lanes operator+(const simd_lanes& a, const simd_lanes& b)
+    {
+        return simd_lanes{a.v + b.v};
+    }
+
+    friend AARITH_BATCH_INLINE simd_lanes operator-(const simd_lanes& a, const simd_lanes& b)
+    {
+        return simd_lanes{a.v - b.v};
+    }
+
+    friend AARITH_BATCH_INLINE simd_lanes operator*(const simd_lanes& a, const simd_lanes& b)
+    {
+        return simd_lanes{a.v * b.v};
+    }
+
+    friend AARITH_BATCH_INLINE simd_lanes operator&(const simd_lanes& a, const simd_lanes& b)
+    {
+        return simd_lanes{a.v & b.v};
+    }
+
+    friend AARITH_BATCH_INLINE simd_lanes operator|(const simd_lanes& a, const simd_lanes& b)
+    {
+        return simd_lanes{a.v | b.v};
+    }
+
+    friend AARITH_BATCH_INLINE simd_lanes operator^(const simd_lanes& a, const simd_lanes& b)
+    {
+        return simd_lanes{a.v ^ b.v};
+    }
+
+    friend AARITH_BATCH_INLINE simd_lanes operator~(const simd_lanes& a)
+    {
+        return simd_lanes{~a.v};
+    }
+
+    friend AARITH_BATCH_INLINE simd_lanes operator<<(const simd_lanes& a, const simd_lanes& b)
+    {
+        return simd_lanes{a.v << b.v};
+    }
+
+    friend AARITH_BATCH_INLINE simd_lanes operator>>(const simd_lanes& a, const simd_lanes& b)
+    {
+        return simd_lanes{a.v >> b.v};
+    }
+
+    friend AARITH_BATCH_INLINE simd_lanes& operator+=(simd_lanes& a, const simd_lanes& b)
+    {
+        a.v += b.v;
+        return a;
+    }
+
+    friend AARITH_BATCH_INLINE simd_lanes& operator>>=(simd_lanes& a, const simd_lanes& b)
+    {
+        a.v >>= b.v;
+        return a;
+    }
+
+    friend AARITH_BATCH_INLINE simd_lanes operator==(const simd_lanes& a, const simd_lanes& b)
+    {
+        return simd_lanes{(vector)(a.v == b.v)};
+    }
+
+    friend AARITH_BATCH_INLINE simd_lanes operator!=(const simd_lanes& a, const simd_lanes& b)
+    {
+        return simd_lanes{(vector)(a.v != b.v)};
+    }
+
+    friend AARITH_BATCH_INLINE simd_lanes operator<(const simd_lanes& a, const simd_lanes& b)
+    {
+        return simd_lanes{(vector)(a.v < b.v)};
+    }
+
+    friend AARITH_BATCH_INLINE simd_lanes operator<=(const simd_lanes& a, const simd_lanes& b)
+    {
+        return simd_lanes{(vector)(a.v <= b.v)};
+    }
+
+    friend AARITH_BATCH_INLINE simd_lanes operator>(const simd_lanes& a, const simd_lanes& b)
+    {
+        return simd_lanes{(vector)(a.v > b.v)};
+    }
+};
+
+using avx2_lanes = simd_lanes<4>;
+using avx512_lanes = simd_lanes<8>;
+
+#endif
+
+/**
+ * @brief The signs, exponents and full mantissae (including the hidden bit) of one or more lanes
+ */
+template <typename V> struct float_lanes
+{
+    V sign;
+    V exponent;
+    V mantissa;
+};
+
+[[nodiscard]] constexpr uint64_t lane_mask(const size_t width)
+{
+    return (width >= 64) ? ~uint64_t{0U} : ((uint64_t{1U} << width) - 1U);
+}
+
+/**
+ * @brief Turns the result of a comparison into a mask with all bits set where the comparison
+ * holds
+ */
+template <typename V>
+[[nodiscard]] AARITH_BATCH_INLINE V lane_if(const decltype(V{} == V{})& condition)
+{
+    if constexpr (std::is_same_v<V, uint64_t>)
+    {
+        return uint64_t{0U} - static_cast<uint64_t>(condition);
+    }
+    else
+    {
+        return condition;
+    }
+}
+
+/**
+ * @brief Selects the bits of a where the mask is set and the bits of b elsewhere
+ */
+template <typename V>
+[[nodiscard]] AARITH_BATCH_INLINE V blend(const V& mask, const V& a, const V& b)
+{
+    return (a & mask) | (b & ~mask);
+}
+
+template <typename V>
+[[nodiscard]] AARITH_BATCH_INLINE float_lanes<V>
+select_lanes(const V& mask, const float_lanes<V>& a, const float_lanes<V>& b)
+{
+    return {blend(mask, a.sign, b.sign), blend(mask, a.exponent, b.exponent),
+            blend(mask, a.mantissa, b.mantissa)};
+}
+
+/**
+ * @brief Computes the number of bits needed to represent x without branching
+ */
+template <typename V> [[nodiscard]] AARITH_BATCH_INLINE V bit_length_lanes(const V& value)
+{
+    V x = value;
+    V length = V{0U};
+    for (const uint64_t step : {32U, 16U, 8U, 4U, 2U, 1U})
+    {
+        const V shift = lane_if<V>((x >> V{step}) != V{0U}) & V{step};
+        x >>= shift;
+        length += shift;
+    }
+    // x is either zero or one now
+    return length + x;
+}
+
+/**
+ * @brief Branch-free version of normalize<E, M1, M2>
+ *
+ * @param sign The sign of the number
+ * @param exponent The exponent of the number (E bits)
+ * @param mantissa The full mantissa of the number (M1 + 1 bits)
+ * @return The fields of the normalized number with a full mantissa of M2 + 1 bits
+ */
+template <size_t E, size_t M1, size_t M2, typename V>
+[[nodiscard]] AARITH_BATCH_INLINE float_lanes<V> normalize_lanes(const V& sign, const V& exponent,
+                                                                 const V& mantissa)
+{
+    static_assert(E + 1 < 64 && M1 + 1 <= 64 && M2 <= M1);
+
+    constexpr uint64_t exp_mask = lane_mask(E + 1);
+    constexpr uint64_t mant_mask = lane_mask(M1 + 1);
+    const V one = V{1U};
+
+    const V length = bit_length_lanes(mantissa);
+    const V exp_zero = lane_if<V>(exponent == V{0U});
+
+    // the leading one is at or left of bit M2: shift to the right and round (see rshift_and_round)
+    const V too_long = lane_if<V>(length > V{M2});
+    const V right = too_long & (length - V{M2 + 1});
+    const V half = (one << right) >> V{1U};
+    const V round = lane_if<V>((mantissa & half) != V{0U}) &
+                    lane_if<V>((mantissa & (half - V{1U})) != V{0U});
+    const V rounded = ((mantissa >> right) + (round & V{1U})) & V{mant_mask};
+    const V exp_right = (exponent + right + (exp_zero & V{1U})) & V{exp_mask};
+
+    // the leading one is right of bit M2: shift to the left as far as the exponent allows
+    const V left = ~too_long & (V{M2 + 1} - length);
+    const V to_subnormal = lane_if<V>(exponent <= (left & V{exp_mask}));
+    const V left_by = ~exp_zero & blend(to_subnormal, exponent - V{1U}, left);
+    const V shifted = (mantissa << left_by) & V{mant_mask};
+    const V exp_left = ~(exp_zero | to_subnormal) & (exponent - left) & V{exp_mask};
+
+    const V new_exponent = ~lane_if<V>(length == V{0U}) & blend(too_long, exp_right, exp_left);
+    const V new_mantissa = blend(too_long, rounded, shifted);
+
+    const V result_exponent = new_exponent & V{lane_mask(E)};
+    const V result_mantissa = new_mantissa & V{lane_mask(M2 + 1)};
+
+    // NaNs and numbers whose exponent overflowed become infinity
+    const V is_nan = lane_if<V>(result_exponent == V{lane_mask(E)}) &
+                     lane_if<V>((result_mantissa & V{lane_mask(M2)}) != V{0U});
+    const V overflow = lane_if<V>(((new_exponent >> V{E}) & V{1U}) != V{0U});
+    const V to_infinity = is_nan | overflow;
+
+    return {sign, blend(to_infinity, V{lane_mask(E)}, result_exponent),
+            ~to_infinity & result_mantissa};
+}
+
+/**
+ * @brief Branch-free version of add<E, M> and sub<E, M>
+ *
+ * @tparam Subtract Whether to compute a - b instead of a + b
+ */
+template <size_t E, size_t M, bool Subtract, typename V>
+[[nodiscard]] AARITH_BATCH_INLINE float_lanes<V> add_lanes(const float_lanes<V>& a,
+                                                           const float_lanes<V>& b)
+{
+    constexpr uint64_t exp_ones = lane_mask(E);
+    constexpr uint64_t frac_mask = lane_mask(M);
+    constexpr uint64_t full_mask = lane_mask(M + 1);
+    constexpr uint64_t quiet_bit = uint64_t{1U} << (M - 1);
+    const float_lanes<V> quiet_nan{V{0U}, V{exp_ones}, V{quiet_bit}};
+
+    const V special_a = lane_if<V>(a.exponent == V{exp_ones});
+    const V special_b = lane_if<V>(b.exponent == V{exp_ones});
+    const V nan_a = special_a & lane_if<V>((a.mantissa & V{frac_mask}) != V{0U});
+    const V nan_b = special_b & lane_if<V>((b.mantissa & V{frac_mask}) != V{0U});
+    const V inf_a = special_a & ~nan_a;
+    const V inf_b = special_b & ~nan_b;
+    const V signs_differ = lane_if<V>(a.sign != b.sign);
+
+    // a - b is computed as a + (-b)
+    const float_lanes<V> b_{b.sign ^ V{Subtract ? 1U : 0U}, b.exponent, b.mantissa};
+
+    // order the operands by their magnitude
+    const V swap = lane_if<V>(a.exponent < b.exponent) |
+                   (lane_if<V>(a.exponent == b.exponent) & lane_if<V>(a.mantissa < b.mantissa));
+    const float_lanes<V> big = select_lanes(swap, b_, a);
+    const float_lanes<V> small = select_lanes(swap, a, b_);
+
+    const V normal_big =
+        lane_if<V>(big.exponent != V{0U}) & lane_if<V>(big.exponent != V{exp_ones});
+    const V normal_small =
+        lane_if<V>(small.exponent != V{0U}) & lane_if<V>(small.exponent != V{exp_ones});
+    const V shift = big.exponent - small.exponent - (normal_big & ~normal_small & V{1U});
+    const V too_far = lane_if<V>(shift > V{M});
+    const V aligned = ~too_far & (small.mantissa >> (~too_far & shift));
+
+    const float_lanes<V> sum =
+        normalize_lanes<E, M + 1, M>(big.sign, big.exponent, big.mantissa + aligned);
+    const float_lanes<V> difference =
+        normalize_lanes<E, M, M>(big.sign, big.exponent, (big.mantissa - aligned) & V{full_mask});
+    float_lanes<V> result = select_lanes(lane_if<V>(big.sign != small.sign), difference, sum);
+
+    if constexpr (Subtract)
+    {
+        // the scalar subtraction only checks for infinities when the operands are swapped
+        const float_lanes<V> inf_result = select_lanes(inf_a & ~signs_differ, quiet_nan, b_);
+        result = select_lanes(swap & inf_b, inf_result, result);
+        result = select_lanes(inf_a & inf_b & ~signs_differ, quiet_nan, result);
+    }
+    else
+    {
+        result = select_lanes(inf_b, b, result);
+        result = select_lanes(inf_a, a, result);
+        result = select_lanes(inf_a & inf_b & signs_differ, quiet_nan, result);
+    }
+
+    const V exp_ones_ = V{exp_ones};
+    const float_lanes<V> quieted_a{a.sign, exp_ones_, a.mantissa | V{quiet_bit}};
+    const float_lanes<V> quieted_b{b.sign, exp_ones_, b.mantissa | V{quiet_bit}};
+    result = select_lanes(nan_b, quieted_b, result);
+    result = select_lanes(nan_a, quieted_a, result);
+    return result;
+}
+
+/**
+ * @brief Branch-free version of mul<E, M>
+ */
+template <size_t E, size_t M, typename V>
+[[nodiscard]] AARITH_BATCH_INLINE float_lanes<V> mul_lanes(const float_lanes<V>& a,
+                                                           const float_lanes<V>& b)
+{
+    constexpr uint64_t exp_ones = lane_mask(E);
+    constexpr uint64_t exp_mask = lane_mask(E + 1);
+    constexpr uint64_t frac_mask = lane_mask(M);
+    constexpr uint64_t full_mask = lane_mask(M + 1);
+    constexpr uint64_t quiet_bit = uint64_t{1U} << (M - 1);
+    constexpr uint64_t bias = lane_mask(E - 1);
+    const float_lanes<V> quiet_nan{V{0U}, V{exp_ones}, V{quiet_bit}};
+
+    const V special_a = lane_if<V>(a.exponent == V{exp_ones});
+    const V special_b = lane_if<V>(b.exponent == V{exp_ones});
+    const V nan_a = special_a & lane_if<V>((a.mantissa & V{frac_mask}) != V{0U});
+    const V nan_b = special_b & lane_if<V>((b.mantissa & V{frac_mask}) != V{0U});
+    const V inf_a = special_a & ~nan_a;
+    const V inf_b = special_b & ~nan_b;
+    const V zero_a = lane_if<V>(a.exponent == V{0U}) & lane_if<V>(a.mantissa == V{0U});
+    const V zero_b = lane_if<V>(b.exponent == V{0U}) & lane_if<V>(b.mantissa == V{0U});
+
+    const V sign = a.sign ^ b.sign;
+
+    const V exponent_sum = a.exponent + b.exponent;
+    const V carry = lane_if<V>(((exponent_sum >> V{E}) & V{1U}) != V{0U});
+    const V exponent = (exponent_sum - V{bias}) & V{exp_mask};
+    const V negative = lane_if<V>(((exponent >> V{E}) & V{1U}) != V{0U});
+    const V overflow = carry & negative;
+    const V underflow = ~carry & negative;
+
+    // the mantissae have at most 32 bits (see float_batch_mul_kernels), the masks allow to use a
+    // 32 bit by 32 bit multiplication
+    constexpr uint64_t low = lane_mask(32);
+    const V product = ((a.mantissa & V{low}) * (b.mantissa & V{low})) >> V{M};
+
+    // underflows are shifted into the subnormal range without rounding
+    const V underflow_shift = (~exponent + V{2U}) & V{exp_mask};
+    const V representable = lane_if<V>(underflow_shift < V{M + 1});
+    const V subnormal =
+        representable & (product >> (representable & underflow_shift)) & V{full_mask};
+    const float_lanes<V> out_of_range{sign, overflow & V{exp_ones}, ~overflow & subnormal};
+
+    const V exp_ones_ = V{exp_ones};
+    float_lanes<V> result = normalize_lanes<E, 2 * M + 1, M>(sign, exponent & V{exp_ones}, product);
+    result = select_lanes(overflow | underflow, out_of_range, result);
+    result = select_lanes(inf_a | inf_b, float_lanes<V>{sign, exp_ones_, V{0U}}, result);
+    result = select_lanes((zero_a & inf_b) | (inf_a & zero_b), quiet_nan, result);
+    const float_lanes<V> quieted_a{a.sign, exp_ones_, a.mantissa | V{quiet_bit}};
+    const float_lanes<V> quieted_b{b.sign, exp_ones_, b.mantissa | V{quiet_bit}};
+    result = select_lanes(nan_b, quieted_b, result);
+    result = select_lanes(nan_a, quieted_a, result);
+    return result;
+}
+
+template <typename V> [[nodiscard]] AARITH_BATCH_INLINE V load_lane_words(const uint64_t* from)
+{
+    if constexpr (std::is_same_v<V, uint64_t>)
+    {
+        return *from;
+    }
+    else
+    {
+        typename V::vector x;
+        std::memcpy(&x, from, sizeof(x));
+        return V{x};
+    }
+}
+
+template <typename V> AARITH_BATCH_INLINE void store_lane_words(uint64_t* to, const V& x)
+{
+    if constexpr (std::is_same_v<V, uint64_t>)
+    {
+        *to = x;
+    }
+    else
+    {
+        std::memcpy(to, &x.v, sizeof(x.v));
+    }
+}
+
+template <typename V>
+[[nodiscard]] AARITH_BATCH_INLINE float_lanes<V>
+load_lanes(const float_batch_fields<const uint64_t> from, const size_t lane)
+{
+    return {load_lane_words<V>(from.sign + lane), load_lane_words<V>(from.exponent + lane),
+            load_lane_words<V>(from.mantissa + lane)};
+}
+
+template <typename V>
+AARITH_BATCH_INLINE void store_lanes(const float_batch_fields<uint64_t> to, const size_t lane,
+                                     const float_lanes<V>& x)
+{
+    store_lane_words(to.sign + lane, x.sign);
+    store_lane_words(to.exponent + lane, x.exponent);
+    store_lane_words(to.mantissa + lane, x.mantissa);
+}
+
+/*
+ * The loops over the lanes process the lanes [begin, end) as long as complete vectors fit and
+ * return the first lane that was not processed.
+ */
+
+template <typename V, size_t E, size_t M, bool Subtract>
+AARITH_BATCH_INLINE size_t float_batch_add_lanes(const float_batch_fields<uint64_t> r,
+                                                 const float_batch_fields<const uint64_t> a,
+                                                 const float_batch_fields<const uint64_t> b,
+                                                 size_t begin, const size_t end)
+{
+    constexpr size_t width = sizeof(V) / sizeof(uint64_t);
+    for (; begin + width <= end; begin += width)
+    {
+        store_lanes(r, begin,
+                    add_lanes<E, M, Subtract>(load_lanes<V>(a, begin), load_lanes<V>(b, begin)));
+    }
+    return begin;
+}
+
+template <typename V, size_t E, size_t M>
+AARITH_BATCH_INLINE size_t float_batch_mul_lanes(const float_batch_fields<uint64_t> r,
+                                                 const float_batch_fields<const uint64_t> a,
+                                                 const float_batch_fields<const uint64_t> b,
+                                                 size_t begin, const size_t end)
+{
+    constexpr size_t width = sizeof(V) / sizeof(uint64_t);
+    for (; begin + width <= end; begin += width)
+    {
+        store_lanes(r, begin, mul_lanes<E, M>(load_lanes<V>(a, begin), load_lanes<V>(b, begin)));
+    }
+    return begin;
+}
+
+template <typename V, size_t E, size_t M>
+AARITH_BATCH_INLINE size_t float_batch_normalize_lanes(const float_batch_fields<uint64_t> r,
+                                                       const float_batch_fields<const uint64_t> a,
+                                                       size_t begin, const size_t end)
+{
+    constexpr size_t width = sizeof(V) / sizeof(uint64_t);
+    for (; begin + width <= end; begin += width)
+    {
+        const float_lanes<V> x = load_lanes<V>(a, begin);
+        store_lanes(r, begin, normalize_lanes<E, M, M>(x.sign, x.exponent, x.mantissa));
+    }
+    return begin;
+}
+
+#if defined(AARITH_HAS_X86_SIMD_KERNELS)
+
+template <size_t E, size_t M, bool Subtract>
+AARITH_TARGET_AVX2 size_t float_batch_add_avx2(const float_batch_fields<uint64_t> r,
+                                               const float_batch_fields<const uint64_t> a,
+                                               const float_batch_fields<const uint64_t> b,
+                                               const size_t lanes)
+{
+    return float_batch_add_lanes<avx2_lanes, E, M, Subtract>(r, a, b, 0, lanes);
+}
+
+template <size_t E, size_t M, bool Subtract>
+AARITH_TARGET_AVX512 size_t float_batch_add_avx512(const float_batch_fields<uint64_t> r,
+                                                   const float_batch_fields<const uint64_t> a,
+                                                   const float_batch_fields<const uint64_t> b,
+                                                   const size_t lanes)
+{
+    return float_batch_add_lanes<avx512_lanes, E, M, Subtract>(r, a, b, 0, lanes);
+}
+
+template <size_t E, size_t M>
+AARITH_TARGET_AVX2 size_t float_batch_mul_avx2(const float_batch_fields<uint64_t> r,
+                                               const float_batch_fields<const uint64_t> a,
+                                               const float_batch_fields<const uint64_t> b,
+                                               const size_t lanes)
+{
+    return float_batch_mul_lanes<avx2_lanes, E, M>(r, a, b, 0, lanes);
+}
+
+template <size_t E, size_t M>
+AARITH_TARGET_AVX512 size_t float_batch_mul_avx512(const float_batch_fields<uint64_t> r,
+                                                   const float_batch_fields<const uint64_t> a,
+                                                   const float_batch_fields<const uint64_t> b,
+                                                   const size_t lanes)
+{
+    return float_batch_mul_lanes<avx512_lanes, E, M>(r, a, b, 0, lanes);
+}
+
+template <size_t E, size_t M>
+AARITH_TARGET_AVX2 size_t float_batch_normalize_avx2(const float_batch_fields<uint64_t> r,
+                                                     const float_batch_fields<const uint64_t> a,
+                                                     const size_t lanes)
+{
+    return float_batch_normalize_lanes<avx2_lanes, E, M>(r, a, 0, lanes);
+}
+
+template <size_t E, size_t M>
+AARITH_TARGET_AVX512 size_t float_batch_normalize_avx512(
+    const float_batch_fields<uint64_t> r, const float_batch_fields<const uint64_t> a,
+    const size_t lanes)
+{
+    return float_batch_normalize_lanes<avx512_lanes, E, M>(r, a, 0, lanes);
+}
+
+#endif
+
+template <size_t E, size_t M, bool Subtract>
+void float_batch_add(const float_batch_fields<uint64_t> r,
+                     const float_batch_fields<const uint64_t> a,
+                     const float_batch_fields<const uint64_t> b, const size_t lanes)
+{
+    size_t done = 0;
+#if defined(AARITH_HAS_X86_SIMD_KERNELS)
+    switch (active_simd_level())
+    {
+    case simd_level::avx512: done = float_batch_add_avx512<E, M, Subtract>(r, a, b, lanes); break;
+    case simd_level::avx2: done = float_batch_add_avx2<E, M, Subtract>(r, a, b, lanes); break;
+    case simd_level::scalar: break;
+    }
+#endif
+    float_batch_add_lanes<uint64_t, E, M, Subtract>(r, a, b, done, lanes);
+}
+
+template <size_t E, size_t M>
+void float_batch_mul(const float_batch_fields<uint64_t> r,
+                     const float_batch_fields<const uint64_t> a,
+                     const float_batch_fields<const uint64_t> b, const size_t lanes)
+{
+    size_t done = 0;
+#if defined(AARITH_HAS_X86_SIMD_KERNELS)
+    switch (active_simd_level())
+    {
+    case simd_level::avx512: done = float_batch_mul_avx512<E, M>(r, a, b, lanes); break;
+    case simd_level::avx2: done = float_batch_mul_avx2<E, M>(r, a, b, lanes); break;
+    case simd_level::scalar: break;
+    }
+#endif
+    float_batch_mul_lanes<uint64_t, E, M>(r, a, b, done, lanes);
+}
+
+template <size_t E, size_t M>
+void float_batch_normalize(const float_batch_fields<uint64_t> r,
+                           const float_batch_fields<const uint64_t> a, const size_t lanes)
+{
+    size_t done = 0;
+#if defined(AARITH_HAS_X86_SIMD_KERNELS)
+    switch (active_simd_level())
+    {
+    case simd_level::avx512: done = float_batch_normalize_avx512<E, M>(r, a, lanes); break;
+    case simd_level::avx2: done = float_batch_normalize_avx2<E, M>(r, a, lanes); break;
+    case simd_level::scalar: break;
+    }
+#endif
+    float_batch_normalize_lanes<uint64_t, E, M>(r, a, done, lanes);
+}
+
+} // namespace implementation
+
+/**
+ * @brief A batch of N floating-point numbers with an exponent of width E and a mantissa of width M
+ *
+ * The signs, the exponents and the full mantissae (including the hidden bit) are stored in
+ * separate batches of unsigned integers (structure of arrays). This way, the arithmetic operations
+ * process several numbers at once without branching on special values. The results are
+ * bit-identical to the scalar operations on floating_point.
+ *
+ * The vectorized operations are available for formats whose fields fit into 64 bit words, e.g.,
+ * bfloat16, tensorfloat32, half_precision and single_precision (see
+ * implementation::float_batch_add_kernels and implementation::float_batch_mul_kernels). Batches
+ * of larger formats use the scalar operations lane by lane.
+ *
+ * @tparam E Width of exponent
+ * @tparam M Width of mantissa
+ * @tparam N The number of numbers (lanes)
+ */
+template <size_t E, size_t M, size_t N> class floating_point_batch
+{
+public:
+    using value_type = floating_point<E, M>;
+    using sign_batch = uinteger_batch<1, N>;
+    using exponent_batch = uinteger_batch<E, N>;
+    using mantissa_batch = uinteger_batch<M + 1, N>;
+
+    constexpr floating_point_batch() = default;
+
+    /**
+     * @brief Creates a batch with all lanes set to the given number
+     */
+    explicit floating_point_batch(const value_type& value)
+    {
+        for (size_t lane = 0; lane < N; ++lane)
+        {
+            set(lane, value);
+        }
+    }
+
+    /**
+     * @brief Creates a batch from N numbers
+     */
+    explicit floating_point_batch(const std::array<value_type, N>& values)
+    {
+        for (size_t lane = 0; lane < N; ++lane)
+        {
+            set(lane, values[lane]);
+        }
+    }
+
+    /**
+     * @brief Creates a batch from the signs, exponents and full mantissae of its numbers
+     */
+    floating_point_batch(const sign_batch& signs_, const exponent_batch& exponents_,
+                         const mantissa_batch& mantissae_)
+        : sign_lanes(signs_)
+        , exponent_lanes(exponents_)
+        , mantissa_lanes(mantissae_)
+    {
+    }
+
+    [[nodiscard]] static constexpr size_t lanes() noexcept
+    {
+        return N;
+    }
+
+    static constexpr auto exponent_width() -> size_t
+    {
+        return E;
+    }
+
+    static constexpr auto mantissa_width() -> size_t
+    {
+        return M;
+    }
+
+    /**
+     * @brief Returns the number stored in the given lane
+     */
+    [[nodiscard]] value_type get(const size_t lane) const
+    {
+        return value_type(sign_lanes.word(0, lane) != 0U, exponent_lanes.get(lane),
+                          word_array<M + 1>{mantissa_lanes.get(lane)});
+    }
+
+    /**
+     * @brief Stores a number in the given lane
+     */
+    void set(const size_t lane, const value_type& value)
+    {
+        sign_lanes.set(lane, uinteger<1>{value.get_sign()});
+        exponent_lanes.set(lane, value.get_exponent());
+        mantissa_lanes.set(lane, value.get_full_mantissa());
+    }
+
+    [[nodiscard]] const sign_batch& signs() const noexcept
+    {
+        return sign_lanes;
+    }
+
+    [[nodiscard]] const exponent_batch& exponents() const noexcept
+    {
+        return exponent_lanes;
+    }
+
+    [[nodiscard]] const mantissa_batch& mantissae() const noexcept
+    {
+        return mantissa_lanes;
+    }
+
+    /**
+     * @brief Returns pointers to the lanes of the fields (only if every field fits into a word)
+     */
+    [[nodiscard]] implementation::float_batch_fields<uint64_t> fields() noexcept
+    {
+        static_assert(E <= 64 && M + 1 <= 64, "The fields have to fit into a single word");
+        return {sign_lanes.data(), exponent_lanes.data(), mantissa_lanes.data()};
+    }
+
+    [[nodiscard]] implementation::float_batch_fields<const uint64_t> fields() const noexcept
+    {
+        static_assert(E <= 64 && M + 1 <= 64, "The fields have to fit into a single word");
+        return {sign_lanes.data(), exponent_lanes.data(), mantissa_lanes.data()};
+    }
+
+private:
+    sign_batch sign_lanes;
+    exponent_batch exponent_lanes;
+    mantissa_batch mantissa_lanes;
+};
+
+/**
+ * @brief Adds two batches of floating-point numbers lane by lane
+ *
+ * @param lhs The first summands
+ * @param rhs The second summands
+ * @return The batch of the sums, bit-identical to add on each lane
+ */
+template <size_t E, size_t M, size_t N>
+[[nodiscard]] floating_point_batch<E, M, N> add(const floating_point_batch<E, M, N>& lhs,
+                                                const floating_point_batch<E, M, N>& rhs)
+{
+    floating_point_batch<E, M, N> result;
+    if constexpr (implementation::float_batch_add_kernels<E, M>)
+    {
+        implementation::float_batch_add<E, M, false>(result.fields(), lhs.fields(), rhs.fields(),
+                                                      N);
+    }
+    else
+    {
+        for (size_t lane = 0; lane < N; ++lane)
+        {
+            result.set(lane, add(lhs.get(lane), rhs.get(lane)));
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Subtracts two batches of floating-point numbers lane by lane
+ *
+ * @param lhs The minuends
+ * @param rhs The subtrahends
+ * @return The batch of the differences, bit-identical to sub on each lane
+ */
+template <size_t E, size_t M, size_t N>
+[[nodiscard]] floating_point_batch<E, M, N> sub(const floating_point_batch<E, M, N>& lhs,
+                                                const floating_point_batch<E, M, N>& rhs)
+{
+    floating_point_batch<E, M, N> result;
+    if constexpr (implementation::float_batch_add_kernels<E, M>)
+    {
+        implementation::float_batch_add<E, M, true>(result.fields(), lhs.fields(), rhs.fields(),
+                                                     N);
+    }
+    else
+    {
+        for (size_t lane = 0; lane < N; ++lane)
+        {
+            result.set(lane, sub(lhs.get(lane), rhs.get(lane)));
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Multiplies two batches of floating-point numbers lane by lane
+ *
+ * @param lhs The multiplicands
+ * @param rhs The multiplicators
+ * @return The batch of the products, bit-identical to mul on each lane
+ */
+template <size_t E, size_t M, size_t N>
+[[nodiscard]] floating_point_batch<E, M, N> mul(const floating_point_batch<E, M, N>& lhs,
+                                                const floating_point_batch<E, M, N>& rhs)
+{
+    floating_point_batch<E, M, N> result;
+    if constexpr (implementation::float_batch_mul_kernels<E, M>)
+    {
+        implementation::float_batch_mul<E, M>(result.fields(), lhs.fields(), rhs.fields(), N);
+    }
+    else
+    {
+        for (size_t lane = 0; lane < N; ++lane)
+        {
+            result.set(lane, mul(lhs.get(lane), rhs.get(lane)));
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Normalizes every number of the batch
+ *
+ * @param batch The numbers to normalize
+ * @return The batch of the normalized numbers, bit-identical to normalize on each lane
+ */
+template <size_t E, size_t M, size_t N>
+[[nodiscard]] floating_point_batch<E, M, N> normalize(const floating_point_batch<E, M, N>& batch)
+{
+    floating_point_batch<E, M, N> result;
+    if constexpr (implementation::float_batch_add_kernels<E, M>)
+    {
+        implementation::float_batch_normalize<E, M>(result.fields(), batch.fields(), N);
+    }
+    else
+    {
+        for (size_t lane = 0; lane < N; ++lane)
+        {
+            result.set(lane, normalize<E, M, M>(batch.get(lane)));
+        }
+    }
+    return result;
+}
+
+namespace float_operators {
+
+template <size_t E, size_t M, size_t N>
+auto operator+(const floating_point_batch<E, M, N>& lhs, const floating_point_batch<E, M, N>& rhs)
+    -> floating_point_batch<E, M, N>
+{
+    return add(lhs, rhs);
+}
+
+template <size_t E, size_t M, size_t N>
+auto operator-(const floating_point_batch<E, M, N>& lhs, const floating_point_batch<E, M, N>& rhs)
+    -> floating_point_batch<E, M, N>
+{
+    return sub(lhs, rhs);
+}
+
+template <size_t E, size_t M, size_t N>
+auto operator*(const floating_point_batch<E, M, N>& lhs, const floating_point_batch<E, M, N>& rhs)
+    -> floating_point_batch<E, M, N>
+{
+    return mul(lhs, rhs);
+}
+
+} // namespace float_operators
+
+} // namespace aarith
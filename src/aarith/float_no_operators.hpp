@@ -6,6 +6,7 @@
 #include <aarith/float/float_string_utils.hpp>
 #include <aarith/float/float_utils.hpp>
 #include <aarith/float/floating_point.hpp>
+#include <aarith/float/floating_point_batch.hpp>
 #include <aarith/float/nan_payload.hpp>
 #include <aarith/float/total_order.hpp>
 #include <aarith/float/numeric_limits.hpp>
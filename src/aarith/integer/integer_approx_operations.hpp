@@ -291,7 +291,7 @@ uinteger<width + 1> FAUadder(const uinteger<width>& a, const uinteger<width>& b)
     uinteger<width + 1> result{lsp};
 
     const auto extended_msp = width_cast<width + 1>(msp);
-    result = add(result, extended_msp << lsp_width);
+    result = add(result, shift_left<lsp_width>(extended_msp));
     return result;
 }
 
@@ -0,0 +1,370 @@
+#pragma once
+
+#include <aarith/core/word_batch_operations.hpp>
+#include <aarith/integer/integers.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace aarith {
+
+/**
+ * @brief A batch of N integers of width W
+ *
+ * The numbers are stored limb-major (structure of arrays): the i-th words of all numbers are
+ * stored next to each other. This way, the arithmetic and logical operations process several
+ * numbers at once using AVX2 or AVX-512 instructions. The instruction set extension is detected at
+ * run time (see batch_simd_level), processors without these extensions use scalar code.
+ *
+ * Use the aliases uinteger_batch and integer_batch instead of this class.
+ *
+ * @tparam W The bit width of the numbers
+ * @tparam N The number of numbers (lanes)
+ * @tparam WordType The word type
+ * @tparam Signed Whether the numbers are signed integers
+ */
+template <size_t W, size_t N, typename WordType, bool Signed> class basic_integer_batch
+{
+public:
+    static_assert(W > 0, "Width must be at least 1 (bit)");
+    static_assert(N > 0, "A batch must consist of at least one number");
+    static_assert(::aarith::is_unsigned_int<WordType>,
+                  "Only unsigned integers can be used as word types");
+
+    using word_type = WordType;
+    using value_type = std::conditional_t<Signed, integer<W, WordType>, uinteger<W, WordType>>;
+
+    constexpr basic_integer_batch() = default;
+
+    /**
+     * @brief Creates a batch with all lanes set to the given number
+     */
+    explicit constexpr basic_integer_batch(const value_type& value)
+    {
+        for (size_t lane = 0; lane < N; ++lane)
+        {
+            set(lane, value);
+        }
+    }
+
+    /**
+     * @brief Creates a batch from N numbers
+     */
+    explicit constexpr basic_integer_batch(const std::array<value_type, N>& values)
+    {
+        for (size_t lane = 0; lane < N; ++lane)
+        {
+            set(lane, values[lane]);
+        }
+    }
+
+    [[nodiscard]] static constexpr size_t width() noexcept
+    {
+        return W;
+    }
+
+    [[nodiscard]] static constexpr size_t lanes() noexcept
+    {
+        return N;
+    }
+
+    [[nodiscard]] static constexpr size_t word_count() noexcept
+    {
+        return words;
+    }
+
+    [[nodiscard]] static constexpr bool is_signed() noexcept
+    {
+        return Signed;
+    }
+
+    /**
+     * @brief Returns the mask of the valid bits of the most significant word
+     */
+    [[nodiscard]] static constexpr WordType top_mask() noexcept
+    {
+        constexpr size_t word_width = implementation::bits_per_word<WordType>();
+        return (W % word_width == 0)
+                   ? static_cast<WordType>(~WordType{0U})
+                   : static_cast<WordType>((WordType{1U} << (W % word_width)) - 1U);
+    }
+
+    /**
+     * @brief Returns the number stored in the given lane
+     */
+    [[nodiscard]] constexpr value_type get(const size_t lane) const
+    {
+        value_type result;
+        for (size_t i = 0; i < words; ++i)
+        {
+            result.set_word(i, limbs[i * N + lane]);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Stores a number in the given lane
+     */
+    constexpr void set(const size_t lane, const value_type& value)
+    {
+        for (size_t i = 0; i < words; ++i)
+        {
+            limbs[i * N + lane] = value.word(i);
+        }
+    }
+
+    /**
+     * @brief Returns the word with the given index of the number in the given lane
+     */
+    [[nodiscard]] constexpr WordType word(const size_t index, const size_t lane) const
+    {
+        return limbs[index * N + lane];
+    }
+
+    [[nodiscard]] WordType* data() noexcept
+    {
+        return limbs.data();
+    }
+
+    [[nodiscard]] const WordType* data() const noexcept
+    {
+        return limbs.data();
+    }
+
+private:
+    static constexpr size_t words = word_array<W, WordType>::word_count();
+
+    // only the first row of words is aligned to a cache line (and the widest vectors), the rows
+    // start every N words, hence the kernels use unaligned loads and stores
+    alignas(64) std::array<WordType, words * N> limbs{};
+};
+
+/**
+ * @brief A batch of N unsigned integers of width W (see basic_integer_batch)
+ */
+template <size_t W, size_t N, typename WordType = uint64_t>
+using uinteger_batch = basic_integer_batch<W, N, WordType, false>;
+
+/**
+ * @brief A batch of N signed integers of width W (see basic_integer_batch)
+ */
+template <size_t W, size_t N, typename WordType = uint64_t>
+using integer_batch = basic_integer_batch<W, N, WordType, true>;
+
+/**
+ * @brief Adds two batches lane by lane (modulo 2^W)
+ *
+ * @param a First summand
+ * @param b Second summand
+ * @return The batch of the sums
+ */
+template <size_t W, size_t N, typename WordType, bool Signed>
+[[nodiscard]] basic_integer_batch<W, N, WordType, Signed>
+add(const basic_integer_batch<W, N, WordType, Signed>& a,
+    const basic_integer_batch<W, N, WordType, Signed>& b)
+{
+    using B = basic_integer_batch<W, N, WordType, Signed>;
+    B result;
+    implementation::batch_add<B::word_count()>(result.data(), a.data(), b.data(), N,
+                                               B::top_mask());
+    return result;
+}
+
+/**
+ * @brief Subtracts two batches lane by lane (modulo 2^W)
+ *
+ * @param a Minuend
+ * @param b Subtrahend
+ * @return The batch of the differences
+ */
+template <size_t W, size_t N, typename WordType, bool Signed>
+[[nodiscard]] basic_integer_batch<W, N, WordType, Signed>
+sub(const basic_integer_batch<W, N, WordType, Signed>& a,
+    const basic_integer_batch<W, N, WordType, Signed>& b)
+{
+    using B = basic_integer_batch<W, N, WordType, Signed>;
+    B result;
+    implementation::batch_sub<B::word_count()>(result.data(), a.data(), b.data(), N,
+                                               B::top_mask());
+    return result;
+}
+
+/**
+ * @brief Multiplies two batches lane by lane, keeping the lower W bits of each product
+ *
+ * As the lower bits of a product do not depend on the signedness of the factors, this works for
+ * signed and unsigned batches.
+ *
+ * @param a First factor
+ * @param b Second factor
+ * @return The batch of the truncated products
+ */
+template <size_t W, size_t N, typename WordType, bool Signed>
+[[nodiscard]] basic_integer_batch<W, N, WordType, Signed>
+mul(const basic_integer_batch<W, N, WordType, Signed>& a,
+    const basic_integer_batch<W, N, WordType, Signed>& b)
+{
+    using B = basic_integer_batch<W, N, WordType, Signed>;
+    B result;
+    implementation::batch_mul<B::word_count()>(result.data(), a.data(), b.data(), N,
+                                               B::top_mask());
+    return result;
+}
+
+/**
+ * @brief Compares two batches lane by lane
+ *
+ * @param a Left-hand side
+ * @param b Right-hand side
+ * @return For each lane, whether the number in a is less than the number in b
+ */
+template <size_t W, size_t N, typename WordType, bool Signed>
+[[nodiscard]] std::array<bool, N> less(const basic_integer_batch<W, N, WordType, Signed>& a,
+                                       const basic_integer_batch<W, N, WordType, Signed>& b)
+{
+    constexpr size_t sign_bit = (W - 1) % implementation::bits_per_word<WordType>();
+    // flipping the sign bits maps signed numbers monotonically to unsigned ones
+    constexpr WordType flip =
+        Signed ? static_cast<WordType>(WordType{1U} << sign_bit) : WordType{0U};
+
+    std::array<bool, N> result{};
+    std::array<bool, N> is_equal{};
+    implementation::batch_compare<basic_integer_batch<W, N, WordType, Signed>::word_count()>(
+        result.data(), is_equal.data(), a.data(), b.data(), N, flip);
+    return result;
+}
+
+/**
+ * @brief Compares two batches lane by lane for equality
+ *
+ * @param a Left-hand side
+ * @param b Right-hand side
+ * @return For each lane, whether the numbers in a and b are equal
+ */
+template <size_t W, size_t N, typename WordType, bool Signed>
+[[nodiscard]] std::array<bool, N> equal(const basic_integer_batch<W, N, WordType, Signed>& a,
+                                        const basic_integer_batch<W, N, WordType, Signed>& b)
+{
+    std::array<bool, N> is_less{};
+    std::array<bool, N> result{};
+    implementation::batch_compare<basic_integer_batch<W, N, WordType, Signed>::word_count()>(
+        is_less.data(), result.data(), a.data(), b.data(), N, WordType{0U});
+    return result;
+}
+
+namespace implementation {
+
+template <size_t W, size_t N, typename WordType, bool Signed>
+[[nodiscard]] basic_integer_batch<W, N, WordType, Signed>
+batch_logic(const basic_integer_batch<W, N, WordType, Signed>& a,
+            const basic_integer_batch<W, N, WordType, Signed>& b, const batch_logic_op op)
+{
+    using B = basic_integer_batch<W, N, WordType, Signed>;
+    B result;
+    batch_logic<B::word_count()>(result.data(), a.data(), b.data(), N, op, B::top_mask());
+    return result;
+}
+
+} // namespace implementation
+
+/**
+ * @brief Computes the bitwise and of two batches
+ */
+template <size_t W, size_t N, typename WordType, bool Signed>
+[[nodiscard]] basic_integer_batch<W, N, WordType, Signed>
+operator&(const basic_integer_batch<W, N, WordType, Signed>& a,
+          const basic_integer_batch<W, N, WordType, Signed>& b)
+{
+    return implementation::batch_logic(a, b, implementation::batch_logic_op::bitwise_and);
+}
+
+/**
+ * @brief Computes the bitwise or of two batches
+ */
+template <size_t W, size_t N, typename WordType, bool Signed>
+[[nodiscard]] basic_integer_batch<W, N, WordType, Signed>
+operator|(const basic_integer_batch<W, N, WordType, Signed>& a,
+          const basic_integer_batch<W, N, WordType, Signed>& b)
+{
+    return implementation::batch_logic(a, b, implementation::batch_logic_op::bitwise_or);
+}
+
+/**
+ * @brief Computes the bitwise xor of two batches
+ */
+template <size_t W, size_t N, typename WordType, bool Signed>
+[[nodiscard]] basic_integer_batch<W, N, WordType, Signed>
+operator^(const basic_integer_batch<W, N, WordType, Signed>& a,
+          const basic_integer_batch<W, N, WordType, Signed>& b)
+{
+    return implementation::batch_logic(a, b, implementation::batch_logic_op::bitwise_xor);
+}
+
+/**
+ * @brief Computes the bitwise negation of a batch
+ */
+template <size_t W, size_t N, typename WordType, bool Signed>
+[[nodiscard]] basic_integer_batch<W, N, WordType, Signed>
+operator~(const basic_integer_batch<W, N, WordType, Signed>& a)
+{
+    return implementation::batch_logic(a, a, implementation::batch_logic_op::bitwise_not);
+}
+
+/**
+ * @brief Shifts all numbers of a batch to the left
+ *
+ * @param a The batch to shift
+ * @param shift The number of bits to shift
+ * @return The shifted batch
+ */
+template <size_t W, size_t N, typename WordType, bool Signed>
+[[nodiscard]] basic_integer_batch<W, N, WordType, Signed>
+operator<<(const basic_integer_batch<W, N, WordType, Signed>& a, const size_t shift)
+{
+    using B = basic_integer_batch<W, N, WordType, Signed>;
+    B result;
+    implementation::batch_shift_left<B::word_count()>(result.data(), a.data(), N, shift,
+                                                      B::top_mask());
+    return result;
+}
+
+/**
+ * @brief Shifts all numbers of a batch to the right
+ *
+ * The shift is logical for unsigned batches and arithmetic for signed batches.
+ *
+ * @param a The batch to shift
+ * @param shift The number of bits to shift
+ * @return The shifted batch
+ */
+template <size_t W, size_t N, typename WordType, bool Signed>
+[[nodiscard]] basic_integer_batch<W, N, WordType, Signed>
+operator>>(const basic_integer_batch<W, N, WordType, Signed>& a, const size_t shift)
+{
+    using B = basic_integer_batch<W, N, WordType, Signed>;
+    constexpr size_t sign_bit = (W - 1) % implementation::bits_per_word<WordType>();
+
+    B result;
+    if constexpr (Signed)
+    {
+        // the bits that are shifted in are set for negative numbers
+        const size_t fill_shift = (shift < W) ? W - shift : 0;
+        const uinteger<W, WordType> fill = uinteger<W, WordType>::all_ones() << fill_shift;
+        std::array<WordType, B::word_count()> fill_words{};
+        for (size_t i = 0; i < B::word_count(); ++i)
+        {
+            fill_words[i] = fill.word(i);
+        }
+        implementation::batch_shift_right<B::word_count()>(result.data(), a.data(), N, shift,
+                                                           fill_words.data(), sign_bit);
+    }
+    else
+    {
+        implementation::batch_shift_right<B::word_count()>(
+            result.data(), a.data(), N, shift, static_cast<const WordType*>(nullptr), sign_bit);
+    }
+    return result;
+}
+
+} // namespace aarith
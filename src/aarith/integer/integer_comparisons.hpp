@@ -1,7 +1,9 @@
 #pragma once
 
 #include <aarith/core/traits.hpp>
+#include <aarith/core/word_operations.hpp>
 #include <aarith/integer/integers.hpp>
+#include <climits>
 
 namespace aarith {
 
@@ -32,6 +34,12 @@ template <size_t W, size_t V, typename WordType>
 constexpr bool operator<(const uinteger<W, WordType>& a, const uinteger<V, WordType>& b)
 {
 
+    if constexpr (implementation::has_native_width<uinteger<W, WordType>> &&
+                  implementation::has_native_width<uinteger<V, WordType>>)
+    {
+        return implementation::to_native(a) < implementation::to_native(b);
+    }
+
     constexpr size_t words_W = integer<W, WordType>::word_count();
     constexpr size_t words_V = integer<V, WordType>::word_count();
 
@@ -104,6 +112,20 @@ template <typename W, typename V> constexpr bool operator>(const W& a, const V&
 template <size_t W, size_t V, typename WordType>
 constexpr bool operator<(const integer<W, WordType>& a, const integer<V, WordType>& b)
 {
+    if constexpr (implementation::has_native_width<integer<W, WordType>> &&
+                  implementation::has_native_width<integer<V, WordType>>)
+    {
+        // flipping the sign bits of the sign extended numbers maps the signed order onto the
+        // unsigned order
+        using N = implementation::native_uint_t<std::max(W, V)>;
+        constexpr N sign = static_cast<N>(1U) << (sizeof(N) * CHAR_BIT - 1);
+        using implementation::sign_extend_native;
+        using implementation::to_native;
+        const N a_ = sign_extend_native<W>(static_cast<N>(to_native(a)));
+        const N b_ = sign_extend_native<V>(static_cast<N>(to_native(b)));
+        return (a_ ^ sign) < (b_ ^ sign);
+    }
+
     if (a.is_negative() && !b.is_negative())
     {
         return true;
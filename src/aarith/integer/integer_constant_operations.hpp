@@ -0,0 +1,297 @@
+#pragma once
+
+#include <aarith/core/word_operations.hpp>
+#include <aarith/integer/integer_divider.hpp>
+#include <aarith/integer/integer_operations.hpp>
+#include <aarith/integer/integers.hpp>
+
+#include <array>
+#include <cstdint>
+
+namespace aarith {
+
+namespace implementation {
+
+/**
+ * @brief Creates an unsigned integer holding a constant (truncated to the width of the integer)
+ *
+ * @tparam I The unsigned integer type
+ * @param value The constant
+ * @return The constant as unsigned integer
+ */
+template <typename I> [[nodiscard]] constexpr I uinteger_from_constant(const uint64_t value)
+{
+    using WordType = typename I::word_type;
+    constexpr size_t word_width = bits_per_word<WordType>();
+
+    I result;
+    for (size_t i = 0; i < I::word_count() && i * word_width < 64; ++i)
+    {
+        result.set_word(i, static_cast<WordType>(value >> (i * word_width)));
+    }
+    return result;
+}
+
+/**
+ * @brief A non-zero digit of the canonical signed digit representation of a constant
+ */
+struct csd_digit
+{
+    size_t shift{0};
+    bool negative{false};
+};
+
+/**
+ * @brief The canonical signed digit representation (non-adjacent form) of a constant
+ *
+ * The constant is written as sum of +/- 2^shift such that no two non-zero digits are adjacent.
+ * This representation has the minimal number of non-zero digits.
+ */
+struct csd_representation
+{
+    std::array<csd_digit, 65> digits{};
+    size_t count{0};
+};
+
+/**
+ * @brief Computes the canonical signed digit representation of a constant
+ *
+ * @param c The constant
+ * @return The non-zero digits of the representation
+ */
+[[nodiscard]] constexpr csd_representation compute_csd(const uint64_t c)
+{
+    csd_representation csd;
+    bool carry = false;
+    for (size_t i = 0; i < 65; ++i)
+    {
+        const auto bit = static_cast<unsigned>((i < 64) ? (c >> i) & 1U : 0U) + (carry ? 1U : 0U);
+        const auto next = static_cast<unsigned>((i + 1 < 64) ? (c >> (i + 1)) & 1U : 0U);
+        if (bit == 1U)
+        {
+            // a block of ones ...0111 is replaced by ...100(-1)
+            const bool negative = (next == 1U);
+            csd.digits[csd.count] = csd_digit{i, negative};
+            ++csd.count;
+            carry = negative;
+        }
+        else
+        {
+            carry = (bit == 2U);
+        }
+    }
+    return csd;
+}
+
+/**
+ * @brief Computes the ceiling of the binary logarithm of a constant
+ */
+[[nodiscard]] constexpr size_t ceil_log2(const uint64_t c)
+{
+    size_t l = 0;
+    while (l < 64 && (uint64_t{1U} << l) < c)
+    {
+        ++l;
+    }
+    return l;
+}
+
+/**
+ * @brief Checks whether a constant is smaller than 2^width
+ */
+[[nodiscard]] constexpr bool constant_fits_width(const uint64_t c, const size_t width)
+{
+    return width >= 64 || (c >> width) == 0U;
+}
+
+} // namespace implementation
+
+/**
+ * @brief Multiplies an unsigned integer with a constant known at compile time
+ *
+ * Numbers that fit into native integers are multiplied natively. Otherwise, constants whose
+ * canonical signed digit representation has at most two non-zero digits (e.g., 3, 10, 2^k - 1)
+ * are multiplied by shifts and additions/subtractions, all other constants by a multiplication
+ * with a single word (or a general multiplication if the constant does not fit into a word).
+ *
+ * @note The result is computed modulo 2^W.
+ *
+ * @tparam C The constant factor
+ * @tparam W The bit width of the number
+ * @param x The number to multiply
+ * @return The product of x and C
+ */
+template <uint64_t C, size_t W, typename WordType>
+[[nodiscard]] constexpr uinteger<W, WordType> mul_const(const uinteger<W, WordType>& x)
+{
+    using I = uinteger<W, WordType>;
+    constexpr implementation::csd_representation csd = implementation::compute_csd(C);
+
+    if constexpr (C == 0U)
+    {
+        return I::zero();
+    }
+    else if constexpr (implementation::has_native_width<I>)
+    {
+        using N = implementation::native_uint_t<W>;
+        return implementation::from_native<I>(static_cast<N>(implementation::to_native(x) *
+                                                             static_cast<N>(C)));
+    }
+    else if constexpr (csd.count <= 2)
+    {
+        I result = I::zero();
+        for (size_t i = 0; i < csd.count; ++i)
+        {
+            const I term = x << csd.digits[i].shift;
+            result = csd.digits[i].negative ? sub(result, term) : add(result, term);
+        }
+        return result;
+    }
+    else
+    {
+        return mul(x, implementation::uinteger_from_constant<I>(C));
+    }
+}
+
+/**
+ * @brief Multiplies a signed integer with a constant known at compile time
+ *
+ * @note The result is computed modulo 2^W.
+ *
+ * @tparam C The constant factor
+ * @tparam W The bit width of the number
+ * @param x The number to multiply
+ * @return The product of x and C
+ */
+template <int64_t C, size_t W, typename WordType>
+[[nodiscard]] constexpr integer<W, WordType> mul_const(const integer<W, WordType>& x)
+{
+    // the product modulo 2^W only depends on the bits of the factors
+    constexpr uint64_t magnitude = (C < 0) ? uint64_t{0U} - static_cast<uint64_t>(C)
+                                           : static_cast<uint64_t>(C);
+    const integer<W, WordType> product{mul_const<magnitude>(uinteger<W, WordType>{x})};
+    if constexpr (C < 0)
+    {
+        return negate(product);
+    }
+    else
+    {
+        return product;
+    }
+}
+
+/**
+ * @brief Divides an unsigned integer by a constant known at compile time
+ *
+ * Powers of two are handled by shifts. If the product of the number and a (W+1) bit number fits
+ * into a native integer, the quotient is computed as floor(x * m / 2^(W+l)) with the magic number
+ * m = ceil(2^(W+l) / D) and l = ceil(log2(D)). Otherwise, an uinteger_divider is created for the
+ * divisor at compile time.
+ *
+ * @see Torbjörn Granlund, Peter L. Montgomery: Division by Invariant Integers using
+ * Multiplication
+ *
+ * @tparam D The constant non-zero divisor
+ * @tparam W The bit width of the number
+ * @param x The number to divide
+ * @return The quotient floor(x / D)
+ */
+template <uint64_t D, size_t W, typename WordType>
+[[nodiscard]] constexpr uinteger<W, WordType> div_const(const uinteger<W, WordType>& x)
+{
+    static_assert(D != 0U, "Attempted division by zero");
+
+    using I = uinteger<W, WordType>;
+    constexpr size_t l = implementation::ceil_log2(D);
+
+    if constexpr ((D & (D - 1U)) == 0U)
+    {
+        return (l >= W) ? I::zero() : (x >> l);
+    }
+    else if constexpr (!implementation::constant_fits_width(D, W))
+    {
+        return I::zero();
+    }
+    else if constexpr (2 * W + 1 <= implementation::max_native_width)
+    {
+        using N = implementation::native_uint_t<2 * W + 1>;
+        constexpr N magic = ((N{1U} << (W + l)) + N{D} - N{1U}) / N{D};
+        return implementation::from_native<I>(
+            static_cast<N>((static_cast<N>(implementation::to_native(x)) * magic) >> (W + l)));
+    }
+    else
+    {
+        constexpr uinteger_divider<W, WordType> divider{
+            implementation::uinteger_from_constant<I>(D)};
+        return divider.div(x);
+    }
+}
+
+/**
+ * @brief Computes the remainder of the division of an unsigned integer by a constant known at
+ * compile time
+ *
+ * @tparam D The constant non-zero divisor
+ * @tparam W The bit width of the number
+ * @param x The number to divide
+ * @return The remainder x mod D
+ */
+template <uint64_t D, size_t W, typename WordType>
+[[nodiscard]] constexpr uinteger<W, WordType> rem_const(const uinteger<W, WordType>& x)
+{
+    static_assert(D != 0U, "Attempted division by zero");
+
+    if constexpr (!implementation::constant_fits_width(D, W))
+    {
+        return x;
+    }
+    else
+    {
+        return sub(x, mul_const<D>(div_const<D>(x)));
+    }
+}
+
+/**
+ * @brief Divides a signed integer by a constant known at compile time
+ *
+ * The quotient is rounded towards zero, just like for div.
+ *
+ * @tparam D The constant non-zero divisor
+ * @tparam W The bit width of the number
+ * @param x The number to divide
+ * @return The quotient of x and D
+ */
+template <int64_t D, size_t W, typename WordType>
+[[nodiscard]] constexpr integer<W, WordType> div_const(const integer<W, WordType>& x)
+{
+    static_assert(D != 0, "Attempted division by zero");
+
+    constexpr uint64_t magnitude = (D < 0) ? uint64_t{0U} - static_cast<uint64_t>(D)
+                                           : static_cast<uint64_t>(D);
+    const integer<W, WordType> quotient{div_const<magnitude>(expanding_abs(x))};
+    return (x.is_negative() != (D < 0)) ? negate(quotient) : quotient;
+}
+
+/**
+ * @brief Computes the remainder of the division of a signed integer by a constant known at
+ * compile time
+ *
+ * The remainder has the sign of the number, just like for remainder.
+ *
+ * @tparam D The constant non-zero divisor
+ * @tparam W The bit width of the number
+ * @param x The number to divide
+ * @return The remainder of the division of x by D
+ */
+template <int64_t D, size_t W, typename WordType>
+[[nodiscard]] constexpr integer<W, WordType> rem_const(const integer<W, WordType>& x)
+{
+    static_assert(D != 0, "Attempted division by zero");
+
+    constexpr uint64_t magnitude = (D < 0) ? uint64_t{0U} - static_cast<uint64_t>(D)
+                                           : static_cast<uint64_t>(D);
+    const integer<W, WordType> rem{rem_const<magnitude>(expanding_abs(x))};
+    return x.is_negative() ? negate(rem) : rem;
+}
+
+} // namespace aarith
@@ -0,0 +1,239 @@
+#pragma once
+
+#include <aarith/core/word_operations.hpp>
+#include <aarith/integer/integer_comparisons.hpp>
+#include <aarith/integer/integer_operations.hpp>
+#include <aarith/integer/integers.hpp>
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <utility>
+
+namespace aarith {
+
+/**
+ * @brief Divides unsigned integers by a fixed divisor
+ *
+ * The divisor is analyzed once when the divider is constructed: it is normalized such that the
+ * most significant bit of its most significant word is set and the reciprocal of this word is
+ * precomputed. Every division then estimates the quotient words using two multiplications instead
+ * of a hardware division. Divisors fitting into a single word are handled by a single pass over
+ * the words of the numerator, longer divisors by Knuth's Algorithm D.
+ *
+ * @see Niels Möller, Torbjörn Granlund: Improved division by invariant integers
+ *
+ * @tparam W The bit width of the numerators and the divisor
+ * @tparam WordType The word type
+ */
+template <size_t W, typename WordType = uint64_t> class uinteger_divider
+{
+public:
+    using value_type = uinteger<W, WordType>;
+
+    /**
+     * @brief Creates the divider for the given divisor
+     *
+     * @param divisor The non-zero divisor
+     */
+    explicit constexpr uinteger_divider(const value_type& divisor)
+        : divisor_{divisor}
+        , divisor_words{implementation::copy_words(divisor)}
+    {
+        if (divisor.is_zero())
+        {
+            throw std::runtime_error("Attempted division by zero");
+        }
+
+        constexpr size_t word_width = implementation::bits_per_word<WordType>();
+
+        significant_words = words;
+        while (divisor_words[significant_words - 1] == WordType{0U})
+        {
+            --significant_words;
+        }
+
+        const WordType top = divisor_words[significant_words - 1];
+        shift = implementation::count_leading_zeroes_word(top);
+        normalized_top = static_cast<WordType>(top << shift);
+        if (shift > 0 && significant_words > 1)
+        {
+            normalized_top |=
+                static_cast<WordType>(divisor_words[significant_words - 2] >> (word_width - shift));
+        }
+        reciprocal = implementation::reciprocal_word(normalized_top);
+    }
+
+    /**
+     * @brief Returns the divisor
+     */
+    [[nodiscard]] constexpr const value_type& divisor() const
+    {
+        return divisor_;
+    }
+
+    /**
+     * @brief Computes the quotient and the remainder of the division by the divisor
+     *
+     * @param numerator The number that is divided
+     * @return Pair of quotient and remainder
+     */
+    [[nodiscard]] constexpr std::pair<value_type, value_type>
+    divmod(const value_type& numerator) const
+    {
+        if (numerator < divisor_)
+        {
+            return {value_type::zero(), numerator};
+        }
+
+        const auto numerator_words = implementation::copy_words(numerator);
+        implementation::word_storage_t<WordType, words> quotient_words{};
+        implementation::word_storage_t<WordType, words> remainder_words{};
+
+        if (significant_words == 1)
+        {
+            remainder_words[0] =
+                implementation::divmod_word_preinv(quotient_words.data(), numerator_words.data(),
+                                                   words, normalized_top, shift, reciprocal);
+        }
+        else if constexpr (words > 1)
+        {
+            size_t m = words;
+            while (numerator_words[m - 1] == WordType{0U})
+            {
+                --m;
+            }
+
+            // the number of significant words is bounded explicitly to help the compiler's
+            // array bounds analysis
+            const size_t n = std::min(significant_words, words);
+
+            implementation::word_storage_t<WordType, words + 1> un{};
+            implementation::word_storage_t<WordType, words> vn{};
+            implementation::divmod_words(quotient_words.data(), remainder_words.data(),
+                                         numerator_words.data(), m, divisor_words.data(), n,
+                                         un.data(), vn.data(), reciprocal);
+        }
+
+        value_type quotient;
+        value_type remainder;
+        for (size_t i = 0; i < words; ++i)
+        {
+            quotient.set_word(i, quotient_words[i]);
+            remainder.set_word(i, remainder_words[i]);
+        }
+        return {quotient, remainder};
+    }
+
+    /**
+     * @brief Divides a number by the divisor
+     *
+     * @param numerator The number that is divided
+     * @return The quotient
+     */
+    [[nodiscard]] constexpr value_type div(const value_type& numerator) const
+    {
+        return divmod(numerator).first;
+    }
+
+    /**
+     * @brief Computes the remainder of the division of a number by the divisor
+     *
+     * @param numerator The number that is divided
+     * @return The remainder
+     */
+    [[nodiscard]] constexpr value_type remainder(const value_type& numerator) const
+    {
+        return divmod(numerator).second;
+    }
+
+private:
+    static constexpr size_t words = value_type::word_count();
+
+    value_type divisor_;
+    implementation::word_storage_t<WordType, words> divisor_words;
+    size_t significant_words{0};
+    size_t shift{0};
+    WordType normalized_top{0U};
+    WordType reciprocal{0U};
+};
+
+/**
+ * @brief Divides signed integers by a fixed divisor
+ *
+ * The magnitudes are divided using an uinteger_divider. The quotient is rounded towards zero and
+ * the remainder has the sign of the numerator, just like for div and remainder.
+ *
+ * @tparam W The bit width of the numerators and the divisor
+ * @tparam WordType The word type
+ */
+template <size_t W, typename WordType = uint64_t> class integer_divider
+{
+public:
+    using value_type = integer<W, WordType>;
+
+    /**
+     * @brief Creates the divider for the given divisor
+     *
+     * @param divisor The non-zero divisor
+     */
+    explicit constexpr integer_divider(const value_type& divisor)
+        : divisor_{divisor}
+        , magnitude{expanding_abs(divisor)}
+    {
+    }
+
+    /**
+     * @brief Returns the divisor
+     */
+    [[nodiscard]] constexpr const value_type& divisor() const
+    {
+        return divisor_;
+    }
+
+    /**
+     * @brief Computes the quotient and the remainder of the division by the divisor
+     *
+     * @param numerator The number that is divided
+     * @return Pair of quotient and remainder
+     */
+    [[nodiscard]] constexpr std::pair<value_type, value_type>
+    divmod(const value_type& numerator) const
+    {
+        const bool negative = numerator.is_negative();
+        const auto [q, r] = magnitude.divmod(expanding_abs(numerator));
+
+        const value_type quotient{q};
+        const value_type remainder{r};
+        return {(negative != divisor_.is_negative()) ? negate(quotient) : quotient,
+                negative ? negate(remainder) : remainder};
+    }
+
+    /**
+     * @brief Divides a number by the divisor
+     *
+     * @param numerator The number that is divided
+     * @return The quotient (rounded towards zero)
+     */
+    [[nodiscard]] constexpr value_type div(const value_type& numerator) const
+    {
+        return divmod(numerator).first;
+    }
+
+    /**
+     * @brief Computes the remainder of the division of a number by the divisor
+     *
+     * @param numerator The number that is divided
+     * @return The remainder (with the sign of the numerator)
+     */
+    [[nodiscard]] constexpr value_type remainder(const value_type& numerator) const
+    {
+        return divmod(numerator).second;
+    }
+
+private:
+    value_type divisor_;
+    uinteger_divider<W, WordType> magnitude;
+};
+
+} // namespace aarith
@@ -0,0 +1,249 @@
+#pragma once
+
+#include <aarith/core/word_operations.hpp>
+#include <aarith/integer/integer_divider.hpp>
+#include <aarith/integer/integer_operations.hpp>
+#include <aarith/integer/integers.hpp>
+
+#include <array>
+#include <stdexcept>
+
+namespace aarith {
+
+/**
+ * @brief Precomputed data for Montgomery arithmetic modulo a fixed odd modulus
+ *
+ * Numbers are represented in Montgomery form, i.e., the number x is stored as x * R mod N where R
+ * is 2^(word count * word width) and N is the modulus. In this representation, modular
+ * multiplications need no division at all: the double length product is reduced by adding
+ * multiples of N that clear its lower half word by word.
+ *
+ * The context precomputes -N^(-1) mod 2^(word width) and R^2 mod N (using a single division when
+ * the context is constructed).
+ *
+ * @see Peter L. Montgomery: Modular multiplication without trial division
+ *
+ * @tparam W The bit width of the modulus
+ * @tparam WordType The word type
+ */
+template <size_t W, typename WordType = uint64_t> class montgomery_context
+{
+public:
+    using value_type = uinteger<W, WordType>;
+
+    /**
+     * @brief Creates the context for the given modulus
+     *
+     * @param modulus The odd modulus
+     */
+    explicit constexpr montgomery_context(const value_type& modulus)
+        : modulus_{modulus}
+        , modulus_words{implementation::copy_words(modulus)}
+    {
+        if (!modulus.bit(0))
+        {
+            throw std::invalid_argument("Montgomery arithmetic requires an odd modulus");
+        }
+
+        m_neg_inverse =
+            static_cast<WordType>(WordType{0U} - implementation::inverse_word(modulus.word(0)));
+
+        // R^2 mod N is needed to convert numbers into Montgomery form
+        constexpr size_t r_width = words * implementation::bits_per_word<WordType>();
+        using D = uinteger<2 * r_width + 1, WordType>;
+        const D r_squared_wide = D::one() << (2 * r_width);
+        r_squared = width_cast<W>(remainder(r_squared_wide, width_cast<2 * r_width + 1>(modulus)));
+        one_ = from_mont(r_squared);
+    }
+
+    /**
+     * @brief Returns the modulus
+     */
+    [[nodiscard]] constexpr const value_type& modulus() const
+    {
+        return modulus_;
+    }
+
+    /**
+     * @brief Returns the Montgomery form of one (i.e., R mod N)
+     */
+    [[nodiscard]] constexpr const value_type& one() const
+    {
+        return one_;
+    }
+
+    /**
+     * @brief Converts a number into Montgomery form
+     *
+     * @param x The number to convert, it is reduced modulo N if necessary
+     * @return The Montgomery form x * R mod N
+     */
+    [[nodiscard]] constexpr value_type to_mont(const value_type& x) const
+    {
+        return mont_mul((x < modulus_) ? x : remainder(x, modulus_), r_squared);
+    }
+
+    /**
+     * @brief Converts a number out of Montgomery form
+     *
+     * @param x The Montgomery form of a number
+     * @return The number x * R^(-1) mod N
+     */
+    [[nodiscard]] constexpr value_type from_mont(const value_type& x) const
+    {
+        implementation::word_storage_t<WordType, 2 * words + 1> t{};
+        for (size_t i = 0; i < words; ++i)
+        {
+            t[i] = x.word(i);
+        }
+        return reduce(t);
+    }
+
+    /**
+     * @brief Multiplies two numbers in Montgomery form
+     *
+     * @param a First factor in Montgomery form (less than N)
+     * @param b Second factor in Montgomery form (less than N)
+     * @return The Montgomery form of the product
+     */
+    [[nodiscard]] constexpr value_type mont_mul(const value_type& a, const value_type& b) const
+    {
+        implementation::word_storage_t<WordType, 2 * words + 1> t{};
+        if constexpr (W >= AARITH_TOOM3_THRESHOLD)
+        {
+            if (!implementation::is_constant_evaluated())
+            {
+                const auto product = expanding_mul(a, b);
+                for (size_t i = 0; i < product.word_count(); ++i)
+                {
+                    t[i] = product.word(i);
+                }
+                return reduce(t);
+            }
+        }
+
+        const auto a_words = implementation::copy_words(a);
+        const auto b_words = implementation::copy_words(b);
+        implementation::mul_words(t.data(), a_words.data(), words, b_words.data(), words);
+        return reduce(t);
+    }
+
+    /**
+     * @brief Squares a number in Montgomery form
+     *
+     * @param a The number in Montgomery form (less than N)
+     * @return The Montgomery form of the square
+     */
+    [[nodiscard]] constexpr value_type mont_sqr(const value_type& a) const
+    {
+        implementation::word_storage_t<WordType, 2 * words + 1> t{};
+        if constexpr (W >= AARITH_TOOM3_THRESHOLD)
+        {
+            if (!implementation::is_constant_evaluated())
+            {
+                const auto product = expanding_square(a);
+                for (size_t i = 0; i < product.word_count(); ++i)
+                {
+                    t[i] = product.word(i);
+                }
+                return reduce(t);
+            }
+        }
+
+        const auto a_words = implementation::copy_words(a);
+        implementation::square_words(t.data(), a_words.data(), words);
+        return reduce(t);
+    }
+
+    /**
+     * @brief Computes the power of a number in Montgomery form
+     *
+     * @tparam E The bit width of the exponent
+     * @param a The base in Montgomery form (less than N)
+     * @param exponent The exponent
+     * @return The Montgomery form of a^exponent
+     */
+    template <size_t E>
+    [[nodiscard]] constexpr value_type mont_pow(const value_type& a,
+                                                const uinteger<E, WordType>& exponent) const
+    {
+        const size_t exponent_bits = E - count_leading_zeroes(exponent);
+        return implementation::sliding_window_pow(
+            a, one_, exponent_bits, [&exponent](const size_t i) { return exponent.bit(i) != 0U; },
+            [this](const value_type& x, const value_type& y) { return mont_mul(x, y); },
+            [this](const value_type& x) { return mont_sqr(x); });
+    }
+
+private:
+    static constexpr size_t words = value_type::word_count();
+
+    [[nodiscard]] constexpr value_type
+    reduce(implementation::word_storage_t<WordType, 2 * words + 1>& t) const
+    {
+        implementation::word_storage_t<WordType, words> reduced{};
+        implementation::montgomery_reduce_words(reduced.data(), t.data(), modulus_words.data(),
+                                                words, m_neg_inverse);
+        value_type result;
+        for (size_t i = 0; i < words; ++i)
+        {
+            result.set_word(i, reduced[i]);
+        }
+        return result;
+    }
+
+    value_type modulus_;
+    implementation::word_storage_t<WordType, words> modulus_words;
+    WordType m_neg_inverse{0U};
+    value_type r_squared;
+    value_type one_;
+};
+
+/**
+ * @brief Modular exponentiation
+ *
+ * Computes base^exponent mod modulus using sliding window exponentiation. For odd moduli, the
+ * computation is performed in Montgomery form (see montgomery_context). Otherwise, every
+ * intermediate product is reduced modulo the modulus using an uinteger_divider.
+ *
+ * @tparam W The bit width of the base and the modulus
+ * @tparam E The bit width of the exponent
+ * @param base The base
+ * @param exponent The exponent
+ * @param modulus The modulus
+ * @return base^exponent mod modulus
+ */
+template <std::size_t W, std::size_t E, typename WordType>
+[[nodiscard]] constexpr uinteger<W, WordType> pow_mod(const uinteger<W, WordType>& base,
+                                                      const uinteger<E, WordType>& exponent,
+                                                      const uinteger<W, WordType>& modulus)
+{
+    using I = uinteger<W, WordType>;
+    using D = uinteger<2 * W, WordType>;
+
+    if (modulus.is_zero())
+    {
+        throw std::runtime_error("Attempted division by zero");
+    }
+    if (modulus == I::one())
+    {
+        return I::zero();
+    }
+
+    if (modulus.bit(0))
+    {
+        const montgomery_context<W, WordType> context{modulus};
+        return context.from_mont(context.mont_pow(context.to_mont(base), exponent));
+    }
+
+    const uinteger_divider<2 * W, WordType> divider{width_cast<2 * W>(modulus)};
+    const auto reduce = [&divider](const D& x) { return width_cast<W>(divider.remainder(x)); };
+
+    const size_t exponent_bits = E - count_leading_zeroes(exponent);
+    return implementation::sliding_window_pow(
+        remainder(base, modulus), I::one(), exponent_bits,
+        [&exponent](const size_t i) { return exponent.bit(i) != 0U; },
+        [&reduce](const I& a, const I& b) { return reduce(expanding_mul(a, b)); },
+        [&reduce](const I& a) { return reduce(expanding_square(a)); });
+}
+
+} // namespace aarith
@@ -1,6 +1,10 @@
 #pragma once
 #include <aarith/core/traits.hpp>
+#include <aarith/core/word_array_shift_operations.hpp>
+#include <aarith/core/word_multiplication.hpp>
+#include <aarith/core/word_operations.hpp>
 #include <aarith/integer/integers.hpp>
+#include <array>
 #include <type_traits>
 
 namespace aarith {
@@ -30,21 +34,20 @@ template <typename I, typename T>
 
     using word_type = typename decltype(a_)::word_type; // weird but works O_0
 
+    if constexpr (implementation::has_native_width<decltype(a_)>)
+    {
+        const auto carry = initial_carry ? 1U : 0U;
+        return implementation::from_native<decltype(a_)>(implementation::to_native(a_) +
+                                                         implementation::to_native(b_) + carry);
+    }
+
     decltype(a_) sum{0U};
 
     word_type carry = initial_carry ? word_type{1U} : word_type{0U};
 
     for (auto i = 0U; i < sum.word_count(); ++i)
     {
-
-        word_type word_a{a_.word(i)};
-        word_type word_b{b_.word(i)};
-
-        word_type partial_sum = word_a + word_b;
-        word_type new_carry = (partial_sum < word_a || partial_sum < word_b) ? 1U : 0U;
-        partial_sum += carry;
-        carry = (new_carry || partial_sum < word_a || partial_sum < word_b) ? 1U : 0U;
-        sum.set_word(i, partial_sum);
+        sum.set_word(i, implementation::add_carry(a_.word(i), b_.word(i), carry, carry));
     }
     return sum;
 }
@@ -74,10 +77,22 @@ template <typename I> [[nodiscard]] constexpr auto sub(const I& a, const I& b) -
         const auto result = I{static_cast<typename I::word_type>(a.word(0) - b.word(0))};
         return result;
     }
+    else if constexpr (implementation::has_native_width<I>)
+    {
+        return implementation::from_native<I>(implementation::to_native(a) -
+                                              implementation::to_native(b));
+    }
     else
     {
-        auto result = expanding_add(a, ~b, true);
-        return width_cast<W>(result);
+        using word_type = typename I::word_type;
+
+        I result;
+        word_type borrow{0U};
+        for (auto i = 0U; i < result.word_count(); ++i)
+        {
+            result.set_word(i, implementation::sub_borrow(a.word(i), b.word(i), borrow, borrow));
+        }
+        return result;
     }
 }
 
@@ -126,19 +141,32 @@ template <typename I> [[nodiscard]] I constexpr add(const I& a, const I& b)
         const auto result = I{static_cast<typename I::word_type>(a.word(0) + b.word(0))};
         return result;
     }
+    else if constexpr (implementation::has_native_width<I>)
+    {
+        return implementation::from_native<I>(implementation::to_native(a) +
+                                              implementation::to_native(b));
+    }
     else
     {
-        const auto result = expanding_add<I, I>(a, b);
-        return width_cast<W>(result);
+        using word_type = typename I::word_type;
+
+        I result;
+        word_type carry{0U};
+        for (auto i = 0U; i < result.word_count(); ++i)
+        {
+            result.set_word(i, implementation::add_carry(a.word(i), b.word(i), carry, carry));
+        }
+        return result;
     }
 }
 
 /**
  * @brief Multiplies two unsigned integers expanding the bit width so that the result fits.
  *
- * This implements the simplest multiplication algorithm (binary "long multiplication") that adds up
- * the partial products everywhere where the first multiplicand has a 1 bit. The simplicity, of
- * course, comes at the cost of performance.
+ * This implements the simplest multiplication algorithm ("long multiplication") on the level of
+ * words: Every word of the first multiplicand is multiplied with every word of the second
+ * multiplicand using a single word times word to double word multiplication. The partial products
+ * are accumulated at the corresponding word positions.
  *
  * @tparam W The bit width of the first multiplicand
  * @tparam V The bit width of the second multiplicand
@@ -154,25 +182,33 @@ schoolbook_expanding_mul(const uinteger<W, WordType>& a, const uinteger<V, WordT
     constexpr std::size_t res_width = W + V;
     uinteger<res_width, WordType> result{0U};
 
-    if constexpr (res_width <= uinteger<W, WordType>::word_width())
+    if constexpr (implementation::has_native_width<uinteger<res_width, WordType>>)
     {
-        auto result_uint = a.word(0) * b.word(0);
-        result.set_word(0, result_uint);
+        using N = implementation::native_uint_t<res_width>;
+        const auto native_a = static_cast<N>(implementation::to_native(a));
+        const auto native_b = static_cast<N>(implementation::to_native(b));
+        const N product = native_a * native_b;
+        result = implementation::from_native<uinteger<res_width, WordType>>(product);
     }
     else
     {
         static_assert(::aarith::is_integral_v<uinteger<res_width, WordType>>);
         static_assert(::aarith::is_unsigned_v<uinteger<res_width, WordType>>);
 
-        const auto leading_zeroes = V - count_leading_zeroes(b);
-        uinteger<res_width, WordType> a_ = width_cast<res_width>(a);
+        constexpr size_t words_a = uinteger<W, WordType>::word_count();
+        constexpr size_t words_b = uinteger<V, WordType>::word_count();
+
+        const auto a_words = implementation::copy_words(a);
+        const auto b_words = implementation::copy_words(b);
+
+        implementation::word_storage_t<WordType, words_a + words_b> product{};
+        implementation::mul_words(product.data(), a_words.data(), words_a, b_words.data(),
+                                  words_b);
 
-        for (auto bit_index = 0U; bit_index < leading_zeroes; ++bit_index)
+        // the product of the words might have one more word than necessary to store W+V bits
+        for (size_t i = 0; i < result.word_count(); ++i)
         {
-            if (b.bit(bit_index))
-            {
-                result = add(result, a_ << bit_index);
-            }
+            result.set_word(i, product[i]);
         }
     }
     return result;
@@ -184,7 +220,8 @@ schoolbook_expanding_mul(const uinteger<W, WordType>& a, const uinteger<V, WordT
  * @note No Type conversion is performed. If the bit widths do not match, the code will not
  * compile! Use @see booth_expanding_mul for that.
  *
- * The result is then cropped to fit the initial bit width
+ * The result is then cropped to fit the initial bit width. Only the partial products that
+ * contribute to the words of the cropped result are computed.
  *
  * @tparam I The integer type to operate on
  * @param a First multiplicand
@@ -194,19 +231,31 @@ schoolbook_expanding_mul(const uinteger<W, WordType>& a, const uinteger<V, WordT
 template <typename I, typename = std::enable_if_t<is_integral_v<I> && is_unsigned_v<I>>>
 [[nodiscard]] constexpr I schoolbook_mul(const I& a, const I& b)
 {
-
-    constexpr size_t W = I::width();
-
-    // if the number completely fits into the word, we can simply use the default implementation
-    // of the multiplication on the basis WordType
-    if constexpr (W <= I::word_width())
+    // if the number completely fits into a native integer, we can simply use the default
+    // implementation of the multiplication on the native type
+    if constexpr (implementation::has_native_width<I>)
     {
-        const I result{static_cast<typename I::word_type>(a.word(0) * b.word(0))};
-        return result;
+        return implementation::from_native<I>(implementation::to_native(a) *
+                                              implementation::to_native(b));
     }
     else
     {
-        return width_cast<W>(schoolbook_expanding_mul(a, b));
+        using word_type = typename I::word_type;
+        constexpr size_t words = I::word_count();
+
+        const auto a_words = implementation::copy_words(a);
+        const auto b_words = implementation::copy_words(b);
+
+        implementation::word_storage_t<word_type, words> product{};
+        implementation::mul_words_truncated(product.data(), words, a_words.data(),
+                                            b_words.data());
+
+        I result;
+        for (size_t i = 0; i < words; ++i)
+        {
+            result.set_word(i, product[i]);
+        }
+        return result;
     }
 }
 
@@ -214,7 +263,10 @@ template <typename I, typename = std::enable_if_t<is_integral_v<I> && is_unsigne
  * @brief Multiplies two unsigned integers using the Karazuba algorithm expanding the bit width so
  * that the result fits.
  *
- * This implements the karazuba multiplication algorithm (divide and conquer).
+ * This implements the karazuba multiplication algorithm (divide and conquer) on the words of the
+ * integers. Factors of less than AARITH_KARATSUBA_THRESHOLD bits are multiplied using the
+ * schoolbook method. All intermediate values are stored in a single scratch buffer that is
+ * allocated once, factors of different widths are multiplied without widening the smaller one.
  *
  * @tparam W The bit width of the first multiplicant
  * @tparam V The bit width of the second multiplicant
@@ -226,7 +278,6 @@ template <std::size_t W, std::size_t V, typename WordType>
 [[nodiscard]] constexpr uinteger<W + V, WordType> expanding_karazuba(const uinteger<W, WordType>& a,
                                                                      const uinteger<V, WordType>& b)
 {
-
     constexpr std::size_t res_width = W + V;
     if constexpr (res_width <= uinteger<W, WordType>::word_width())
     {
@@ -234,67 +285,113 @@ template <std::size_t W, std::size_t V, typename WordType>
         const uinteger<res_width, WordType> result(result_uint);
         return result;
     }
-    else if constexpr (W == V)
+    else
     {
-        if (a.is_zero() || b.is_zero())
-        {
-            return uinteger<res_width, WordType>::zero();
-        }
-
-        // floor to the next value with power of 2
-        // std::log2 and std::floor  not constexpr and did not compile with clang
-        constexpr size_t floor_pow_two = floor_to_pow(W);
-
-        constexpr size_t karazuba_width =
-            (floor_pow_two == W) ? (floor_pow_two >> 1U) : (floor_pow_two);
-
-        const auto a_split = split<karazuba_width - 1>(a);
-        const auto b_split = split<karazuba_width - 1>(b);
-
-        const auto ah = uinteger<W - karazuba_width, WordType>(a_split.first);
-        const auto al = uinteger<karazuba_width, WordType>(a_split.second);
-        const auto bh = uinteger<W - karazuba_width, WordType>(b_split.first);
-        const auto bl = uinteger<karazuba_width, WordType>(b_split.second);
+        using R = uinteger<res_width, WordType>;
+        constexpr size_t words_a = uinteger<W, WordType>::word_count();
+        constexpr size_t words_b = uinteger<V, WordType>::word_count();
+        constexpr size_t scratch_words =
+            implementation::karatsuba_scratch_words<WordType>(words_a, words_b);
 
-        const auto p1 = expanding_karazuba<W - karazuba_width, W - karazuba_width>(ah, bh);
-        const auto p2 = expanding_karazuba<karazuba_width, karazuba_width>(al, bl);
-        const auto s1 = expanding_add(ah, al);
-        const auto s2 = expanding_add(bh, bl);
+        const auto a_words = implementation::copy_words(a);
+        const auto b_words = implementation::copy_words(b);
 
-        // prevent infinite call loop
-        // TODO (keszocze) find a better way to do this
-        uinteger<2 * (karazuba_width + 1), WordType> p3;
-        if (s1.bit(s1.width() - 1) == 1 || s2.bit(s2.width() - 1) == 1)
+        implementation::word_storage_t<WordType, words_a + words_b> product{};
+        if constexpr (scratch_words == 0)
         {
-            p3 = expanding_karazuba(s1, s2);
+            implementation::mul_words(product.data(), a_words.data(), words_a, b_words.data(),
+                                      words_b);
         }
         else
         {
-            const auto ps1 = width_cast<karazuba_width>(s1);
-            const auto ps2 = width_cast<karazuba_width>(s2);
-            const auto p3t = expanding_karazuba(ps1, ps2);
-            p3 = p3t;
+            implementation::word_storage_t<WordType, scratch_words> scratch{};
+            implementation::mul_words_karatsuba(product.data(), a_words.data(), words_a,
+                                                b_words.data(), words_b, scratch.data());
         }
 
-        constexpr auto full_shift = 2 * karazuba_width;
-        const auto k1 = width_cast<res_width>(p1) << full_shift;
-        const auto k2 = width_cast<res_width>(expanding_sub(p3, expanding_add(p1, p2)))
-                        << karazuba_width;
-        const auto product = expanding_add(k1, expanding_add(k2, p2));
-
-        return width_cast<res_width>(product);
+        R result;
+        for (size_t i = 0; i < R::word_count(); ++i)
+        {
+            result.set_word(i, product[i]);
+        }
+        return result;
     }
-    else
-    {
-        constexpr std::size_t max_width = std::max(W, V);
+}
 
-        const auto a_ = width_cast<max_width>(a);
-        const auto b_ = width_cast<max_width>(b);
+/**
+ * @brief Multiplies two unsigned integers using the Toom-Cook 3 algorithm expanding the bit width
+ * so that the result fits.
+ *
+ * The numbers are split into three parts each. The five pointwise products are computed
+ * recursively, choosing the algorithm based on their sizes (see AARITH_TOOM3_THRESHOLD and
+ * AARITH_TOOM4_THRESHOLD), and the product is recovered by exact interpolation.
+ *
+ * @note This function is not constexpr as it needs dynamically allocated scratch memory.
+ *
+ * @tparam W The bit width of the first multiplicand
+ * @tparam V The bit width of the second multiplicand
+ * @param a First multiplicand
+ * @param b Second multiplicand
+ * @return Product of a and b
+ */
+template <std::size_t W, std::size_t V, typename WordType>
+[[nodiscard]] uinteger<W + V, WordType> expanding_toom3(const uinteger<W, WordType>& a,
+                                                        const uinteger<V, WordType>& b)
+{
+    const auto product = implementation::mul_words_toom(implementation::to_word_vector(a),
+                                                        implementation::to_word_vector(b), 3);
+    return implementation::from_word_vector<uinteger<W + V, WordType>>(product);
+}
 
-        const auto res = expanding_karazuba(a_, b_);
+/**
+ * @brief Multiplies two unsigned integers using the Toom-Cook 4 algorithm expanding the bit width
+ * so that the result fits.
+ *
+ * The numbers are split into four parts each. The seven pointwise products are computed
+ * recursively, choosing the algorithm based on their sizes (see AARITH_TOOM3_THRESHOLD and
+ * AARITH_TOOM4_THRESHOLD), and the product is recovered by exact interpolation.
+ *
+ * @note This function is not constexpr as it needs dynamically allocated scratch memory.
+ *
+ * @tparam W The bit width of the first multiplicand
+ * @tparam V The bit width of the second multiplicand
+ * @param a First multiplicand
+ * @param b Second multiplicand
+ * @return Product of a and b
+ */
+template <std::size_t W, std::size_t V, typename WordType>
+[[nodiscard]] uinteger<W + V, WordType> expanding_toom4(const uinteger<W, WordType>& a,
+                                                        const uinteger<V, WordType>& b)
+{
+    const auto product = implementation::mul_words_toom(implementation::to_word_vector(a),
+                                                        implementation::to_word_vector(b), 4);
+    return implementation::from_word_vector<uinteger<W + V, WordType>>(product);
+}
 
-        return width_cast<res_width>(res);
-    }
+/**
+ * @brief Multiplies two unsigned integers using number theoretic transforms expanding the bit width
+ * so that the result fits.
+ *
+ * The numbers are split into 64 bit coefficients whose convolution is computed modulo three primes
+ * using number theoretic transforms. The exact convolution is recovered using the Chinese remainder
+ * theorem. This is asymptotically the fastest multiplication in aarith and pays off for very wide
+ * numbers only (see AARITH_NTT_THRESHOLD).
+ *
+ * @note This function is not constexpr as it needs dynamically allocated scratch memory.
+ *
+ * @tparam W The bit width of the first multiplicand
+ * @tparam V The bit width of the second multiplicand
+ * @param a First multiplicand
+ * @param b Second multiplicand
+ * @return Product of a and b
+ */
+template <std::size_t W, std::size_t V, typename WordType>
+[[nodiscard]] uinteger<W + V, WordType> expanding_ntt_mul(const uinteger<W, WordType>& a,
+                                                          const uinteger<V, WordType>& b)
+{
+    const auto product = implementation::mul_words_ntt(implementation::to_word_vector(a),
+                                                       implementation::to_word_vector(b));
+    return implementation::from_word_vector<uinteger<W + V, WordType>>(product);
 }
 
 /**
@@ -366,6 +463,96 @@ restoring_division(const uinteger<W, WordType>& numerator, const uinteger<V, Wor
     return std::make_pair(Q, remainder_);
 }
 
+/**
+ * @brief Implements the long division on the level of words (Knuth's Algorithm D).
+ *
+ * Instead of computing a single bit of the quotient per step, a whole word of the quotient is
+ * estimated using a division of a double word by a single word. Divisors fitting into a single
+ * word are handled by a simpler, dedicated routine.
+ *
+ * @see Donald E. Knuth: The Art of Computer Programming, Volume 2, Section 4.3.1
+ *
+ * @param numerator The number that is to be divided
+ * @param denominator The number that divides the other number
+ * @tparam W Width of the numbers used in division.
+ *
+ * @return Pair of (quotient, remainder)
+ *
+ */
+template <std::size_t W, std::size_t V, typename WordType>
+[[nodiscard]] constexpr std::pair<uinteger<W, WordType>, uinteger<W, WordType>>
+long_division(const uinteger<W, WordType>& numerator, const uinteger<V, WordType>& denominator)
+{
+    using UInteger = uinteger<W, WordType>;
+
+    if (denominator.is_zero())
+    {
+        throw std::runtime_error("Attempted division by zero");
+    }
+
+    // Cover some special cases in order to speed everything up
+    if (numerator.is_zero())
+    {
+        return std::make_pair(UInteger::zero(), UInteger::zero());
+    }
+    if (numerator < denominator)
+    {
+        return std::make_pair(UInteger::zero(), numerator);
+    }
+
+    if constexpr (implementation::has_native_width<UInteger> &&
+                  implementation::has_native_width<uinteger<V, WordType>>)
+    {
+        const auto n = implementation::to_native(numerator);
+        const auto d = implementation::to_native(denominator);
+        return std::make_pair(implementation::from_native<UInteger>(n / d),
+                              implementation::from_native<UInteger>(n % d));
+    }
+
+    constexpr size_t words_n = uinteger<W, WordType>::word_count();
+    constexpr size_t words_d = uinteger<V, WordType>::word_count();
+
+    const auto u = implementation::copy_words(numerator);
+    const auto v = implementation::copy_words(denominator);
+
+    // only the significant words take part in the division
+    size_t m = words_n;
+    while (u[m - 1] == WordType{0U})
+    {
+        --m;
+    }
+    size_t n = words_d;
+    while (v[n - 1] == WordType{0U})
+    {
+        --n;
+    }
+
+    implementation::word_storage_t<WordType, words_n> q{};
+    implementation::word_storage_t<WordType, words_n> r{};
+
+    if (words_d == 1 || n == 1)
+    {
+        r[0] = implementation::divmod_word(q.data(), u.data(), m, v[0]);
+    }
+    else if constexpr (words_d > 1)
+    {
+        implementation::word_storage_t<WordType, words_n + 1> un{};
+        implementation::word_storage_t<WordType, words_d> vn{};
+        implementation::divmod_words(q.data(), r.data(), u.data(), m, v.data(), n, un.data(),
+                                     vn.data());
+    }
+
+    UInteger quotient;
+    UInteger remainder_;
+    for (size_t i = 0; i < words_n; ++i)
+    {
+        quotient.set_word(i, q[i]);
+        remainder_.set_word(i, r[i]);
+    }
+
+    return std::make_pair(quotient, remainder_);
+}
+
 /**
  * @brief Computes the remainder of the division of one integer by another integer
  *
@@ -379,7 +566,14 @@ restoring_division(const uinteger<W, WordType>& numerator, const uinteger<V, Wor
 template <typename I>
 [[nodiscard]] constexpr auto remainder(const I& numerator, const I& denominator) -> I
 {
-    return restoring_division(numerator, denominator).second;
+    if constexpr (is_unsigned_v<I> && I::width() < AARITH_LONG_DIVISION_THRESHOLD)
+    {
+        return restoring_division(numerator, denominator).second;
+    }
+    else
+    {
+        return long_division(numerator, denominator).second;
+    }
 }
 
 /**
@@ -396,7 +590,14 @@ template <typename I>
 template <typename I>
 [[nodiscard]] constexpr auto div(const I& numerator, const I& denominator) -> I
 {
-    return restoring_division(numerator, denominator).first;
+    if constexpr (is_unsigned_v<I> && I::width() < AARITH_LONG_DIVISION_THRESHOLD)
+    {
+        return restoring_division(numerator, denominator).first;
+    }
+    else
+    {
+        return long_division(numerator, denominator).first;
+    }
 }
 
 /**
@@ -589,6 +790,14 @@ template <size_t W, size_t V, typename WordType>
 [[nodiscard]] constexpr auto naive_expanding_mul(const integer<W, WordType>& m,
                                                  const integer<V, WordType>& r)
 {
+    using R = integer<W + V, WordType>;
+    if constexpr (implementation::has_native_width<R>)
+    {
+        // the product of the sign extended numbers is correct modulo 2^(W+V)
+        return implementation::from_native<R>(implementation::to_native(width_cast<W + V>(m)) *
+                                              implementation::to_native(width_cast<W + V>(r)));
+    }
+
     const bool m_neg = m.is_negative();
     const bool r_neg = r.is_negative();
 
@@ -597,7 +806,7 @@ template <size_t W, size_t V, typename WordType>
 
     const integer<W + V, WordType> result = schoolbook_expanding_mul(m_, r_);
 
-    return (m_neg ^ r_neg) ? -result : result;
+    return (m_neg ^ r_neg) ? negate(result) : result;
 }
 
 /**
@@ -620,12 +829,13 @@ template <size_t W, typename WordType>
 
     using I = integer<W, WordType>;
 
-    // if the number completely fits into the word, we can simply use the default implementation
-    // of the multiplication on the basis WordType
-    if constexpr (W <= I::word_width())
+    // if the number completely fits into a native integer, we can simply use the default
+    // implementation of the multiplication on the native type (the truncated two's complement
+    // product equals the truncated unsigned product)
+    if constexpr (implementation::has_native_width<I>)
     {
-        const I result{static_cast<typename I::word_type>(a.word(0) * b.word(0))};
-        return result;
+        return implementation::from_native<I>(implementation::to_native(a) *
+                                              implementation::to_native(b));
     }
     else
     {
@@ -665,7 +875,7 @@ template <size_t x, size_t y, typename WordType>
     //    std::cout << "expanded m: " << to_binary(expanded_m) << "\n";
 
     uinteger<K, WordType> A{static_cast<word_array<x + 1, WordType>>(expanded_m)};
-    uinteger<K, WordType> S{static_cast<word_array<x + 1, WordType>>(-expanded_m)};
+    uinteger<K, WordType> S{static_cast<word_array<x + 1, WordType>>(negate(expanded_m))};
 
     A = A << y + 1;
     S = S << y + 1;
@@ -770,7 +980,7 @@ template <size_t x, size_t y, typename WordType>
     integer<x + 1, WordType> expanded_m = width_cast<x + 1>(m);
 
     uinteger<K, WordType> A{static_cast<word_array<x + 1, WordType>>(expanded_m)};
-    uinteger<K, WordType> S{static_cast<word_array<x + 1, WordType>>(-expanded_m)};
+    uinteger<K, WordType> S{static_cast<word_array<x + 1, WordType>>(negate(expanded_m))};
 
     A <<= y + 1;
     S <<= y + 1;
@@ -840,6 +1050,155 @@ template <size_t W, typename WordType>
     }
 }
 
+/**
+ * @brief Multiplies two signed integers using the multiplication of unsigned integers expanding the
+ * bit width so that the result fits.
+ *
+ * The absolute values are multiplied using the fastest unsigned multiplication available for the
+ * widths, the product is negated if exactly one of the factors is negative.
+ *
+ * @tparam W The bit width of the first multiplicand
+ * @tparam V The bit width of the second multiplicand
+ * @param m First multiplicand
+ * @param r Second multiplicand
+ * @return Product of m and r
+ */
+template <size_t W, size_t V, typename WordType>
+[[nodiscard]] constexpr integer<W + V, WordType> signed_expanding_mul(const integer<W, WordType>& m,
+                                                                      const integer<V, WordType>& r)
+{
+    using R = integer<W + V, WordType>;
+    if constexpr (implementation::has_native_width<R>)
+    {
+        return naive_expanding_mul(m, r);
+    }
+    else
+    {
+        const uinteger<W, WordType> m_ = expanding_abs(m);
+        const uinteger<V, WordType> r_ = expanding_abs(r);
+
+        R product;
+        if constexpr (W == V)
+        {
+            product = R{expanding_mul(m_, r_)};
+        }
+        else
+        {
+            product = R{expanding_karazuba(m_, r_)};
+        }
+        return (m.is_negative() != r.is_negative()) ? negate(product) : product;
+    }
+}
+
+/**
+ * @brief Multiplies two signed integers using the multiplication of unsigned integers.
+ *
+ * The W least significant bits of the two's complement product equal the ones of the product of
+ * the bit patterns, so the bit patterns are simply multiplied as unsigned integers. The result is
+ * cropped to fit the initial bit width.
+ *
+ * @tparam W The bit width of the integers
+ * @param a First multiplicand
+ * @param b Second multiplicand
+ * @return Product of a and b
+ */
+template <size_t W, typename WordType>
+[[nodiscard]] constexpr integer<W, WordType> signed_mul(const integer<W, WordType>& a,
+                                                        const integer<W, WordType>& b)
+{
+    using U = uinteger<W, WordType>;
+    return integer<W, WordType>{mul(U{a}, U{b})};
+}
+
+namespace implementation {
+
+/**
+ * @brief Computes the product of two signed integers modulo 2^P using radix-4 Booth recoding
+ *
+ * The multiplier is recoded into digits in {-2, -1, 0, 1, 2}, each digit looking at two bits of
+ * the multiplier and the most significant bit of the previous pair. Every digit adds or subtracts
+ * the multiplicand or its double, shifted by two bits per digit, to or from the product. The
+ * additions, subtractions and shifts work on whole words.
+ *
+ * @tparam P The bit width of the product
+ * @param m Multiplicand
+ * @param r Multiplier
+ * @return The bit pattern of the product of m and r modulo 2^P
+ */
+template <size_t P, size_t x, size_t y, typename WordType>
+[[nodiscard]] constexpr uinteger<P, WordType> booth_radix4_product(const integer<x, WordType>& m,
+                                                                   const integer<y, WordType>& r)
+{
+    using U = uinteger<P, WordType>;
+
+    U single{width_cast<P>(m)};
+    U twice = single << 1;
+    U product = U::zero();
+
+    bool previous = false;
+    for (size_t i = 0; i < y && i < P; i += 2)
+    {
+        const bool low = r.bit(i);
+        // the multiplier is sign extended for odd widths
+        const bool high = (i + 1 < y) ? r.bit(i + 1) : r.msb();
+
+        // the digit is -2 * high + low + previous
+        if (low != previous)
+        {
+            product = high ? sub(product, single) : add(product, single);
+        }
+        else if (low != high)
+        {
+            product = high ? sub(product, twice) : add(product, twice);
+        }
+
+        previous = high;
+        single <<= 2;
+        twice <<= 2;
+    }
+    return product;
+}
+
+} // namespace implementation
+
+/**
+ * @brief Multiplies two signed integers using the radix-4 Booth multiplication expanding the bit
+ * width so that the result fits.
+ *
+ * Radix-4 Booth recoding halves the number of partial products compared to the classic Booth
+ * multiplication, as used by many hardware multipliers. It is meant for modelling such hardware,
+ * signed_expanding_mul is much faster.
+ *
+ * @tparam x The bit width of the multiplicand
+ * @tparam y The bit width of the multiplier
+ * @param m Multiplicand
+ * @param r Multiplier
+ * @return Product of m and r
+ */
+template <size_t x, size_t y, typename WordType>
+[[nodiscard]] constexpr integer<x + y, WordType>
+booth_radix4_expanding_mul(const integer<x, WordType>& m, const integer<y, WordType>& r)
+{
+    return integer<x + y, WordType>{implementation::booth_radix4_product<x + y>(m, r)};
+}
+
+/**
+ * @brief Multiplies two signed integers using the radix-4 Booth multiplication.
+ *
+ * Only the partial products are formed that contribute to the cropped result.
+ *
+ * @tparam W The bit width of the integers
+ * @param a Multiplicand
+ * @param b Multiplier
+ * @return Product of a and b
+ */
+template <size_t W, typename WordType>
+[[nodiscard]] constexpr integer<W, WordType> booth_radix4_mul(const integer<W, WordType>& a,
+                                                              const integer<W, WordType>& b)
+{
+    return integer<W, WordType>{implementation::booth_radix4_product<W>(a, b)};
+}
+
 /**
  * @brief Negates the value
  * @tparam W The width of the signed integer
@@ -970,16 +1329,126 @@ restoring_division(const integer<W, WordType>& numerator, const integer<V, WordT
     return std::make_pair(Q_cast, remainder_cast);
 }
 
+/**
+ * @brief Implements the long division on the level of words (Knuth's Algorithm D).
+ *
+ * @note integer<W>::min/integer<W>(-1) will return <integer<W>::min,0>, i.e. some weird
+ * overflow happens
+ *
+ * @see Donald E. Knuth: The Art of Computer Programming, Volume 2, Section 4.3.1
+ *
+ * @param numerator The number that is to be divided
+ * @param denominator The number that divides the other number
+ * @tparam W Width of the numbers used in division.
+ *
+ * @return Pair of (quotient, remainder)
+ *
+ */
+template <std::size_t W, std::size_t V, typename WordType>
+[[nodiscard]] constexpr std::pair<integer<W, WordType>, integer<W, WordType>>
+long_division(const integer<W, WordType>& numerator, const integer<V, WordType>& denominator)
+{
+
+    using Integer = integer<W, WordType>;
+    using UInteger = uinteger<W, WordType>;
+    using IntOneBitMore = integer<W + 1, WordType>;
+
+    // Cover some special cases in order to speed everything up
+    if (denominator.is_zero())
+    {
+        throw std::runtime_error("Attempted division by zero");
+    }
+
+    if constexpr (implementation::has_native_width<Integer> &&
+                  implementation::has_native_width<integer<V, WordType>>)
+    {
+        constexpr size_t max_width = std::max(W, V);
+        using N = implementation::native_uint_t<max_width>;
+        using S = implementation::native_signed_t<N>;
+
+        const auto n = static_cast<N>(implementation::to_native(numerator));
+        const auto d = static_cast<N>(implementation::to_native(denominator));
+        const auto n_ext = implementation::sign_extend_native<W>(n);
+        const auto d_ext = implementation::sign_extend_native<V>(d);
+
+        // the division of the most negative number by minus one overflows, computing the
+        // negation in unsigned arithmetic yields the wrapped result
+        if (d_ext == static_cast<N>(~N{0U}))
+        {
+            return std::make_pair(implementation::from_native<Integer>(static_cast<N>(N{0U} - n)),
+                                  Integer::zero());
+        }
+
+        const auto n_signed = static_cast<S>(n_ext);
+        const auto d_signed = static_cast<S>(d_ext);
+        const auto quotient = static_cast<N>(n_signed / d_signed);
+        const auto remainder = static_cast<N>(n_signed % d_signed);
+        return std::make_pair(implementation::from_native<Integer>(quotient),
+                              implementation::from_native<Integer>(remainder));
+    }
+    if (numerator.is_zero())
+    {
+        return std::make_pair(Integer::zero(), Integer::zero());
+    }
+    if (denominator == Integer::one())
+    {
+        return std::make_pair(numerator, Integer::zero());
+    }
+
+    if (numerator == denominator)
+    {
+        return std::make_pair(Integer::one(), Integer::zero());
+    }
+
+    const bool to_negate = numerator.is_negative() ^ denominator.is_negative();
+
+    const UInteger N = expanding_abs(numerator);
+    const UInteger D = expanding_abs(denominator);
+
+    if (N < D)
+    {
+        return std::make_pair(Integer::zero(), numerator);
+    }
+
+    const auto div_ = long_division(N, D);
+
+    IntOneBitMore Q(div_.first);
+    IntOneBitMore remainder_(div_.second);
+
+    if (to_negate)
+    {
+        Q = negate(Q);
+    }
+
+    Integer Q_cast = width_cast<W>(Q);
+    Integer remainder_cast = width_cast<W>(remainder_);
+
+    if (numerator.is_negative())
+    {
+        remainder_cast = -remainder_cast;
+    }
+
+    return std::make_pair(Q_cast, remainder_cast);
+}
+
 template <typename I, typename = std::enable_if_t<is_integral_v<I>>>
 constexpr I mul(const I& a, const I& b)
 {
     if constexpr (is_unsigned_v<I>)
     {
+        // computing the full product pays off once the subquadratic algorithms are fast enough
+        if constexpr (I::width() >= AARITH_MUL_EXPANDING_THRESHOLD)
+        {
+            if (!implementation::is_constant_evaluated())
+            {
+                return width_cast<I::width()>(expanding_mul(a, b));
+            }
+        }
         return schoolbook_mul(a, b);
     }
     else
     {
-        return naive_mul(a, b);
+        return signed_mul(a, b);
     }
 }
 
@@ -988,59 +1457,218 @@ auto constexpr expanding_mul(const I& a, const I& b)
 {
     if constexpr (is_unsigned_v<I>)
     {
+        // the subquadratic algorithms can not be evaluated at compile time
+        if constexpr (I::width() >= AARITH_NTT_THRESHOLD)
+        {
+            if (!implementation::is_constant_evaluated())
+            {
+                return expanding_ntt_mul(a, b);
+            }
+        }
+        else if constexpr (I::width() >= AARITH_TOOM4_THRESHOLD)
+        {
+            if (!implementation::is_constant_evaluated())
+            {
+                return expanding_toom4(a, b);
+            }
+        }
+        else if constexpr (I::width() >= AARITH_TOOM3_THRESHOLD)
+        {
+            if (!implementation::is_constant_evaluated())
+            {
+                return expanding_toom3(a, b);
+            }
+        }
+        else if constexpr (I::width() >= AARITH_KARATSUBA_THRESHOLD)
+        {
+            return expanding_karazuba(a, b);
+        }
         return schoolbook_expanding_mul(a, b);
     }
     else
     {
-        return naive_expanding_mul(a, b);
+        return signed_expanding_mul(a, b);
     }
 }
 
 /**
- * @brief Exponentiation function
+ * @brief Squares an unsigned integer expanding the bit width so that the result fits.
  *
- * @note This function does not make any attempts to be fast or to prevent overflows!
+ * Each cross product of two words is computed only once, roughly halving the number of word
+ * multiplications compared to schoolbook_expanding_mul. Very wide numbers are squared using the
+ * subquadratic multiplications of expanding_mul.
  *
- * @note If exponent equals std::numeric_limits<size_t>::max(), this method throws an exception,
- * unless base equals zero
- * @tparam W Bit width of the integer
- * @param base
- * @param exponent
- * @return The base to the power of the exponent
+ * @tparam W The bit width of the number
+ * @param a The number to square
+ * @return The square of a
  */
-template <typename IntegerType> IntegerType pow(const IntegerType& base, const size_t exponent)
+template <std::size_t W, typename WordType>
+[[nodiscard]] constexpr uinteger<2 * W, WordType> expanding_square(const uinteger<W, WordType>& a)
 {
-
-    if (exponent == std::numeric_limits<size_t>::max())
+    using R = uinteger<2 * W, WordType>;
+    if constexpr (implementation::has_native_width<R>)
     {
-        if (base.is_zero())
+        return schoolbook_expanding_mul(a, a);
+    }
+    else
+    {
+        if constexpr (W >= AARITH_TOOM3_THRESHOLD)
         {
-            return IntegerType::zero();
+            if (!implementation::is_constant_evaluated())
+            {
+                return expanding_mul(a, a);
+            }
         }
-        else
+
+        constexpr size_t words = uinteger<W, WordType>::word_count();
+        const auto a_words = implementation::copy_words(a);
+        implementation::word_storage_t<WordType, 2 * words> product{};
+        implementation::square_words(product.data(), a_words.data(), words);
+
+        R result;
+        for (size_t i = 0; i < R::word_count(); ++i)
         {
-            throw std::runtime_error(
-                "Attempted exponentiation by std::numeric_limits<size_t>::max()");
+            result.set_word(i, product[i]);
         }
+        return result;
     }
+}
+
+/**
+ * @brief Squares a signed integer expanding the bit width so that the result fits.
+ *
+ * @tparam W The bit width of the number
+ * @param a The number to square
+ * @return The square of a
+ */
+template <std::size_t W, typename WordType>
+[[nodiscard]] constexpr integer<2 * W, WordType> expanding_square(const integer<W, WordType>& a)
+{
+    return integer<2 * W, WordType>{expanding_square(expanding_abs(a))};
+}
+
+/**
+ * @brief Squares an integer.
+ *
+ * The result is then cropped to fit the initial bit width.
+ *
+ * @tparam I The integer type to operate on
+ * @param a The number to square
+ * @return The square of a
+ */
+template <typename I, typename = std::enable_if_t<is_integral_v<I>>>
+[[nodiscard]] constexpr I square(const I& a)
+{
+    constexpr size_t W = I::width();
+    using WordType = typename I::word_type;
+    // the square modulo 2^W only depends on the bits of a and not on its sign
+    return I{width_cast<W>(expanding_square(uinteger<W, WordType>{a}))};
+}
 
-    IntegerType result = IntegerType::one();
+namespace implementation {
 
-    for (size_t i = 0U; i <= exponent; ++i)
+/**
+ * @brief Computes base^exponent using left-to-right sliding window exponentiation
+ *
+ * The exponent is scanned from its most significant bit. Each maximal window of at most k bits
+ * that ends in a set bit is handled by a single multiplication with a precomputed odd power of the
+ * base. The window size grows with the length of the exponent; a window size of one is the plain
+ * binary square-and-multiply method.
+ *
+ * @see Handbook of Applied Cryptography, Algorithm 14.85
+ *
+ * @tparam T The type of the base
+ * @param base The base
+ * @param one The neutral element of the multiplication
+ * @param exponent_bits The number of significant bits of the exponent
+ * @param exponent_bit Callable returning whether the exponent bit with the given index is set
+ * @param multiply Callable multiplying two values
+ * @param square Callable squaring a value
+ * @return The base to the power of the exponent
+ */
+template <typename T, typename ExponentBit, typename Multiply, typename Square>
+[[nodiscard]] constexpr T sliding_window_pow(const T& base, const T& one,
+                                             const size_t exponent_bits,
+                                             const ExponentBit& exponent_bit,
+                                             const Multiply& multiply, const Square& square)
+{
+    if (exponent_bits == 0)
     {
-        result = mul(result, base);
+        return one;
+    }
+
+    const size_t window = (exponent_bits > 256)  ? 5
+                          : (exponent_bits > 64) ? 4
+                          : (exponent_bits > 16) ? 3
+                          : (exponent_bits > 4)  ? 2
+                                                 : 1;
+
+    // the odd powers base^1, base^3, ..., base^(2^window - 1)
+    std::array<T, 16> odd_powers{};
+    odd_powers[0] = base;
+    if (window > 1)
+    {
+        const T base_squared = square(base);
+        for (size_t i = 1; i < (size_t{1} << (window - 1)); ++i)
+        {
+            odd_powers[i] = multiply(odd_powers[i - 1], base_squared);
+        }
+    }
+
+    T result = one;
+    bool started = false;
+    size_t i = exponent_bits;
+    while (i > 0)
+    {
+        if (!exponent_bit(i - 1))
+        {
+            if (started)
+            {
+                result = square(result);
+            }
+            --i;
+            continue;
+        }
+
+        // find the longest window (at most window bits) starting at bit i-1 that ends in a set bit
+        size_t j = (i >= window) ? i - window : 0;
+        while (!exponent_bit(j))
+        {
+            ++j;
+        }
+        size_t value = 0;
+        for (size_t k = i; k > j; --k)
+        {
+            value = (value << 1U) | (exponent_bit(k - 1) ? 1U : 0U);
+        }
+
+        if (started)
+        {
+            for (size_t k = j; k < i; ++k)
+            {
+                result = square(result);
+            }
+            result = multiply(result, odd_powers[value >> 1U]);
+        }
+        else
+        {
+            result = odd_powers[value >> 1U];
+            started = true;
+        }
+        i = j;
     }
     return result;
 }
 
+} // namespace implementation
+
 /**
- *
  * @brief Exponentiation function
  *
- * @note This function does not make any attempts to be fast or to prevent overflows!
+ * The power is computed using sliding window exponentiation, i.e., the number of multiplications
+ * is logarithmic in the exponent.
  *
- * @note If exponent equals std::numeric_limits<IntegerType>::max(), this method throws an
- * exception, unless base equals zero
+ * @note The result is computed modulo 2^W, i.e., overflows are not detected.
  *
  * @tparam IntegerType The type of integer used in the computation
  * @param base
@@ -1048,34 +1676,57 @@ template <typename IntegerType> IntegerType pow(const IntegerType& base, const s
  * @return The base to the power of the exponent
  */
 template <typename IntegerType>
-IntegerType pow(const IntegerType& base, const IntegerType& exponent)
+[[nodiscard]] constexpr IntegerType pow(const IntegerType& base, const size_t exponent)
 {
-
     static_assert(aarith::is_integral_v<IntegerType>,
                   "Exponentiation is only supported for aarith integers");
 
-    if (exponent == IntegerType::max())
+    size_t exponent_bits = 0;
+    while (exponent_bits < std::numeric_limits<size_t>::digits && (exponent >> exponent_bits) != 0U)
     {
-        if (base == IntegerType::zero())
-        {
-            return IntegerType::zero();
-        }
-        else
-        {
-            throw std::runtime_error(
-                "Attempted exponentiation by std::numeric_limits<IntegerType<W>>::max()");
-        }
+        ++exponent_bits;
     }
 
-    IntegerType result = IntegerType::one();
-    IntegerType iter = IntegerType::zero();
-    while (iter < exponent)
+    return implementation::sliding_window_pow(
+        base, IntegerType::one(), exponent_bits,
+        [exponent](const size_t i) { return ((exponent >> i) & 1U) != 0U; },
+        [](const IntegerType& a, const IntegerType& b) { return mul(a, b); },
+        [](const IntegerType& a) { return square(a); });
+}
+
+/**
+ *
+ * @brief Exponentiation function
+ *
+ * The power is computed using sliding window exponentiation, i.e., the number of multiplications
+ * is logarithmic in the exponent.
+ *
+ * @note The result is computed modulo 2^W, i.e., overflows are not detected.
+ *
+ * @note Negative exponents yield one.
+ *
+ * @tparam IntegerType The type of integer used in the computation
+ * @param base
+ * @param exponent
+ * @return The base to the power of the exponent
+ */
+template <typename IntegerType>
+[[nodiscard]] constexpr IntegerType pow(const IntegerType& base, const IntegerType& exponent)
+{
+    static_assert(aarith::is_integral_v<IntegerType>,
+                  "Exponentiation is only supported for aarith integers");
+
+    if (exponent.is_negative())
     {
-        result = mul(result, base);
-        iter = add(iter, IntegerType::one());
+        return IntegerType::one();
     }
 
-    return result;
+    const size_t exponent_bits = IntegerType::width() - count_leading_zeroes(exponent);
+    return implementation::sliding_window_pow(
+        base, IntegerType::one(), exponent_bits,
+        [&exponent](const size_t i) { return exponent.bit(i) != 0U; },
+        [](const IntegerType& a, const IntegerType& b) { return mul(a, b); },
+        [](const IntegerType& a) { return square(a); });
 }
 
 /**
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <aarith/integer/integer_divider.hpp>
 #include <random>
 #include <stdexcept>
 
@@ -19,12 +20,9 @@ public:
                                            const input_type& max_ = input_type::max()) // NOLINT
         : min(min_)
         , max(add(internal_type{max_}, internal_type::one()))
-        , length(sub(max, min))
+        , length(interval_length(min_, max_))
+        , length_divider(length)
     {
-        if (!(min <= max))
-        {
-            throw std::runtime_error("uniform_uinteger_distribution: a must be <= b");
-        }
     }
 
     template <class Generator> auto operator()(Generator& g) -> input_type
@@ -39,7 +37,7 @@ public:
         using namespace aarith::integer_operators; // NOLINT
         //        std::cout << min << " + (" << uint << " % " << length << ") = " << min << " + "
         //                  << (uint % length) << "\n";
-        return width_cast<BitWidth>(min + (uint % length));
+        return width_cast<BitWidth>(min + length_divider.remainder(uint));
     }
 
     void reset()
@@ -48,9 +46,26 @@ public:
     }
 
 private:
+    /**
+     * @brief Returns the number of values in [min_, max_]
+     *
+     * The bounds are checked before the divider by the length is created, which would otherwise
+     * report a division by zero.
+     */
+    [[nodiscard]] static internal_type interval_length(const input_type& min_,
+                                                       const input_type& max_)
+    {
+        if (max_ < min_)
+        {
+            throw std::runtime_error("uniform_uinteger_distribution: a must be <= b");
+        }
+        return add(sub(internal_type{max_}, internal_type{min_}), internal_type::one());
+    }
+
     internal_type min;
     internal_type max;
     internal_type length;
+    uinteger_divider<BitWidth + 1, WordType> length_divider;
     std::uniform_int_distribution<WordType> random_word{std::numeric_limits<WordType>::min(),
                                                         std::numeric_limits<WordType>::max()};
 };
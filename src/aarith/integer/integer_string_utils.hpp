@@ -1,6 +1,9 @@
 #pragma once
 
 #include <aarith/core/core_string_utils.hpp>
+#include <aarith/core/word_operations.hpp>
+#include <limits>
+#include <string>
 
 namespace aarith {
 
@@ -103,10 +106,53 @@ auto to_bcd(const uinteger<Width, WordType>& num)
 }
 
 /// Convert the given uinteger value into a decimal string representation.
+///
+/// The value is repeatedly divided by the largest power of ten fitting into a single word (using
+/// its precomputed reciprocal). Each remainder then yields a fixed number of decimal digits.
 template <size_t Width, typename WordType>
 auto to_decimal(const uinteger<Width, WordType>& value) -> std::string
 {
-    return remove_leading_zeroes(to_hex(to_bcd(value)));
+    WordType chunk_divisor{1U};
+    size_t chunk_digits = 0;
+    while (chunk_divisor <= std::numeric_limits<WordType>::max() / 10U)
+    {
+        chunk_divisor = static_cast<WordType>(chunk_divisor * 10U);
+        ++chunk_digits;
+    }
+
+    const size_t chunk_shift = implementation::count_leading_zeroes_word(chunk_divisor);
+    const auto normalized_divisor = static_cast<WordType>(chunk_divisor << chunk_shift);
+    const WordType reciprocal = implementation::reciprocal_word(normalized_divisor);
+
+    auto words = implementation::copy_words(value);
+    size_t n = words.size();
+    while (n > 0 && words[n - 1] == WordType{0U})
+    {
+        --n;
+    }
+
+    std::string result;
+    while (n > 0)
+    {
+        WordType chunk = implementation::divmod_word_preinv(
+            words.data(), words.data(), n, normalized_divisor, chunk_shift, reciprocal);
+        while (n > 0 && words[n - 1] == WordType{0U})
+        {
+            --n;
+        }
+        // leading zeroes are only omitted for the most significant chunk
+        for (size_t i = 0; i < chunk_digits && (n > 0 || chunk != WordType{0U}); ++i)
+        {
+            result += static_cast<char>('0' + chunk % 10U);
+            chunk = static_cast<WordType>(chunk / 10U);
+        }
+    }
+
+    if (result.empty())
+    {
+        return "0";
+    }
+    return std::string(result.rbegin(), result.rend());
 }
 
 /// Convert the given integer value into a decimal string representation.
@@ -120,7 +166,7 @@ auto to_decimal(const integer<Width, WordType>& value) -> std::string
         res += "-";
     }
     const auto absval = expanding_abs(value);
-    res += remove_leading_zeroes(to_hex(to_bcd(absval)));
+    res += to_decimal(absval);
     return res;
 }
 
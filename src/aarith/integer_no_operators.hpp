@@ -2,8 +2,12 @@
 
 #include <aarith/core.hpp>
 
+#include <aarith/integer/integer_batch.hpp>
 #include <aarith/integer/integer_casts.hpp>
 #include <aarith/integer/integer_comparisons.hpp>
+#include <aarith/integer/integer_constant_operations.hpp>
+#include <aarith/integer/integer_divider.hpp>
+#include <aarith/integer/integer_modular_operations.hpp>
 #include <aarith/integer/integer_operations.hpp>
 #include <aarith/integer/integer_ranges.hpp>
 #include <aarith/integer/integers.hpp>
@@ -3,6 +3,8 @@
 #include <aarith/core.hpp>
 #include <aarith/core/core_string_utils.hpp>
 
+#include <vector>
+
 #include "../test-signature-ranges.hpp"
 #include "gen_word_array.hpp"
 
@@ -1068,3 +1070,78 @@ TEMPLATE_TEST_CASE_SIG("Bit operations are performed correctly", "[word_array][b
         }
     }
 }
+
+TEMPLATE_TEST_CASE_SIG("Scanning word_arrays word by word matches bitwise scanning",
+                       "[word_array][utility][bit_logic]", AARITH_INT_TEST_SIGNATURE,
+                       AARITH_WORD_ARRAY_TEST_TEMPLATE_PARAM_RANGE)
+{
+    using A = word_array<W, WordType>;
+
+    GIVEN("A random word_array a")
+    {
+        const A a = GENERATE(take(20, random_word_array<W, WordType>()), A::all_zeroes(),
+                             A::all_ones(), A::msb_one(), A{1U});
+
+        size_t expected_leading_zeroes = 0;
+        while (expected_leading_zeroes < W && !a.bit(W - 1 - expected_leading_zeroes))
+        {
+            ++expected_leading_zeroes;
+        }
+        size_t expected_leading_ones = 0;
+        while (expected_leading_ones < W && a.bit(W - 1 - expected_leading_ones))
+        {
+            ++expected_leading_ones;
+        }
+        size_t expected_trailing_zeroes = 0;
+        while (expected_trailing_zeroes < W && !a.bit(expected_trailing_zeroes))
+        {
+            ++expected_trailing_zeroes;
+        }
+        std::vector<size_t> expected_set_bits;
+        for (size_t i = 0; i < W; ++i)
+        {
+            if (a.bit(i))
+            {
+                expected_set_bits.push_back(i);
+            }
+        }
+
+        THEN("The leading and trailing bits are counted correctly")
+        {
+            REQUIRE(count_leading_zeroes(a) == expected_leading_zeroes);
+            REQUIRE(count_leading_ones(a) == expected_leading_ones);
+            REQUIRE(count_trailing_zeroes(a) == expected_trailing_zeroes);
+        }
+        THEN("The ones are counted correctly")
+        {
+            REQUIRE(popcount(a) == expected_set_bits.size());
+            REQUIRE(parity(a) == (expected_set_bits.size() % 2 == 1));
+        }
+        THEN("Every set bit is visited in ascending order")
+        {
+            std::vector<size_t> set_bits;
+            for_each_set_bit(a, [&set_bits](const size_t i) { set_bits.push_back(i); });
+            REQUIRE(set_bits == expected_set_bits);
+        }
+    }
+}
+
+SCENARIO("Scanning word_arrays at compile time", "[word_array][utility][bit_logic]")
+{
+    GIVEN("A constant word_array spanning several words")
+    {
+        constexpr word_array<100, uint32_t> a = word_array<100, uint32_t>::msb_one() |
+                                                word_array<100, uint32_t>{0b1011000U};
+        THEN("All scans can be evaluated at compile time")
+        {
+            static_assert(count_leading_zeroes(a) == 0);
+            static_assert(count_leading_ones(a) == 1);
+            static_assert(count_trailing_zeroes(a) == 3);
+            static_assert(popcount(a) == 4);
+            static_assert(!parity(a));
+            static_assert(*first_set_bit(a) == 99);
+            static_assert(*first_unset_bit(a) == 98);
+            REQUIRE(popcount(a) == 4);
+        }
+    }
+}
@@ -156,4 +156,66 @@ TEMPLATE_TEST_CASE_SIG("Concatenating undoes splitting", "[word_array][utility]"
             }
         }
     }
-}
\ No newline at end of file
+}
+
+TEMPLATE_TEST_CASE_SIG("Extracting and inserting bits matches bitwise access",
+                       "[word_array][utility]", AARITH_INT_TEST_SIGNATURE,
+                       AARITH_WORD_ARRAY_TEST_TEMPLATE_PARAM_RANGE)
+{
+    GIVEN("Two word_arrays and an index")
+    {
+        using I = word_array<W, WordType>;
+        constexpr size_t Count = (W + 1) / 2;
+
+        const I w = GENERATE(take(10, random_word_array<W, WordType>()));
+        const I v = GENERATE(take(2, random_word_array<W, WordType>()));
+        const size_t index = GENERATE(take(10, random<size_t>(0U, W - 1)));
+
+        WHEN("Extracting Count bits starting at the index")
+        {
+            const auto extracted = w.template bits<Count>(index);
+            THEN("Every bit matches the corresponding bit of the word_array (or zero beyond it)")
+            {
+                for (size_t i = 0; i < Count; ++i)
+                {
+                    const auto expected = (index + i < W) ? w.bit(index + i) : WordType{0U};
+                    REQUIRE(extracted.bit(i) == expected);
+                }
+            }
+        }
+        WHEN("Inserting Count bits of another word_array at the index")
+        {
+            const auto inserted = v.template bits<Count>(0);
+            I result = w;
+            result.set_bits(index, inserted);
+            THEN("Only the bits in the range are replaced")
+            {
+                for (size_t i = 0; i < W; ++i)
+                {
+                    const bool in_range = i >= index && i < index + Count;
+                    const auto expected = in_range ? inserted.bit(i - index) : w.bit(i);
+                    REQUIRE(result.bit(i) == expected);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Creating word_arrays from bit strings spanning several words", "[word_array][utility]")
+{
+    GIVEN("A bit string longer than a single word")
+    {
+        const std::string bits = "1" + std::string(70, '0') + "101";
+        WHEN("Creating a word_array from it")
+        {
+            const word_array<74, uint32_t> w{bits};
+            THEN("The bits are placed correctly")
+            {
+                REQUIRE(w.word(0) == 0b101U);
+                REQUIRE(w.word(1) == 0U);
+                REQUIRE(w.word(2) == 0b10U << 8U);
+                REQUIRE(to_binary(w) == bits);
+            }
+        }
+    }
+}
@@ -0,0 +1,208 @@
+#include <catch.hpp>
+
+#include "../test-signature-ranges.hpp"
+#include "gen_word_array.hpp"
+#include <aarith/core.hpp>
+#include <aarith/integer_no_operators.hpp>
+
+#include <array>
+#include <vector>
+
+using namespace aarith;
+
+namespace {
+
+/*
+ * Stores the words of a word array in an external buffer, setting the unused bits of the most
+ * significant word to one to make sure that the views neither read nor modify them.
+ */
+template <size_t W, typename WordType>
+std::array<WordType, word_array<W, WordType>::word_count()>
+to_buffer(const word_array<W, WordType>& w)
+{
+    using A = word_array<W, WordType>;
+    std::array<WordType, A::word_count()> buffer{};
+    for (size_t i = 0; i < A::word_count(); ++i)
+    {
+        buffer[i] = static_cast<WordType>(w.word(i) | ~A::word_mask(i));
+    }
+    return buffer;
+}
+
+template <size_t W, typename WordType, typename Buffer> bool unused_bits_untouched(const Buffer& b)
+{
+    using A = word_array<W, WordType>;
+    constexpr size_t last = A::word_count() - 1;
+    const auto unused = static_cast<WordType>(~A::word_mask(last));
+    return (b[last] & unused) == unused;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("Views onto external words behave like word arrays",
+                       "[word_array][view][utility]", AARITH_INT_TEST_SIGNATURE, (5, uint8_t),
+                       (20, uint16_t), (64, uint64_t), (65, uint32_t), (150, uint64_t),
+                       (1025, uint8_t))
+{
+    using A = word_array<W, WordType>;
+    using U = uinteger<W, WordType>;
+    using View = word_array_view<W, WordType>;
+    using ConstView = word_array_view<W, const WordType>;
+
+    const A a = GENERATE(take(10, random_word_array<W, WordType>()));
+    const A b = GENERATE(take(5, random_word_array<W, WordType>()), A::all_zeroes());
+
+    auto buffer_a = to_buffer(a);
+    auto buffer_b = to_buffer(b);
+    const View view_a{buffer_a.data()};
+    const ConstView view_b{buffer_b.data()};
+
+    SECTION("Read-only operations")
+    {
+        REQUIRE(view_a.to_word_array() == a);
+        REQUIRE(ConstView{view_a}.to_word_array() == a);
+        REQUIRE(view_a.msb() == a.msb());
+        REQUIRE(view_a.is_zero() == a.is_zero());
+        for (size_t i = 0; i < W; i += 7)
+        {
+            REQUIRE(view_a.bit(i) == a.bit(i));
+            REQUIRE(view_a.template bits<13>(i) == a.template bits<13>(i));
+        }
+        REQUIRE(count_leading_zeroes(view_a) == count_leading_zeroes(a));
+        REQUIRE(count_leading_ones(view_a) == count_leading_ones(a));
+        REQUIRE(count_trailing_zeroes(view_a) == count_trailing_zeroes(a));
+        REQUIRE(popcount(view_a) == popcount(a));
+        REQUIRE(parity(view_a) == parity(a));
+        REQUIRE(first_set_bit(view_a) == first_set_bit(a));
+        REQUIRE(first_unset_bit(view_a) == first_unset_bit(a));
+
+        std::vector<size_t> from_view;
+        std::vector<size_t> from_array;
+        for_each_set_bit(view_a, [&from_view](size_t i) { from_view.push_back(i); });
+        for_each_set_bit(a, [&from_array](size_t i) { from_array.push_back(i); });
+        REQUIRE(from_view == from_array);
+    }
+
+    SECTION("Comparisons")
+    {
+        const U ua{a};
+        const U ub{b};
+
+        REQUIRE((view_a == view_b) == (ua == ub));
+        REQUIRE((view_a != view_b) == (ua != ub));
+        REQUIRE((view_a < view_b) == (ua < ub));
+        REQUIRE((view_a <= view_b) == (ua <= ub));
+        REQUIRE((view_a > view_b) == (ua > ub));
+        REQUIRE((view_a >= view_b) == (ua >= ub));
+
+        REQUIRE(view_a == ua);
+        REQUIRE(ua == view_a);
+        REQUIRE(view_a == a);
+        REQUIRE((view_b < ua) == (ub < ua));
+        REQUIRE((ua < view_b) == (ua < ub));
+        REQUIRE(view_a == ConstView{buffer_a.data()});
+        REQUIRE(view_a == width_cast<W + 3>(ua));
+        REQUIRE(width_cast<W + 3>(ub) == view_b);
+    }
+
+    SECTION("In-place operations")
+    {
+        const U ua{a};
+        const U ub{b};
+
+        WHEN("Adding and subtracting")
+        {
+            view_a += view_b;
+            REQUIRE(view_a == add(ua, ub));
+            view_a -= ub;
+            REQUIRE(view_a == ua);
+            view_a -= view_b;
+            REQUIRE(view_a == sub(ua, ub));
+        }
+        WHEN("Multiplying")
+        {
+            view_a *= view_b;
+            REQUIRE(view_a == mul(ua, ub));
+        }
+        WHEN("Combining the bits")
+        {
+            view_a &= view_b;
+            REQUIRE(view_a == (a & b));
+            view_a |= a;
+            REQUIRE(view_a == ((a & b) | a));
+            view_a ^= view_b;
+            REQUIRE(view_a == (((a & b) | a) ^ b));
+        }
+        WHEN("Shifting")
+        {
+            const size_t shift = GENERATE(0U, 1U, 8U, 63U, 64U, 65U, 1000U);
+            view_a <<= shift;
+            REQUIRE(view_a == (a << shift));
+            view_a.set_bits(a);
+            view_a >>= shift;
+            REQUIRE(view_a == (a >> shift));
+        }
+        WHEN("Setting bits")
+        {
+            view_a.set_msb(true);
+            view_a.set_bit(0, false);
+            A expected{a};
+            expected.set_msb(true);
+            expected.set_bit(0, false);
+            REQUIRE(view_a == expected);
+            view_a.fill(static_cast<WordType>(~WordType{0U}));
+            REQUIRE(view_a == A::all_ones());
+        }
+
+        REQUIRE(unused_bits_untouched<W, WordType>(buffer_a));
+    }
+
+    SECTION("Operations returning word arrays")
+    {
+        const U ua{a};
+        const U ub{b};
+        const size_t shift = GENERATE(0U, 1U, 63U, 65U, 1000U);
+
+        REQUIRE((view_a + view_b) == add(ua, ub));
+        REQUIRE((view_a - ub) == sub(ua, ub));
+        REQUIRE((view_a * view_b) == mul(ua, ub));
+        REQUIRE((view_a & view_b) == (a & b));
+        REQUIRE((view_a | b) == (a | b));
+        REQUIRE((view_a ^ view_b) == (a ^ b));
+        REQUIRE(~view_b == ~b);
+        REQUIRE((view_a << shift) == (a << shift));
+        REQUIRE((view_b >> shift) == (b >> shift));
+        REQUIRE(to_binary(view_a) == to_binary(a));
+
+        REQUIRE(view_a == a);
+        REQUIRE(unused_bits_untouched<W, WordType>(buffer_a));
+    }
+}
+
+SCENARIO("Computing directly in external buffers", "[word_array][view]")
+{
+    GIVEN("Two numbers stored in a larger buffer")
+    {
+        // e.g. a memory-mapped file containing many 128 bit numbers
+        std::array<uint64_t, 4> buffer{~uint64_t{0U}, 1U, 5U, 0U};
+        const word_array_view<128> x{buffer.data()};
+        const word_array_view<128, const uint64_t> y{buffer.data() + 2};
+
+        THEN("The views operate directly on the buffer")
+        {
+            REQUIRE(x > y);
+            x += y;
+            REQUIRE(buffer[0] == 4U);
+            REQUIRE(buffer[1] == 2U);
+            REQUIRE(x == uinteger<128>::from_words(2U, 4U));
+            REQUIRE(count_leading_zeroes(x) == 62U);
+        }
+        THEN("Computing with the views does not modify the buffer")
+        {
+            const word_array<128> sum = x + y;
+            REQUIRE(sum == uinteger<128>::from_words(2U, 4U));
+            REQUIRE(buffer[0] == ~uint64_t{0U});
+            REQUIRE(buffer[1] == 1U);
+        }
+    }
+}
@@ -0,0 +1,163 @@
+#include <catch.hpp>
+
+#include <aarith/core.hpp>
+
+#include <random>
+
+using namespace aarith;
+
+TEMPLATE_TEST_CASE("Multiplying words by halves matches the native multiplication",
+                   "[word_array][utility]", uint32_t, uint64_t)
+{
+    using W = TestType;
+    using D = implementation::double_word_t<W>;
+    constexpr size_t width = implementation::bits_per_word<W>();
+
+    std::mt19937_64 rng{0x5eed};
+    std::uniform_int_distribution<W> dist{0U, std::numeric_limits<W>::max()};
+
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        const W a = (i == 0) ? std::numeric_limits<W>::max() : dist(rng);
+        const W b = (i == 0) ? std::numeric_limits<W>::max() : dist(rng);
+        const D expected = static_cast<D>(a) * static_cast<D>(b);
+
+        W high{0U};
+        const W low = implementation::mul_wide_halves(a, b, high);
+        REQUIRE(low == static_cast<W>(expected));
+        REQUIRE(high == static_cast<W>(expected >> width));
+    }
+}
+
+TEMPLATE_TEST_CASE("Dividing double words by halves matches the native division",
+                   "[word_array][utility]", uint32_t, uint64_t)
+{
+    using W = TestType;
+    using D = implementation::double_word_t<W>;
+    constexpr size_t width = implementation::bits_per_word<W>();
+
+    std::mt19937_64 rng{0x5eed};
+    std::uniform_int_distribution<W> dist{0U, std::numeric_limits<W>::max()};
+    std::uniform_int_distribution<size_t> shift_dist{0U, width - 1};
+
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        const W divisor = std::max(W{1U}, static_cast<W>(dist(rng) >> shift_dist(rng)));
+        const W high = dist(rng) % divisor;
+        const W low = dist(rng);
+        const D numerator = (static_cast<D>(high) << width) | low;
+
+        W remainder{0U};
+        const W quotient = implementation::div_wide_halves(high, low, divisor, remainder);
+        REQUIRE(quotient == static_cast<W>(numerator / divisor));
+        REQUIRE(remainder == static_cast<W>(numerator % divisor));
+    }
+}
+
+TEMPLATE_TEST_CASE("Dividing double words using a precomputed reciprocal",
+                   "[word_array][utility]", uint8_t, uint16_t, uint32_t, uint64_t)
+{
+    using W = TestType;
+    constexpr size_t width = implementation::bits_per_word<W>();
+
+    std::mt19937_64 rng{0x5eed};
+    std::uniform_int_distribution<uint64_t> dist{0U, std::numeric_limits<W>::max()};
+
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        // the divisor has to be normalized
+        const auto divisor = static_cast<W>(dist(rng) | (uint64_t{1U} << (width - 1)));
+        const W reciprocal = implementation::reciprocal_word(divisor);
+        const auto high = static_cast<W>((i == 0) ? divisor - 1U : dist(rng) % divisor);
+        const auto low = static_cast<W>((i == 0) ? std::numeric_limits<W>::max() : dist(rng));
+
+        W expected_remainder{0U};
+        const W expected_quotient =
+            implementation::div_wide(high, low, divisor, expected_remainder);
+
+        W remainder{0U};
+        const W quotient =
+            implementation::div_wide_preinv(high, low, divisor, reciprocal, remainder);
+        REQUIRE(quotient == expected_quotient);
+        REQUIRE(remainder == expected_remainder);
+    }
+}
+
+TEMPLATE_TEST_CASE("Counting the leading zeroes of a word", "[word_array][utility]", uint8_t,
+                   uint16_t, uint32_t, uint64_t)
+{
+    using W = TestType;
+    constexpr size_t width = implementation::bits_per_word<W>();
+
+    REQUIRE(implementation::count_leading_zeroes_word(W{0U}) == width);
+    for (size_t i = 0; i < width; ++i)
+    {
+        const auto w = static_cast<W>(W{1U} << i);
+        REQUIRE(implementation::count_leading_zeroes_word(w) == width - 1 - i);
+    }
+}
+
+TEMPLATE_TEST_CASE("Counting the trailing zeroes and ones of a word", "[word_array][utility]",
+                   uint8_t, uint16_t, uint32_t, uint64_t)
+{
+    using W = TestType;
+    constexpr size_t width = implementation::bits_per_word<W>();
+
+    REQUIRE(implementation::count_trailing_zeroes_word(W{0U}) == width);
+    REQUIRE(implementation::popcount_word(W{0U}) == 0);
+    REQUIRE(implementation::popcount_word(static_cast<W>(~W{0U})) == width);
+    for (size_t i = 0; i < width; ++i)
+    {
+        const auto w = static_cast<W>(W{1U} << i);
+        REQUIRE(implementation::count_trailing_zeroes_word(w) == i);
+        REQUIRE(implementation::popcount_word(w) == 1);
+        // all bits from i upwards are set
+        const auto ones = static_cast<W>(static_cast<W>(~W{0U}) << i);
+        REQUIRE(implementation::count_trailing_zeroes_word(ones) == i);
+        REQUIRE(implementation::popcount_word(ones) == width - i);
+    }
+}
+
+TEST_CASE("Adding and subtracting words with carries", "[word_array][utility]")
+{
+    using W = uint64_t;
+    using D = implementation::double_word_t<W>;
+
+    std::mt19937_64 rng{0x5eed};
+
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        const W a = (i % 3 == 0) ? std::numeric_limits<W>::max() : rng();
+        const W b = (i % 5 == 0) ? std::numeric_limits<W>::max() : rng();
+        const W c = i % 2;
+
+        W carry{0U};
+        const W sum = implementation::add_carry(a, b, c, carry);
+        const D expected_sum = static_cast<D>(a) + static_cast<D>(b) + c;
+        REQUIRE(sum == static_cast<W>(expected_sum));
+        REQUIRE(carry == static_cast<W>(expected_sum >> 64U));
+
+        W borrow{0U};
+        const W difference = implementation::sub_borrow(a, b, c, borrow);
+        const D expected_difference = static_cast<D>(a) - static_cast<D>(b) - c;
+        REQUIRE(difference == static_cast<W>(expected_difference));
+        REQUIRE(borrow == ((static_cast<D>(b) + c > a) ? 1U : 0U));
+    }
+
+    SECTION("The portable implementation is used at compile time")
+    {
+        constexpr W max = std::numeric_limits<W>::max();
+        constexpr auto add_max = []() {
+            W carry{1U};
+            const W sum = implementation::add_carry(max, max, carry, carry);
+            return std::make_pair(sum, carry);
+        }();
+        constexpr auto sub_max = []() {
+            W borrow{1U};
+            const W difference = implementation::sub_borrow(W{0U}, max, borrow, borrow);
+            return std::make_pair(difference, borrow);
+        }();
+        REQUIRE(add_max == std::make_pair(max, W{1U}));
+        REQUIRE(sub_max == std::make_pair(W{0U}, W{1U}));
+    }
+}
@@ -0,0 +1,165 @@
+#include <catch.hpp>
+
+#include <aarith/integer_no_operators.hpp>
+
+#include <thread>
+#include <utility>
+
+using namespace aarith;
+
+#if defined(AARITH_HAS_MEMORY_RESOURCE)
+namespace {
+
+// counts the allocations while forwarding them to the default resource
+class counting_resource : public std::pmr::memory_resource
+{
+public:
+    size_t allocations{0};
+    size_t deallocations{0};
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override
+    {
+        ++deallocations;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+} // namespace
+#endif
+
+SCENARIO("Choosing the storage of the words", "[word_array][utility]")
+{
+    GIVEN("Word arrays of different widths")
+    {
+        THEN("Only the words of huge word arrays are stored on the heap")
+        {
+            REQUIRE_FALSE(implementation::is_heap_storage_v<uint64_t, uinteger<128>::word_count()>);
+            REQUIRE_FALSE(
+                implementation::is_heap_storage_v<uint8_t,
+                                                  uinteger<heap_storage_threshold>::word_count()>);
+            REQUIRE(implementation::is_heap_storage_v<
+                    uint64_t, uinteger<heap_storage_threshold + 64>::word_count()>);
+            REQUIRE(sizeof(uinteger<1'000'000>) <= 2 * sizeof(void*));
+        }
+    }
+}
+
+SCENARIO("Computing with huge numbers stored on the heap", "[integer][unsigned][utility]")
+{
+    using U = uinteger<heap_storage_threshold + 100>;
+
+    GIVEN("Huge numbers")
+    {
+        const U a = U::max();
+        const U b{3U};
+
+        THEN("Copies are independent of each other")
+        {
+            U c{a};
+            c.set_word(0, 0U);
+            REQUIRE(a.word(0) == ~uint64_t{0U});
+            REQUIRE(c.word(0) == 0U);
+            c = a;
+            REQUIRE(c == a);
+        }
+        THEN("Moving takes over the words")
+        {
+            U c{a};
+            const auto* words = &*c.begin();
+            U d{std::move(c)};
+            REQUIRE(&*d.begin() == words);
+            REQUIRE(d == a);
+
+            U e{b};
+            e = std::move(d);
+            REQUIRE(&*e.begin() == words);
+            REQUIRE(e == a);
+        }
+        THEN("Moved-from numbers stay valid and are zero")
+        {
+            U c{a};
+            U d{std::move(c)};
+            REQUIRE(c == U::zero()); // NOLINT(bugprone-use-after-move)
+            REQUIRE(c.word(c.word_count() - 1) == 0U);
+
+            U e{b};
+            e = c;
+            REQUIRE(e == U::zero());
+            const U f{c};
+            REQUIRE(f == U::zero());
+
+            c = add(c, b);
+            REQUIRE(c == b);
+            REQUIRE(d == a);
+        }
+        THEN("Numbers moved from by assignment stay valid and are zero")
+        {
+            U c{a};
+            U d{b};
+            d = std::move(c);
+            REQUIRE(d == a);
+            REQUIRE(c == U::zero()); // NOLINT(bugprone-use-after-move)
+
+            U e{b};
+            e = std::move(d);
+            REQUIRE(e == a);
+            REQUIRE(d == U::zero()); // NOLINT(bugprone-use-after-move)
+            d = b;
+            REQUIRE(d == b);
+        }
+        THEN("The arithmetic operations work as usual")
+        {
+            const U sum = add(a, b);
+            REQUIRE(sum == U{2U});
+            REQUIRE(sub(sum, b) == a);
+            REQUIRE(mul(a, b) == sub(U::zero(), b));
+            const U c = a >> 2;
+            REQUIRE(div(mul(c, b), b) == c);
+            REQUIRE(remainder(add(mul(c, b), U::one()), b) == U::one());
+            REQUIRE(expanding_karazuba(a, a) == expanding_mul(a, a));
+        }
+    }
+
+#if defined(AARITH_HAS_MEMORY_RESOURCE)
+    GIVEN("A memory resource set for a worker thread")
+    {
+        counting_resource resource;
+        bool correct = false;
+
+        // Catch is not thread-safe, the results are checked after joining the thread
+        std::thread worker{[&resource, &correct]() {
+            set_word_memory_resource(&resource);
+            {
+                const U a = U::max();
+                correct = (mul(a, a) == U::one());
+            }
+            set_word_memory_resource(nullptr);
+        }};
+        worker.join();
+
+        REQUIRE(correct);
+
+        THEN("All words are allocated from and returned to the resource")
+        {
+            REQUIRE(resource.allocations > 0);
+            REQUIRE(resource.allocations == resource.deallocations);
+        }
+        THEN("Other threads still use the default resource")
+        {
+            REQUIRE(word_memory_resource() == std::pmr::new_delete_resource());
+        }
+    }
+#endif
+}
@@ -0,0 +1,134 @@
+#include <aarith/float.hpp>
+
+#include "gen_float.hpp"
+
+#include <catch.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace aarith;
+
+namespace {
+
+// all instruction set extensions supported by the processor, the batch operations are tested with
+// each of them
+std::vector<simd_level> supported_levels()
+{
+    std::vector<simd_level> levels{simd_level::scalar};
+    if (static_cast<int>(supported_simd_level()) >= static_cast<int>(simd_level::avx2))
+    {
+        levels.push_back(simd_level::avx2);
+    }
+    if (supported_simd_level() == simd_level::avx512)
+    {
+        levels.push_back(simd_level::avx512);
+    }
+    return levels;
+}
+
+// selects an instruction set extension for the batch operations and restores the previous one
+class simd_level_guard
+{
+public:
+    explicit simd_level_guard(const simd_level level)
+        : previous{batch_simd_level()}
+    {
+        set_batch_simd_level(level);
+    }
+
+    simd_level_guard(const simd_level_guard&) = delete;
+    simd_level_guard& operator=(const simd_level_guard&) = delete;
+
+    ~simd_level_guard()
+    {
+        set_batch_simd_level(previous);
+    }
+
+private:
+    const simd_level previous;
+};
+
+/*
+ * Creates a batch containing random numbers of all kinds, the special values and numbers that are
+ * close to the numbers of the other batch (to provoke cancellation).
+ */
+template <typename B, typename Gen> B random_batch(Gen& gen, const B* other = nullptr)
+{
+    using F = typename B::value_type;
+
+    B batch;
+    for (size_t lane = 0; lane < B::lanes(); ++lane)
+    {
+        batch.set(lane, (other != nullptr) ? random_operand(gen, other->get(lane))
+                                           : random_operand<F>(gen));
+    }
+    return batch;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("Batches of floating-point numbers compute bit-identical results",
+                       "[floating_point][arithmetic][batch]",
+                       ((size_t E, size_t M, size_t N), E, M, N), (3, 2, 16), (4, 3, 13),
+                       (5, 10, 32), (8, 7, 64), (8, 10, 64), (8, 23, 37), (11, 20, 8),
+                       (11, 52, 16), (15, 112, 3))
+{
+    using B = floating_point_batch<E, M, N>;
+
+    const simd_level level = GENERATE(from_range(supported_levels()));
+    const simd_level_guard guard{level};
+
+    std::minstd_rand gen{std::random_device{}()};
+
+    for (size_t round = 0; round < 50; ++round)
+    {
+        const B a = random_batch<B>(gen);
+        const B b = random_batch<B>(gen, &a);
+
+        const B sum = add(a, b);
+        const B difference = sub(a, b);
+        const B product = mul(a, b);
+        const B normalized = normalize(product);
+
+        for (size_t lane = 0; lane < N; ++lane)
+        {
+            const auto x = a.get(lane);
+            const auto y = b.get(lane);
+            CAPTURE(lane, to_binary(x), to_binary(y));
+            REQUIRE(bit_identical(sum.get(lane), add(x, y)));
+            REQUIRE(bit_identical(difference.get(lane), sub(x, y)));
+            REQUIRE(bit_identical(product.get(lane), mul(x, y)));
+            REQUIRE(bit_identical(normalized.get(lane), normalize<E, M, M>(product.get(lane))));
+        }
+    }
+}
+
+SCENARIO("Using batches of floating-point numbers", "[floating_point][batch]")
+{
+    GIVEN("Batches of bfloat16 numbers")
+    {
+        const floating_point_batch<8, 7, 8> a{bfloat16{1.5f}};
+        const floating_point_batch<8, 7, 8> b{bfloat16{-0.25f}};
+
+        THEN("The operators compute the results lane by lane")
+        {
+            const auto sum = a + b;
+            const auto product = a * b;
+            const auto difference = a - b;
+            for (size_t lane = 0; lane < 8; ++lane)
+            {
+                REQUIRE(static_cast<float>(sum.get(lane)) == 1.25f);
+                REQUIRE(static_cast<float>(product.get(lane)) == -0.375f);
+                REQUIRE(static_cast<float>(difference.get(lane)) == 1.75f);
+            }
+        }
+        THEN("The fields are stored in separate batches")
+        {
+            REQUIRE(a.signs().get(3) == uinteger<1>::zero());
+            REQUIRE(b.signs().get(3) == uinteger<1>::one());
+            REQUIRE(a.exponents().get(5) == bfloat16{1.5f}.get_exponent());
+            REQUIRE(a.mantissae().get(7) == bfloat16{1.5f}.get_full_mantissa());
+        }
+    }
+}
@@ -0,0 +1,333 @@
+// use the floating-point unit for the formats matching a native type bit for bit
+#define AARITH_FLOAT_HARDWARE_ARITHMETIC 1
+
+#include <aarith/float.hpp>
+
+#include "gen_float.hpp"
+
+#include <catch.hpp>
+
+#include <cfloat>
+#include <cmath>
+#include <limits>
+#include <random>
+
+using namespace aarith;
+
+namespace {
+
+/*
+ * The exact reference: a finite number is sign * significand * 2^quantum
+ */
+
+template <size_t E, size_t M> int64_t quantum(const floating_point<E, M>& x)
+{
+    constexpr auto bias = static_cast<int64_t>(floating_point<E, M>::bias.word(0));
+    const auto exponent = static_cast<int64_t>(x.get_exponent().word(0));
+    return std::max<int64_t>(exponent, 1) - bias - static_cast<int64_t>(M);
+}
+
+template <size_t E, size_t M> uinteger<M + 1> significand(const floating_point<E, M>& x)
+{
+    uinteger<M + 1> m = width_cast<M + 1>(x.get_mantissa());
+    m.set_bit(M, x.get_exponent() != uinteger<E>::zero());
+    return m;
+}
+
+// rounds sign * m * 2^q to nearest, ties to even
+template <size_t E, size_t M, size_t W>
+floating_point<E, M> round_exact(const bool sign, const uinteger<W>& m, const int64_t q)
+{
+    using F = floating_point<E, M>;
+    constexpr auto bias = static_cast<int64_t>(F::bias.word(0));
+    constexpr auto max_exponent = static_cast<int64_t>(uinteger<E>::max().word(0));
+
+    const auto length = static_cast<int64_t>(W - count_leading_zeroes(m));
+    if (length == 0)
+    {
+        return sign ? F::neg_zero() : F::zero();
+    }
+
+    int64_t result_quantum = std::max(q + length - 1, 1 - bias) - static_cast<int64_t>(M);
+    uinteger<W> r;
+    if (result_quantum <= q)
+    {
+        r = m << static_cast<size_t>(q - result_quantum);
+    }
+    else if (result_quantum - q <= length)
+    {
+        const auto shift = static_cast<size_t>(result_quantum - q);
+        r = m >> shift;
+        const uinteger<W> rest = sub(m, r << shift);
+        const uinteger<W> half = uinteger<W>::one() << (shift - 1);
+        if (rest > half || (rest == half && r.bit(0) == 1))
+        {
+            r = add(r, uinteger<W>::one());
+        }
+    }
+
+    auto result_length = static_cast<int64_t>(W - count_leading_zeroes(r));
+    if (result_length == static_cast<int64_t>(M) + 2)
+    {
+        r = r >> 1;
+        --result_length;
+        ++result_quantum;
+    }
+
+    const bool normal = (result_length == static_cast<int64_t>(M) + 1);
+    const int64_t exponent = normal ? result_quantum + static_cast<int64_t>(M) + bias : 0;
+    if (exponent >= max_exponent)
+    {
+        return sign ? F::neg_infinity() : F::pos_infinity();
+    }
+    return F(sign, uinteger<E>{static_cast<uint64_t>(exponent)}, width_cast<M + 1>(r));
+}
+
+// x + y for finite non-zero numbers
+template <size_t E, size_t M>
+floating_point<E, M> exact_add(const floating_point<E, M>& x, const floating_point<E, M>& y)
+{
+    constexpr size_t W = 2 * M + 8;
+    constexpr auto max_shift = static_cast<int64_t>(M) + 3;
+
+    bool sign_a = x.is_negative();
+    bool sign_b = y.is_negative();
+    uinteger<W> a = width_cast<W>(significand(x));
+    uinteger<W> b = width_cast<W>(significand(y));
+    int64_t quantum_a = quantum(x);
+    int64_t quantum_b = quantum(y);
+    if (quantum_a < quantum_b)
+    {
+        std::swap(sign_a, sign_b);
+        std::swap(a, b);
+        std::swap(quantum_a, quantum_b);
+    }
+
+    // a much smaller summand only decides the direction of rounding: replacing it by a smaller
+    // number of the same sign does not change the rounded sum
+    int64_t shift = quantum_a - quantum_b;
+    if (shift > max_shift)
+    {
+        b = uinteger<W>::one();
+        shift = max_shift;
+    }
+    a = a << static_cast<size_t>(shift);
+    const int64_t q = quantum_a - shift;
+
+    if (sign_a == sign_b)
+    {
+        return round_exact<E, M>(sign_a, add(a, b), q);
+    }
+    if (a == b)
+    {
+        return floating_point<E, M>::zero();
+    }
+    return (a > b) ? round_exact<E, M>(sign_a, sub(a, b), q)
+                   : round_exact<E, M>(sign_b, sub(b, a), q);
+}
+
+// x * y for finite non-zero numbers
+template <size_t E, size_t M>
+floating_point<E, M> exact_mul(const floating_point<E, M>& x, const floating_point<E, M>& y)
+{
+    return round_exact<E, M>(x.is_negative() != y.is_negative(),
+                             expanding_mul(significand(x), significand(y)),
+                             quantum(x) + quantum(y));
+}
+
+// x / y for finite non-zero numbers
+template <size_t E, size_t M>
+floating_point<E, M> exact_div(const floating_point<E, M>& x, const floating_point<E, M>& y)
+{
+    // the quotient has at least M + 3 bits, the remainder is kept as a sticky bit
+    constexpr size_t extra = 2 * M + 4;
+    constexpr size_t W = 3 * M + 8;
+
+    const uinteger<W> numerator = width_cast<W>(significand(x)) << extra;
+    const uinteger<W> denominator = width_cast<W>(significand(y));
+    uinteger<W> quotient = div(numerator, denominator) << 1;
+    quotient.set_bit(0, remainder(numerator, denominator) != uinteger<W>::zero());
+
+    return round_exact<E, M>(x.is_negative() != y.is_negative(), quotient,
+                             quantum(x) - quantum(y) - static_cast<int64_t>(extra) - 1);
+}
+
+enum class operation
+{
+    add,
+    sub,
+    mul,
+    div
+};
+
+template <size_t E, size_t M>
+floating_point<E, M> reference(const floating_point<E, M>& x, const floating_point<E, M>& y,
+                               const operation op)
+{
+    using F = floating_point<E, M>;
+
+    if (x.is_nan() || y.is_nan())
+    {
+        // NaNs are propagated exactly like the software implementation does
+        switch (op)
+        {
+        case operation::add: return implementation::generic_add(x, y);
+        case operation::sub: return implementation::generic_sub(x, y);
+        case operation::mul: return implementation::generic_mul(x, y);
+        default: return implementation::generic_div(x, y);
+        }
+    }
+
+    if (x.is_inf() || x.is_zero() || y.is_inf() || y.is_zero())
+    {
+        // the special cases are the ones of double, where all other numbers behave like one
+        const auto classify = [](const F& v) {
+            const double magnitude =
+                v.is_inf() ? std::numeric_limits<double>::infinity() : (v.is_zero() ? 0.0 : 1.0);
+            return v.is_negative() ? -magnitude : magnitude;
+        };
+        const double a = classify(x);
+        const double b = classify(y);
+        double result = 0.0;
+        switch (op)
+        {
+        case operation::add: result = a + b; break;
+        case operation::sub: result = a - b; break;
+        case operation::mul: result = a * b; break;
+        default: result = a / b; break;
+        }
+
+        if (std::isnan(result))
+        {
+            return F::NaN();
+        }
+        if (std::isinf(result))
+        {
+            return std::signbit(result) ? F::neg_infinity() : F::pos_infinity();
+        }
+        if (result == 0.0)
+        {
+            return std::signbit(result) ? F::neg_zero() : F::zero();
+        }
+        // the sum or difference of zero and a finite number
+        if (!x.is_zero())
+        {
+            return x;
+        }
+        F negated = y;
+        negated.set_sign(negated.get_sign() != (op == operation::sub));
+        return negated;
+    }
+
+    switch (op)
+    {
+    case operation::add: return exact_add(x, y);
+    case operation::sub: {
+        F negated = y;
+        negated.set_sign(!negated.get_sign());
+        return exact_add(x, negated);
+    }
+    case operation::mul: return exact_mul(x, y);
+    default: return exact_div(x, y);
+    }
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("The native types compute correctly rounded results for wide formats",
+                       "[floating_point][arithmetic][hardware]", ((size_t E, size_t M), E, M),
+                       (15, 63), (15, 112))
+{
+    using F = floating_point<E, M>;
+    if constexpr (implementation::float_hardware_kernels<E, M>)
+    {
+        STATIC_REQUIRE(implementation::float_hardware_exact<E, M>);
+
+        std::minstd_rand gen{std::random_device{}()};
+
+        F x = F::one();
+        for (size_t round = 0; round < 2000; ++round)
+        {
+            x = random_operand(gen, x);
+            const F y = random_operand(gen, x);
+            CAPTURE(to_binary(x), to_binary(y));
+
+            // the conversions keep all bits (infinities do not store the hidden bit)
+            if (!x.is_nan())
+            {
+                const F converted =
+                    implementation::from_hardware_float<E, M>(implementation::to_hardware_float(x));
+                const F infinity = x.is_negative() ? F::neg_infinity() : F::pos_infinity();
+                REQUIRE(bit_identical(converted, x.is_inf() ? infinity : x));
+            }
+
+            REQUIRE(bit_identical(hardware_add(x, y), reference(x, y, operation::add)));
+            REQUIRE(bit_identical(hardware_sub(x, y), reference(x, y, operation::sub)));
+            REQUIRE(bit_identical(hardware_mul(x, y), reference(x, y, operation::mul)));
+            REQUIRE(bit_identical(hardware_div(x, y), reference(x, y, operation::div)));
+
+            // the operations use the native types due to AARITH_FLOAT_HARDWARE_ARITHMETIC
+            REQUIRE(bit_identical(add(x, y), hardware_add(x, y)));
+            REQUIRE(bit_identical(mul(x, y), hardware_mul(x, y)));
+
+            if constexpr (implementation::float_hardware_fma<E, M>)
+            {
+                const F z = random_operand(gen, y);
+                CAPTURE(to_binary(z));
+                REQUIRE(bit_identical(hardware_fma(x, y, z), implementation::generic_fma(x, y, z)));
+            }
+            if constexpr (implementation::float_hardware_sqrt<E, M>)
+            {
+                REQUIRE(bit_identical(sqrt(x), hardware_sqrt(x)));
+                REQUIRE(bit_identical(hardware_sqrt(x), implementation::generic_sqrt(x)));
+            }
+        }
+    }
+}
+
+#if defined(__x86_64__) && defined(__SIZEOF_INT128__) && (LDBL_MANT_DIG == 64) &&                 \
+    (LDBL_MAX_EXP == 16384)
+SCENARIO("Computing with the extended precision of x87", "[floating_point][arithmetic][hardware]")
+{
+    GIVEN("Numbers of extended precision")
+    {
+        const extended_precision one = extended_precision::one();
+        const extended_precision three = add(add(one, one), one);
+
+        THEN("They are the ones of long double")
+        {
+            const long double third = 1.0L / 3.0L;
+            REQUIRE(implementation::to_hardware_float(div(one, three)) == third);
+            REQUIRE(implementation::to_hardware_float(extended_precision::max()) ==
+                    std::numeric_limits<long double>::max());
+            REQUIRE(implementation::to_hardware_float(
+                        extended_precision::smallest_denormalized()) ==
+                    std::numeric_limits<long double>::denorm_min());
+            REQUIRE(implementation::to_hardware_float(extended_precision::neg_infinity()) ==
+                    -std::numeric_limits<long double>::infinity());
+        }
+    }
+}
+#endif
+
+#if defined(__SIZEOF_FLOAT128__) && defined(__SIZEOF_INT128__)
+SCENARIO("Computing with __float128", "[floating_point][arithmetic][hardware]")
+{
+    GIVEN("Numbers of quadruple precision")
+    {
+        const quadruple_precision one = quadruple_precision::one();
+        const quadruple_precision three = add(add(one, one), one);
+
+        THEN("They are the ones of __float128")
+        {
+            const implementation::float128_t native_one = 1;
+            const implementation::float128_t third = native_one / 3;
+            REQUIRE(implementation::to_hardware_float(one) == native_one);
+            REQUIRE(implementation::to_hardware_float(div(one, three)) == third);
+            REQUIRE(static_cast<double>(third) == 1.0 / 3.0);
+            REQUIRE(implementation::to_hardware_float(quadruple_precision::neg_infinity()) <
+                    -static_cast<implementation::float128_t>(std::numeric_limits<double>::max()));
+        }
+    }
+}
+#endif
@@ -0,0 +1,198 @@
+#include <aarith/float.hpp>
+
+#include "gen_float.hpp"
+
+#include <catch.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace aarith;
+
+namespace {
+
+// NaN operands are propagated like the other operations do
+template <typename F> F propagated_nan(const F& a, const F& b, const F& c)
+{
+    if (a.is_nan())
+    {
+        return a.make_quiet_nan();
+    }
+    return b.is_nan() ? b.make_quiet_nan() : c.make_quiet_nan();
+}
+
+// the exact value of a number that is not NaN
+template <size_t E, size_t M> double exact_value(const floating_point<E, M>& x)
+{
+    const double sign = x.is_negative() ? -1.0 : 1.0;
+    if (x.is_inf())
+    {
+        return sign * std::numeric_limits<double>::infinity();
+    }
+    const auto bias = static_cast<int>(floating_point<E, M>::bias.word(0));
+    const auto exponent = static_cast<int>(x.get_exponent().word(0));
+    const auto mantissa = static_cast<double>(x.get_full_mantissa().word(0));
+    return sign * std::ldexp(mantissa, std::max(exponent, 1) - bias - static_cast<int>(M));
+}
+
+// rounds to the nearest number of the format (ties to even) using the rounding of the host
+template <size_t E, size_t M> double round_to_format(const double x)
+{
+    if (x == 0.0 || std::isinf(x))
+    {
+        return x;
+    }
+    const auto bias = static_cast<int>(floating_point<E, M>::bias.word(0));
+    const int scale = std::max(std::ilogb(x), 1 - bias) - static_cast<int>(M);
+    const double rounded = std::ldexp(std::nearbyint(std::ldexp(x, -scale)), scale);
+    if (std::fabs(rounded) >= std::ldexp(1.0, bias + 1))
+    {
+        return std::copysign(std::numeric_limits<double>::infinity(), x);
+    }
+    return rounded;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("The fused multiply-add equals the one of the native types",
+                       "[floating_point][arithmetic][fma]", ((size_t E, size_t M), E, M), (8, 23),
+                       (11, 52))
+{
+    using F = floating_point<E, M>;
+    std::minstd_rand gen{std::random_device{}()};
+
+    for (size_t round = 0; round < 2000; ++round)
+    {
+        const F a = random_operand<F>(gen);
+        const F b = random_operand<F>(gen);
+        // addends close to the negated product provoke cancellation
+        const F c = (gen() % 3 == 0) ? negate(mul(a, b)) : random_operand<F>(gen);
+        CAPTURE(to_binary(a), to_binary(b), to_binary(c));
+
+        const F result = fma(a, b, c);
+        if (a.is_nan() || b.is_nan() || c.is_nan())
+        {
+            REQUIRE(bit_identical(result, propagated_nan(a, b, c)));
+            continue;
+        }
+
+        using implementation::to_hardware_float;
+        const auto expected =
+            std::fma(to_hardware_float(a), to_hardware_float(b), to_hardware_float(c));
+        if (std::isnan(expected))
+        {
+            REQUIRE(bit_identical(result, F::NaN()));
+        }
+        else
+        {
+            REQUIRE(bit_identical(result, implementation::from_hardware_float<E, M>(expected)));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_SIG("The fused multiply-add rounds the exact result once",
+                       "[floating_point][arithmetic][fma]", ((size_t E, size_t M), E, M), (3, 2),
+                       (4, 3))
+{
+    using F = floating_point<E, M>;
+
+    // all values of these formats are small enough for double to compute a*b+c exactly
+    const auto all_values = [] {
+        std::vector<F> values;
+        for (uint64_t bits = 0; bits < (uint64_t{1U} << (E + M + 1)); ++bits)
+        {
+            values.push_back(F(word_array<E + M + 1>{bits}));
+        }
+        return values;
+    }();
+    std::minstd_rand gen{std::random_device{}()};
+
+    for (const F& a : all_values)
+    {
+        for (const F& b : all_values)
+        {
+            const F c = all_values[gen() % all_values.size()];
+            CAPTURE(to_binary(a), to_binary(b), to_binary(c));
+
+            const F result = fma(a, b, c);
+            if (a.is_nan() || b.is_nan() || c.is_nan())
+            {
+                REQUIRE(bit_identical(result, propagated_nan(a, b, c)));
+                continue;
+            }
+
+            const double exact = exact_value(a) * exact_value(b) + exact_value(c);
+            if (std::isnan(exact))
+            {
+                REQUIRE(bit_identical(result, F::NaN()));
+                continue;
+            }
+            const double expected = round_to_format<E, M>(exact);
+            REQUIRE_FALSE(result.is_nan());
+            REQUIRE(exact_value(result) == expected);
+            if (expected == 0.0 && exact == 0.0)
+            {
+                // the sign of exact zeroes follows IEEE 754 (computed by the host)
+                const double host = std::fma(exact_value(a), exact_value(b), exact_value(c));
+                REQUIRE(result.is_negative() == std::signbit(host));
+            }
+            else
+            {
+                REQUIRE(result.is_negative() == std::signbit(expected));
+            }
+        }
+    }
+}
+
+SCENARIO("Computing the fused multiply-add", "[floating_point][arithmetic][fma]")
+{
+    using F = single_precision;
+
+    GIVEN("A product that is cancelled by the addend")
+    {
+        // a = 1 + 2^-23, a * a = 1 + 2^-22 + 2^-46
+        const F a{1.0f + std::ldexp(1.0f, -23)};
+        const F c{-(1.0f + std::ldexp(1.0f, -22))};
+
+        THEN("The low bits of the product are kept")
+        {
+            REQUIRE(static_cast<float>(fma(a, a, c)) == std::ldexp(1.0f, -46));
+        }
+    }
+
+    GIVEN("Special values")
+    {
+        const F one = F::one();
+        const F inf = F::pos_infinity();
+
+        THEN("The invalid operations return NaN")
+        {
+            REQUIRE(fma(F::zero(), inf, one).is_nan());
+            REQUIRE(fma(inf, F::neg_zero(), one).is_nan());
+            REQUIRE(fma(inf, one, F::neg_infinity()).is_nan());
+            REQUIRE(fma(F::neg_infinity(), one, inf).is_nan());
+        }
+
+        THEN("Infinities are kept")
+        {
+            REQUIRE(bit_identical(fma(inf, one, inf), inf));
+            REQUIRE(bit_identical(fma(one, F::neg_infinity(), one), F::neg_infinity()));
+            REQUIRE(bit_identical(fma(one, one, F::neg_infinity()), F::neg_infinity()));
+            REQUIRE(bit_identical(fma(F::max(), F::max(), F::min()), inf));
+        }
+
+        THEN("Zeroes get the sign of IEEE 754")
+        {
+            REQUIRE(bit_identical(fma(F::neg_zero(), one, F::neg_zero()), F::neg_zero()));
+            REQUIRE(bit_identical(fma(F::zero(), one, F::neg_zero()), F::zero()));
+            REQUIRE(bit_identical(fma(one, one, negate(one)), F::zero()));
+            REQUIRE(bit_identical(fma(F::smallest_denormalized(), F::smallest_denormalized(),
+                                      F::neg_zero()),
+                                  F::zero()));
+            REQUIRE(bit_identical(fma(negate(F::smallest_denormalized()),
+                                      F::smallest_denormalized(), F::zero()),
+                                  F::neg_zero()));
+        }
+    }
+}
@@ -0,0 +1,175 @@
+// use the floating-point unit for all formats supporting it
+#define AARITH_FLOAT_HARDWARE_ARITHMETIC 2
+
+#include <aarith/float.hpp>
+
+#include "gen_float.hpp"
+
+#include <catch.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <random>
+
+using namespace aarith;
+
+namespace {
+
+// the exact value of a number that is not NaN
+template <size_t E, size_t M> double exact_value(const floating_point<E, M>& x)
+{
+    const double sign = x.is_negative() ? -1.0 : 1.0;
+    if (x.is_inf())
+    {
+        return sign * std::numeric_limits<double>::infinity();
+    }
+    const auto bias = static_cast<int>(floating_point<E, M>::bias.word(0));
+    const auto exponent = static_cast<int>(x.get_exponent().word(0));
+    const auto mantissa = static_cast<double>(x.get_full_mantissa().word(0));
+    return sign * std::ldexp(mantissa, std::max(exponent, 1) - bias - static_cast<int>(M));
+}
+
+// rounds to the nearest number of the format (ties to even) using the rounding of the host
+template <size_t E, size_t M> double round_to_format(const double x)
+{
+    if (x == 0.0 || std::isinf(x))
+    {
+        return x;
+    }
+    const auto bias = static_cast<int>(floating_point<E, M>::bias.word(0));
+    const int scale = std::max(std::ilogb(x), 1 - bias) - static_cast<int>(M);
+    const double rounded = std::ldexp(std::nearbyint(std::ldexp(x, -scale)), scale);
+    if (std::fabs(rounded) >= std::ldexp(1.0, bias + 1))
+    {
+        return std::copysign(std::numeric_limits<double>::infinity(), x);
+    }
+    return rounded;
+}
+
+template <typename F, typename Software, typename Hardware, typename Reference>
+void check_operation(const F& x, const F& y, Software software, Hardware hardware,
+                     Reference reference)
+{
+    const F result = hardware(x, y);
+    if (x.is_nan() || y.is_nan())
+    {
+        // NaNs are propagated exactly like the software implementation does
+        REQUIRE(bit_identical(result, software(x, y)));
+        return;
+    }
+
+    const double expected = reference(exact_value(x), exact_value(y));
+    if (std::isnan(expected))
+    {
+        REQUIRE(bit_identical(result, F::NaN()));
+        return;
+    }
+    REQUIRE_FALSE(result.is_nan());
+    const double value = exact_value(result);
+    REQUIRE(value == expected);
+    REQUIRE(std::signbit(value) == std::signbit(expected));
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("The floating-point unit computes correctly rounded results",
+                       "[floating_point][arithmetic][hardware]", ((size_t E, size_t M), E, M),
+                       (3, 2), (4, 3), (5, 10), (8, 7), (8, 10), (9, 24), (8, 23), (11, 52))
+{
+    using F = floating_point<E, M>;
+    STATIC_REQUIRE(implementation::float_hardware_kernels<E, M>);
+
+    std::minstd_rand gen{std::random_device{}()};
+
+    const auto rounded = [](auto operation) {
+        return [operation](const double a, const double b) {
+            return round_to_format<E, M>(operation(a, b));
+        };
+    };
+
+    for (size_t round = 0; round < 2000; ++round)
+    {
+        const F x = random_operand<F>(gen);
+        const F y = random_operand<F>(gen);
+        CAPTURE(to_binary(x), to_binary(y));
+
+        check_operation(
+            x, y, [](const F& a, const F& b) { return implementation::generic_add(a, b); },
+            [](const F& a, const F& b) { return hardware_add(a, b); },
+            rounded([](const double a, const double b) { return a + b; }));
+        check_operation(
+            x, y, [](const F& a, const F& b) { return implementation::generic_sub(a, b); },
+            [](const F& a, const F& b) { return hardware_sub(a, b); },
+            rounded([](const double a, const double b) { return a - b; }));
+        check_operation(
+            x, y, [](const F& a, const F& b) { return implementation::generic_mul(a, b); },
+            [](const F& a, const F& b) { return hardware_mul(a, b); },
+            rounded([](const double a, const double b) { return a * b; }));
+
+        // the quotient computed in double is only correctly rounded for the narrow formats
+        if constexpr (M < 52)
+        {
+            check_operation(
+                x, y, [](const F& a, const F& b) { return implementation::generic_div(a, b); },
+                [](const F& a, const F& b) { return hardware_div(a, b); },
+                rounded([](const double a, const double b) { return a / b; }));
+        }
+
+        // the operations use the floating-point unit due to AARITH_FLOAT_HARDWARE_ARITHMETIC
+        REQUIRE(bit_identical(add(x, y), hardware_add(x, y)));
+        REQUIRE(bit_identical(sub(x, y), hardware_sub(x, y)));
+        REQUIRE(bit_identical(mul(x, y), hardware_mul(x, y)));
+        REQUIRE(bit_identical(div(x, y), hardware_div(x, y)));
+
+        // both fused multiply-adds are correctly rounded
+        if constexpr (implementation::float_hardware_fma<E, M>)
+        {
+            const F z = random_operand<F>(gen);
+            CAPTURE(to_binary(z));
+            REQUIRE(bit_identical(fma(x, y, z), hardware_fma(x, y, z)));
+            REQUIRE(bit_identical(hardware_fma(x, y, z), implementation::generic_fma(x, y, z)));
+        }
+
+        // the square root computed in double is correctly rounded for all these formats
+        REQUIRE(bit_identical(sqrt(x), hardware_sqrt(x)));
+        REQUIRE(bit_identical(hardware_sqrt(x), implementation::generic_sqrt(x)));
+    }
+}
+
+SCENARIO("Computing with the floating-point unit", "[floating_point][arithmetic][hardware]")
+{
+    GIVEN("Numbers whose sum is a tie")
+    {
+        const half_precision a{2048.0f};
+        const half_precision b{1.0f};
+        const half_precision c{3.0f};
+
+        THEN("The sum is rounded to even")
+        {
+            REQUIRE(static_cast<float>(hardware_add(a, b)) == 2048.0f);
+            REQUIRE(static_cast<float>(hardware_add(a, c)) == 2052.0f);
+        }
+    }
+
+    GIVEN("Double precision numbers")
+    {
+        const double_precision a{0.1};
+        const double_precision b{0.2};
+
+        THEN("The results are the ones of double")
+        {
+            REQUIRE(static_cast<double>(hardware_add(a, b)) == 0.1 + 0.2);
+            REQUIRE(static_cast<double>(hardware_div(a, b)) == 0.1 / 0.2);
+        }
+    }
+
+    GIVEN("Formats that are too wide")
+    {
+        THEN("The floating-point unit is not used")
+        {
+            REQUIRE_FALSE(implementation::float_hardware_kernels<10, 24>);
+            REQUIRE_FALSE(implementation::float_hardware_kernels<9, 25>);
+            REQUIRE_FALSE(implementation::float_hardware_kernels<16, 112>);
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#include <aarith/float.hpp>
+
+#include "gen_float.hpp"
+
+#include <catch.hpp>
+
+#include <random>
+
+using namespace aarith;
+
+TEMPLATE_TEST_CASE_SIG("The native kernels compute bit-identical results",
+                       "[floating_point][arithmetic][native]", ((size_t E, size_t M), E, M),
+                       (3, 2), (4, 3), (5, 10), (8, 7), (8, 10), (8, 23), (11, 20), (11, 52),
+                       (11, 61), (8, 62), (15, 63))
+{
+    using F = floating_point<E, M>;
+    std::minstd_rand gen{std::random_device{}()};
+
+    F x = F::one();
+    for (size_t round = 0; round < 2000; ++round)
+    {
+        x = random_operand(gen, x);
+        const F y = random_operand(gen, x);
+
+        CAPTURE(to_binary(x), to_binary(y));
+        REQUIRE(bit_identical(add(x, y), implementation::generic_add(x, y)));
+        REQUIRE(bit_identical(sub(x, y), implementation::generic_sub(x, y)));
+        REQUIRE(bit_identical(mul(x, y), implementation::generic_mul(x, y)));
+        REQUIRE(bit_identical(div(x, y), implementation::generic_div(x, y)));
+
+        // addends close to the negated product provoke cancellation
+        const F z = (gen() % 3 == 0) ? negate(mul(x, y)) : random_operand(gen, y);
+        CAPTURE(to_binary(z));
+        REQUIRE(bit_identical(fma(x, y, z), implementation::generic_fma(x, y, z)));
+        REQUIRE(bit_identical(sqrt(x), implementation::generic_sqrt(x)));
+    }
+}
+
+#if defined(__SIZEOF_INT128__)
+SCENARIO("Choosing the native kernels", "[floating_point][native]")
+{
+    GIVEN("Formats of different widths")
+    {
+        THEN("Only formats whose mantissa fits into a word use the native kernels")
+        {
+            REQUIRE(implementation::float_native_kernels<5, 10>);
+            REQUIRE(implementation::float_native_kernels<8, 23>);
+            REQUIRE(implementation::float_native_kernels<11, 52>);
+            REQUIRE_FALSE(implementation::float_native_kernels<15, 64>);
+            REQUIRE_FALSE(implementation::float_native_kernels<15, 112>);
+        }
+
+        THEN("Only formats whose product of the mantissae is narrow enough use the native fma")
+        {
+            REQUIRE(implementation::float_native_fma_kernels<11, 52>);
+            REQUIRE(implementation::float_native_fma_kernels<11, 61>);
+            REQUIRE_FALSE(implementation::float_native_fma_kernels<8, 62>);
+            REQUIRE_FALSE(implementation::float_native_fma_kernels<15, 63>);
+        }
+
+        THEN("Only formats whose shifted mantissa fits into 128 bits use the native sqrt")
+        {
+            REQUIRE(implementation::float_native_sqrt_kernels<11, 52>);
+            REQUIRE(implementation::float_native_sqrt_kernels<8, 62>);
+            REQUIRE_FALSE(implementation::float_native_sqrt_kernels<15, 63>);
+        }
+    }
+}
+#endif
@@ -0,0 +1,271 @@
+#include <aarith/float.hpp>
+#include <aarith/float/float_approx_operations.hpp>
+
+#include "gen_float.hpp"
+
+#include <catch.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace aarith;
+
+namespace {
+
+// the exact value of a number that is not NaN
+template <size_t E, size_t M> double exact_value(const floating_point<E, M>& x)
+{
+    const double sign = x.is_negative() ? -1.0 : 1.0;
+    if (x.is_inf())
+    {
+        return sign * std::numeric_limits<double>::infinity();
+    }
+    const auto bias = static_cast<int>(floating_point<E, M>::bias.word(0));
+    const auto exponent = static_cast<int>(x.get_exponent().word(0));
+    const auto mantissa = static_cast<double>(x.get_full_mantissa().word(0));
+    return sign * std::ldexp(mantissa, std::max(exponent, 1) - bias - static_cast<int>(M));
+}
+
+// rounds to the nearest number of the format (ties to even) using the rounding of the host
+template <size_t E, size_t M> double round_to_format(const double x)
+{
+    if (x == 0.0 || std::isinf(x))
+    {
+        return x;
+    }
+    const auto bias = static_cast<int>(floating_point<E, M>::bias.word(0));
+    const int scale = std::max(std::ilogb(x), 1 - bias) - static_cast<int>(M);
+    const double rounded = std::ldexp(std::nearbyint(std::ldexp(x, -scale)), scale);
+    if (std::fabs(rounded) >= std::ldexp(1.0, bias + 1))
+    {
+        return std::copysign(std::numeric_limits<double>::infinity(), x);
+    }
+    return rounded;
+}
+
+/*
+ * Whether r is the square root of x rounded to nearest: the squares of the midpoints between r and
+ * its neighbours have to enclose x, which is checked using integers.
+ */
+template <size_t E, size_t M>
+bool is_rounded_sqrt(const floating_point<E, M>& x, const floating_point<E, M>& r)
+{
+    constexpr size_t W = 4 * M + 16;
+    using U = uinteger<W>;
+
+    const auto bias = static_cast<int64_t>(floating_point<E, M>::bias.word(0));
+    const auto quantum = [bias](const floating_point<E, M>& v) {
+        return std::max<int64_t>(static_cast<int64_t>(v.get_exponent().word(0)), 1) - bias -
+               static_cast<int64_t>(M);
+    };
+
+    // the midpoints in multiples of 2^(quantum(r) - 2), the lower neighbour of a power of two is
+    // only half as far away
+    const U scaled = width_cast<W>(r.get_full_mantissa()) << 2U;
+    const bool power_of_two = r.get_mantissa().is_zero() && r.get_exponent().word(0) > 1;
+    const U lower = sub(scaled, U{power_of_two ? 1U : 2U});
+    const U upper = add(scaled, U{2U});
+    const int64_t midpoint_quantum = 2 * (quantum(r) - 2);
+
+    U radicand = width_cast<W>(x.get_full_mantissa());
+    U lower_square = mul(lower, lower);
+    U upper_square = mul(upper, upper);
+    const int64_t difference = quantum(x) - midpoint_quantum;
+    if (difference >= 0)
+    {
+        radicand <<= static_cast<size_t>(difference);
+    }
+    else
+    {
+        lower_square <<= static_cast<size_t>(-difference);
+        upper_square <<= static_cast<size_t>(-difference);
+    }
+    return lower_square < radicand && radicand < upper_square;
+}
+
+template <typename F> void check_special_cases(const F& x, const F& result)
+{
+    if (x.is_nan())
+    {
+        REQUIRE(bit_identical(result, x.make_quiet_nan()));
+    }
+    else if (x.is_zero())
+    {
+        REQUIRE(bit_identical(result, x));
+    }
+    else if (x.is_negative())
+    {
+        REQUIRE(bit_identical(result, F::NaN()));
+    }
+    else if (x.is_inf())
+    {
+        REQUIRE(bit_identical(result, F::pos_infinity()));
+    }
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("The square root is correctly rounded for all numbers of small formats",
+                       "[floating_point][arithmetic][sqrt]", ((size_t E, size_t M), E, M), (2, 3),
+                       (3, 2), (4, 3), (5, 10), (8, 7))
+{
+    using F = floating_point<E, M>;
+
+    for (uint64_t bits = 0; bits < (uint64_t{1U} << (E + M + 1)); ++bits)
+    {
+        const F x(word_array<E + M + 1>{bits});
+        CAPTURE(to_binary(x));
+
+        const F result = sqrt(x);
+        REQUIRE(bit_identical(result, implementation::generic_sqrt(x)));
+        if (x.is_nan() || x.is_zero() || x.is_negative() || x.is_inf())
+        {
+            check_special_cases(x, result);
+            continue;
+        }
+
+        // the square root in double is precise enough to be rounded a second time
+        REQUIRE(exact_value(result) == round_to_format<E, M>(std::sqrt(exact_value(x))));
+        REQUIRE_FALSE(result.is_negative());
+    }
+}
+
+TEMPLATE_TEST_CASE_SIG("The square root equals the one of the native types",
+                       "[floating_point][arithmetic][sqrt]", ((size_t E, size_t M), E, M), (8, 23),
+                       (11, 52))
+{
+    using F = floating_point<E, M>;
+    std::minstd_rand gen{std::random_device{}()};
+
+    for (size_t round = 0; round < 5000; ++round)
+    {
+        const F x = random_operand<F>(gen);
+        CAPTURE(to_binary(x));
+
+        const F result = sqrt(x);
+        REQUIRE(bit_identical(result, implementation::generic_sqrt(x)));
+        if (x.is_nan())
+        {
+            check_special_cases(x, result);
+            continue;
+        }
+
+        using implementation::to_hardware_float;
+        const auto expected = std::sqrt(to_hardware_float(x));
+        if (std::isnan(expected))
+        {
+            REQUIRE(bit_identical(result, F::NaN()));
+        }
+        else
+        {
+            REQUIRE(bit_identical(result, implementation::from_hardware_float<E, M>(expected)));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_SIG("The square root of wide formats is correctly rounded",
+                       "[floating_point][arithmetic][sqrt]", ((size_t E, size_t M), E, M),
+                       (11, 61), (15, 63), (15, 112), (20, 150))
+{
+    using F = floating_point<E, M>;
+    std::minstd_rand gen{std::random_device{}()};
+
+    for (size_t round = 0; round < 500; ++round)
+    {
+        const F x = random_operand<F>(gen);
+        CAPTURE(to_binary(x));
+
+        const F result = sqrt(x);
+        REQUIRE(bit_identical(result, implementation::generic_sqrt(x)));
+        if (x.is_nan() || x.is_zero() || x.is_negative() || x.is_inf())
+        {
+            check_special_cases(x, result);
+            continue;
+        }
+
+        REQUIRE_FALSE(result.is_negative());
+        REQUIRE(is_rounded_sqrt(x, result));
+    }
+}
+
+TEMPLATE_TEST_CASE_SIG("The anytime square root computes the leading bits of the mantissa",
+                       "[floating_point][arithmetic][sqrt][anytime]", ((size_t E, size_t M), E, M),
+                       (8, 23), (11, 52))
+{
+    using F = floating_point<E, M>;
+    std::minstd_rand gen{std::random_device{}()};
+    floating_point_distribution<E, M, FloatGenerationModes::NormalizedOnly> normalized;
+
+    for (size_t round = 0; round < 500; ++round)
+    {
+        const F x = abs(normalized(gen));
+        CAPTURE(to_binary(x));
+
+        // computing all bits truncates the exact square root
+        const F full = anytime_sqrt(x);
+        const F rounded = sqrt(x);
+        REQUIRE(full <= rounded);
+        if (full.get_exponent() == rounded.get_exponent())
+        {
+            const auto difference = sub(rounded.get_full_mantissa(), full.get_full_mantissa());
+            REQUIRE(difference <= uinteger<M + 1>::one());
+        }
+        else
+        {
+            // rounding up carried into the next power of two
+            REQUIRE(rounded.get_mantissa().is_zero());
+            REQUIRE(full.get_mantissa() == uinteger<M>::all_ones());
+        }
+
+        // computing less bits keeps the leading bits and clears the others
+        const unsigned int bits = 1U + gen() % (M + 1);
+        CAPTURE(bits);
+        const F approximation = anytime_sqrt(x, bits);
+        const auto mantissa = approximation.get_full_mantissa();
+        const auto cleared = (mantissa >> (M + 1 - bits)) << (M + 1 - bits);
+        REQUIRE(approximation.get_exponent() == full.get_exponent());
+        REQUIRE(mantissa == cleared);
+        REQUIRE(cleared == ((full.get_full_mantissa() >> (M + 1 - bits)) << (M + 1 - bits)));
+    }
+}
+
+SCENARIO("Computing the square root", "[floating_point][arithmetic][sqrt]")
+{
+    using F = single_precision;
+
+    GIVEN("Perfect squares")
+    {
+        THEN("The square root is exact")
+        {
+            REQUIRE(static_cast<float>(sqrt(F{4.0f})) == 2.0f);
+            REQUIRE(static_cast<float>(sqrt(F{0.25f})) == 0.5f);
+            REQUIRE(static_cast<float>(sqrt(F{std::ldexp(1.0f, -148)})) == std::ldexp(1.0f, -74));
+        }
+    }
+
+    GIVEN("Special values")
+    {
+        THEN("The results follow IEEE 754")
+        {
+            REQUIRE(bit_identical(sqrt(F::zero()), F::zero()));
+            REQUIRE(bit_identical(sqrt(F::neg_zero()), F::neg_zero()));
+            REQUIRE(bit_identical(sqrt(F::pos_infinity()), F::pos_infinity()));
+            REQUIRE(sqrt(F::neg_infinity()).is_nan());
+            REQUIRE(sqrt(negate(F::one())).is_nan());
+            REQUIRE(sqrt(F::sNaN()).is_qNaN());
+        }
+    }
+
+    GIVEN("Only the leading bits of the anytime square root")
+    {
+        const F two{2.0f};
+
+        THEN("The other bits of the mantissa are zero")
+        {
+            // sqrt(2) = 1.0110101000001...
+            REQUIRE(static_cast<float>(anytime_sqrt(two, 4)) == 1.375f);
+            REQUIRE(static_cast<float>(anytime_sqrt(two, 1)) == 1.0f);
+        }
+    }
+}
@@ -3,6 +3,10 @@
 #include <aarith/float.hpp>
 #include <catch.hpp>
 
+#include <array>
+#include <memory>
+#include <random>
+
 namespace aarith {
 
 template <size_t E, size_t M, FloatGenerationModes Mode = FloatGenerationModes::NonSpecial,
@@ -45,4 +49,77 @@ auto random_float() -> Catch::Generators::GeneratorWrapper<floating_point<E, M,
             new FloatGenerator<E, M, Mode, WordType>()));
 }
 
-} // namespace aarith
\ No newline at end of file
+/**
+ * @brief Whether both numbers have the same sign, exponent and mantissa (e.g. the same NaN)
+ */
+template <typename F> bool bit_identical(const F& lhs, const F& rhs)
+{
+    return lhs.get_sign() == rhs.get_sign() && lhs.get_exponent() == rhs.get_exponent() &&
+           lhs.get_full_mantissa() == rhs.get_full_mantissa();
+}
+
+/**
+ * @brief The special values and the extreme numbers of the format
+ */
+template <typename F> std::array<F, 11> special_floats()
+{
+    return {F::zero(),         F::neg_zero(),
+            F::pos_infinity(), F::neg_infinity(),
+            F::qNaN(),         F::sNaN(),
+            F::one(),          F::smallest_denormalized(),
+            F::max(),          F::smallest_normalized(),
+            F::min()};
+}
+
+/**
+ * @brief Returns the given number with the last bit of the mantissa flipped and a random sign
+ */
+template <typename F, typename Gen> F close_float(Gen& gen, const F& other)
+{
+    F close = other;
+    auto mantissa = close.get_mantissa();
+    mantissa.set_bit(0, !mantissa.bit(0));
+    close.set_mantissa(mantissa);
+    close.set_sign(gen() % 2);
+    return close;
+}
+
+/**
+ * @brief Returns special values, subnormal numbers, numbers that are not special and fully random
+ * numbers with the same probability
+ */
+template <typename F, typename Gen> F random_operand(Gen& gen)
+{
+    constexpr size_t E = F::exponent_width();
+    constexpr size_t M = F::mantissa_width();
+
+    floating_point_distribution<E, M, FloatGenerationModes::FullyRandom> fully_random;
+    floating_point_distribution<E, M, FloatGenerationModes::NonSpecial> non_special;
+    floating_point_distribution<E, M, FloatGenerationModes::DenormalizedOnly> denormalized;
+
+    switch (gen() % 4)
+    {
+    case 0: {
+        const auto specials = special_floats<F>();
+        return specials[gen() % specials.size()];
+    }
+    case 1: return denormalized(gen);
+    case 2: return non_special(gen);
+    default: return fully_random(gen);
+    }
+}
+
+/**
+ * @brief Like random_operand, but also returns numbers that are close to the given number (to
+ * provoke cancellation)
+ */
+template <typename F, typename Gen> F random_operand(Gen& gen, const F& other)
+{
+    if (gen() % 5 == 0)
+    {
+        return close_float(gen, other);
+    }
+    return random_operand<F>(gen);
+}
+
+} // namespace aarith
@@ -0,0 +1,156 @@
+#include "../test-signature-ranges.hpp"
+#include "gen_integer.hpp"
+#include <aarith/integer.hpp>
+#include <catch.hpp>
+
+#include <array>
+#include <vector>
+
+using namespace aarith;
+
+namespace {
+
+// all instruction set extensions supported by the processor, the batch operations are tested with
+// each of them
+std::vector<simd_level> supported_levels()
+{
+    std::vector<simd_level> levels{simd_level::scalar};
+    if (static_cast<int>(supported_simd_level()) >= static_cast<int>(simd_level::avx2))
+    {
+        levels.push_back(simd_level::avx2);
+    }
+    if (supported_simd_level() == simd_level::avx512)
+    {
+        levels.push_back(simd_level::avx512);
+    }
+    return levels;
+}
+
+template <typename B, typename Gen> B random_batch(Gen& gen)
+{
+    B batch;
+    for (size_t lane = 0; lane < B::lanes(); ++lane)
+    {
+        gen.next();
+        batch.set(lane, typename B::value_type{gen.get()});
+    }
+    return batch;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("Batches of unsigned integers compute the same results as single integers",
+                       "[integer][unsigned][arithmetic][batch]", ((size_t W, size_t N), W, N),
+                       (16, 1), (16, 13), (64, 4), (64, 16), (100, 9), (128, 8), (256, 19))
+{
+    using B = uinteger_batch<W, N>;
+    using I = uinteger<W>;
+
+    const simd_level level = GENERATE(from_range(supported_levels()));
+    set_batch_simd_level(level);
+
+    auto gen = random_uinteger<W, uint64_t>();
+    const B a = random_batch<B>(gen);
+    B b = random_batch<B>(gen);
+    // some lanes are equal to test the comparisons
+    b.set(0, a.get(0));
+
+    const size_t shift = GENERATE(0, 1, 31, 64, 65, W - 1, W, W + 3);
+
+    const B sum = add(a, b);
+    const B difference = sub(a, b);
+    const B product = mul(a, b);
+    const B conjunction = a & b;
+    const B disjunction = a | b;
+    const B exclusive = a ^ b;
+    const B negation = ~a;
+    const B left = a << shift;
+    const B right = a >> shift;
+    const auto is_less = less(a, b);
+    const auto is_equal = equal(a, b);
+
+    for (size_t lane = 0; lane < N; ++lane)
+    {
+        const I x = a.get(lane);
+        const I y = b.get(lane);
+        REQUIRE(sum.get(lane) == add(x, y));
+        REQUIRE(difference.get(lane) == sub(x, y));
+        REQUIRE(product.get(lane) == mul(x, y));
+        REQUIRE(conjunction.get(lane) == (x & y));
+        REQUIRE(disjunction.get(lane) == (x | y));
+        REQUIRE(exclusive.get(lane) == (x ^ y));
+        REQUIRE(negation.get(lane) == ~x);
+        REQUIRE(left.get(lane) == (x << shift));
+        REQUIRE(right.get(lane) == (x >> shift));
+        REQUIRE(is_less[lane] == (x < y));
+        REQUIRE(is_equal[lane] == (x == y));
+    }
+
+    set_batch_simd_level(supported_simd_level());
+}
+
+TEMPLATE_TEST_CASE_SIG("Batches of signed integers compute the same results as single integers",
+                       "[integer][signed][arithmetic][batch]", ((size_t W, size_t N), W, N),
+                       (16, 5), (64, 8), (100, 11), (256, 4))
+{
+    using B = integer_batch<W, N>;
+    using I = integer<W>;
+
+    const simd_level level = GENERATE(from_range(supported_levels()));
+    set_batch_simd_level(level);
+
+    auto gen = random_integer<W, uint64_t>();
+    const B a = random_batch<B>(gen);
+    B b = random_batch<B>(gen);
+    b.set(0, a.get(0));
+    b.set(N - 1, I::min());
+
+    const size_t shift = GENERATE(0, 1, 63, 64, W - 1, W, W + 1);
+
+    const B sum = add(a, b);
+    const B difference = sub(a, b);
+    const B product = mul(a, b);
+    const B right = a >> shift;
+    const B left = a << shift;
+    const auto is_less = less(a, b);
+    const auto is_equal = equal(a, b);
+
+    for (size_t lane = 0; lane < N; ++lane)
+    {
+        const I x = a.get(lane);
+        const I y = b.get(lane);
+        REQUIRE(sum.get(lane) == add(x, y));
+        REQUIRE(difference.get(lane) == sub(x, y));
+        REQUIRE(product.get(lane) == mul(x, y));
+        REQUIRE(right.get(lane) == (x >> shift));
+        REQUIRE(left.get(lane) == (x << shift));
+        REQUIRE(is_less[lane] == (x < y));
+        REQUIRE(is_equal[lane] == (x == y));
+    }
+
+    set_batch_simd_level(supported_simd_level());
+}
+
+TEMPLATE_TEST_CASE_SIG("Batches with small words use the scalar kernels",
+                       "[integer][unsigned][arithmetic][batch]", AARITH_INT_TEST_SIGNATURE,
+                       (24, uint8_t), (40, uint32_t))
+{
+    using B = uinteger_batch<W, 6, WordType>;
+    using I = uinteger<W, WordType>;
+
+    auto gen = random_uinteger<W, WordType>();
+    const B a = random_batch<B>(gen);
+    const B b = random_batch<B>(gen);
+
+    const B sum = add(a, b);
+    const B product = mul(a, b);
+    const B right = a >> 9;
+    for (size_t lane = 0; lane < B::lanes(); ++lane)
+    {
+        const I x = a.get(lane);
+        const I y = b.get(lane);
+        REQUIRE(sum.get(lane) == add(x, y));
+        REQUIRE(product.get(lane) == mul(x, y));
+        REQUIRE(right.get(lane) == (x >> 9));
+    }
+}
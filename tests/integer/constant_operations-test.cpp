@@ -0,0 +1,95 @@
+#include "../test-signature-ranges.hpp"
+#include "gen_integer.hpp"
+#include <aarith/integer.hpp>
+#include <catch.hpp>
+
+using namespace aarith;
+
+namespace {
+
+constexpr bool is_representable(const int64_t c, const size_t width)
+{
+    return width >= 64 ||
+           (c >= -(int64_t{1} << (width - 1)) && c < (int64_t{1} << (width - 1)));
+}
+
+template <typename I, uint64_t... Constants> void check_unsigned_constants(const I& x)
+{
+    (
+        [&x]() {
+            const auto c = implementation::uinteger_from_constant<I>(Constants);
+            REQUIRE(mul_const<Constants>(x) == mul(x, c));
+            if constexpr (Constants != 0U &&
+                          implementation::constant_fits_width(Constants, I::width()))
+            {
+                REQUIRE(div_const<Constants>(x) == div(x, c));
+                REQUIRE(rem_const<Constants>(x) == remainder(x, c));
+            }
+            else if constexpr (Constants != 0U)
+            {
+                REQUIRE(div_const<Constants>(x) == I::zero());
+                REQUIRE(rem_const<Constants>(x) == x);
+            }
+        }(),
+        ...);
+}
+
+template <typename I, int64_t... Constants> void check_signed_constants(const I& x)
+{
+    (
+        [&x]() {
+            const I c{mul_const<Constants>(I::one())};
+            REQUIRE(mul_const<Constants>(x) == mul(x, c));
+            // the generic operations only see the constant truncated to the width of the integer
+            if constexpr (Constants != 0 && is_representable(Constants, I::width()))
+            {
+                REQUIRE(div_const<Constants>(x) == div(x, c));
+                REQUIRE(rem_const<Constants>(x) == remainder(x, c));
+            }
+        }(),
+        ...);
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("Operations with unsigned constants match the generic operations",
+                       "[integer][unsigned][arithmetic]", AARITH_INT_TEST_SIGNATURE, (8, uint8_t),
+                       (16, uint16_t), (32, uint32_t), (63, uint64_t), (64, uint64_t),
+                       (100, uint8_t), (128, uint64_t), (256, uint32_t), (1000, uint64_t))
+{
+    using I = uinteger<W, WordType>;
+    const I x = GENERATE(take(20, random_uinteger<W, WordType>()), I::max(), I::zero(), I::one());
+
+    check_unsigned_constants<I, 0U, 1U, 2U, 3U, 5U, 7U, 10U, 100U, 255U, 641U, 1000U, 4096U,
+                             1000000007U, 4294967311U, 10000000000000000000U,
+                             18446744073709551615U>(x);
+}
+
+TEMPLATE_TEST_CASE_SIG("Operations with signed constants match the generic operations",
+                       "[integer][signed][arithmetic]", AARITH_INT_TEST_SIGNATURE, (8, uint8_t),
+                       (32, uint32_t), (64, uint64_t), (100, uint8_t), (256, uint64_t))
+{
+    using I = integer<W, WordType>;
+    const I x = GENERATE(take(20, random_integer<W, WordType>()), I::max(), I::min(), I::zero(),
+                         I::minus_one());
+
+    check_signed_constants<I, 0, 1, -1, 3, -3, 10, -10, 127, -128, 1000, -1000000007,
+                           std::numeric_limits<int64_t>::max(),
+                           std::numeric_limits<int64_t>::min()>(x);
+}
+
+SCENARIO("Computing with constants at compile time", "[integer][arithmetic]")
+{
+    GIVEN("A constant number")
+    {
+        constexpr uinteger<200> x = pow(uinteger<200>{10U}, size_t{50});
+        THEN("Dividing and multiplying by constants can be evaluated at compile time")
+        {
+            constexpr uinteger<200> q = div_const<1000>(x);
+            constexpr uinteger<200> r = rem_const<7>(x);
+            constexpr uinteger<200> p = mul_const<1000>(q);
+            REQUIRE(p == x);
+            REQUIRE(r == remainder(x, uinteger<200>{7U}));
+        }
+    }
+}
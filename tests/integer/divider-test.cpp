@@ -0,0 +1,72 @@
+#include "../test-signature-ranges.hpp"
+#include "gen_integer.hpp"
+#include <aarith/integer.hpp>
+#include <catch.hpp>
+
+using namespace aarith;
+
+TEMPLATE_TEST_CASE_SIG("Dividing by a precomputed divider matches the long division",
+                       "[integer][arithmetic][division]", AARITH_INT_EXTENDED_TEST_SIGNATURE,
+                       (uinteger, 8, uint8_t), (integer, 8, uint8_t), (uinteger, 64, uint64_t),
+                       (integer, 64, uint64_t), (uinteger, 150, uint8_t),
+                       (integer, 150, uint16_t), (uinteger, 256, uint64_t),
+                       (integer, 256, uint32_t), (uinteger, 1000, uint64_t))
+{
+    using I = Type<W, WordType>;
+    using Divider = std::conditional_t<is_unsigned_v<I>, uinteger_divider<W, WordType>,
+                                       integer_divider<W, WordType>>;
+
+    const I full = GENERATE(take(5, random_integer<W, WordType>()));
+    const size_t shift = GENERATE(0, W / 2, W - 5);
+    I divisor = full >> shift;
+    if (divisor.is_zero())
+    {
+        divisor = I::one();
+    }
+
+    const Divider divider{divisor};
+    const I numerator =
+        GENERATE(take(10, random_integer<W, WordType>()), I::max(), I::min(), I::zero());
+
+    const auto expected = long_division(numerator, divisor);
+    const auto [quotient, remainder] = divider.divmod(numerator);
+
+    REQUIRE(quotient == expected.first);
+    REQUIRE(remainder == expected.second);
+    REQUIRE(divider.div(numerator) == expected.first);
+    REQUIRE(divider.remainder(numerator) == expected.second);
+    REQUIRE(divider.divisor() == divisor);
+}
+
+SCENARIO("Dividing by special divisors", "[integer][arithmetic][division]")
+{
+    GIVEN("A divisor of zero")
+    {
+        THEN("No divider can be created")
+        {
+            REQUIRE_THROWS_AS(uinteger_divider<128>{uinteger<128>::zero()}, std::runtime_error);
+            REQUIRE_THROWS_AS(integer_divider<128>{integer<128>::zero()}, std::runtime_error);
+        }
+    }
+    GIVEN("A divisor of minus one")
+    {
+        const integer_divider<100, uint32_t> divider{integer<100, uint32_t>::minus_one()};
+        THEN("Dividing the smallest number yields the smallest number")
+        {
+            const auto min = integer<100, uint32_t>::min();
+            REQUIRE(divider.div(min) == min);
+            REQUIRE(divider.remainder(min).is_zero());
+        }
+    }
+    GIVEN("A constant divisor")
+    {
+        THEN("The division can be performed at compile time")
+        {
+            constexpr uinteger_divider<256> divider{uinteger<256>{1000000007U}};
+            constexpr auto result = divider.divmod(uinteger<256>::max());
+            REQUIRE(result.first == div(uinteger<256>::max(), uinteger<256>{1000000007U}));
+            REQUIRE(result.second ==
+                    remainder(uinteger<256>::max(), uinteger<256>{1000000007U}));
+        }
+    }
+}
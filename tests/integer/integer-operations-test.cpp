@@ -528,6 +528,40 @@ TEMPLATE_TEST_CASE_SIG("Unsigned integer multiplication is commutative",
     }
 }
 
+TEMPLATE_TEST_CASE_SIG("Signed multiplications match the naive multiplication",
+                       "[integer][signed][arithmetic][multiplication]", AARITH_INT_TEST_SIGNATURE,
+                       AARITH_INT_TEST_TEMPLATE_PARAM_RANGE, (13, uint8_t), (150, uint32_t),
+                       (257, uint64_t), (2048, uint64_t))
+{
+    constexpr size_t V = W / 3 + 5;
+    using I = integer<W, WordType>;
+    using J = integer<V, WordType>;
+
+    const I a = GENERATE(take(5, random_integer<W, WordType>()), I::min(), I::max(),
+                         I::minus_one());
+    const I b = GENERATE(take(5, random_integer<W, WordType>()), I::min(), I::minus_one());
+    const J c = GENERATE(take(2, random_integer<V, WordType>()), J::min());
+
+    WHEN("Computing with extended bit widths")
+    {
+        const auto expected = naive_expanding_mul(a, b);
+        REQUIRE(signed_expanding_mul(a, b) == expected);
+        REQUIRE(booth_radix4_expanding_mul(a, b) == expected);
+        REQUIRE(expanding_mul(a, b) == expected);
+        REQUIRE(signed_expanding_mul(a, c) == naive_expanding_mul(a, c));
+        REQUIRE(signed_expanding_mul(c, a) == naive_expanding_mul(c, a));
+        REQUIRE(booth_radix4_expanding_mul(a, c) == naive_expanding_mul(a, c));
+        REQUIRE(booth_radix4_expanding_mul(c, a) == naive_expanding_mul(c, a));
+    }
+    WHEN("Computing with truncation")
+    {
+        const I expected = naive_mul(a, b);
+        REQUIRE(signed_mul(a, b) == expected);
+        REQUIRE(booth_radix4_mul(a, b) == expected);
+        REQUIRE(mul(a, b) == expected);
+    }
+}
+
 TEMPLATE_TEST_CASE_SIG("One is the neutral element of the multiplication",
                        "[integer][signed][arithmetic][multiplication]", AARITH_INT_TEST_SIGNATURE,
                        AARITH_INT_TEST_TEMPLATE_PARAM_RANGE)
@@ -1402,6 +1436,122 @@ SCENARIO("Computing the powers of integers", "[integer][signed][operation]")
     }
 }
 
+SCENARIO("Computing powers with a machine word exponent", "[integer][operation]")
+{
+    GIVEN("Small bases and exponents")
+    {
+        THEN("The exponent is the number of factors")
+        {
+            CHECK(pow(uinteger<32>(2), size_t{0}) == uinteger<32>(1));
+            CHECK(pow(uinteger<32>(2), size_t{1}) == uinteger<32>(2));
+            CHECK(pow(uinteger<32>(3), size_t{5}) == uinteger<32>(243));
+            CHECK(pow(integer<32>(-3), size_t{5}) == integer<32>(-243));
+            CHECK(pow(integer<32>(-3), size_t{4}) == integer<32>(81));
+            CHECK(pow(uinteger<200>(2), size_t{199}) == uinteger<200>::one() << 199);
+        }
+        THEN("Huge exponents are handled in logarithmic time")
+        {
+            CHECK(pow(uinteger<64>(1), std::numeric_limits<size_t>::max()) == uinteger<64>(1));
+            CHECK(pow(uinteger<64>(2), std::numeric_limits<size_t>::max()).is_zero());
+            CHECK(pow(integer<64>(-1), std::numeric_limits<size_t>::max()) == integer<64>(-1));
+            // 3 is invertible modulo 2^64 and its multiplicative order divides 2^62
+            CHECK(pow(uinteger<64>(3), size_t{1} << 62U) == uinteger<64>(1));
+        }
+        THEN("The computation can be performed at compile time")
+        {
+            constexpr uinteger<128> result = pow(uinteger<128>(10), size_t{30});
+            CHECK(to_decimal(result) == "1000000000000000000000000000000");
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_SIG("Exponentiation matches repeated multiplication",
+                       "[integer][arithmetic][operation]", AARITH_INT_EXTENDED_TEST_SIGNATURE,
+                       (uinteger, 64, uint64_t), (integer, 64, uint64_t), (uinteger, 150, uint8_t),
+                       (integer, 150, uint8_t), (uinteger, 256, uint64_t),
+                       (integer, 256, uint32_t))
+{
+    using I = Type<W, WordType>;
+    const I base = GENERATE(take(5, random_integer<W, WordType>()));
+    const size_t exponent = GENERATE(0, 1, 2, 3, 7, 16, 33, 100, 255);
+
+    I expected = I::one();
+    for (size_t i = 0; i < exponent; ++i)
+    {
+        expected = mul(expected, base);
+    }
+
+    REQUIRE(pow(base, exponent) == expected);
+    REQUIRE(pow(base, I{static_cast<uint8_t>(exponent)}) == expected);
+}
+
+TEMPLATE_TEST_CASE_SIG("Squaring matches multiplication", "[integer][arithmetic][multiplication]",
+                       AARITH_INT_EXTENDED_TEST_SIGNATURE, (uinteger, 8, uint8_t),
+                       (integer, 32, uint32_t), (uinteger, 64, uint64_t), (integer, 64, uint64_t),
+                       (uinteger, 150, uint8_t), (integer, 150, uint16_t),
+                       (uinteger, 1000, uint64_t), (integer, 1000, uint32_t))
+{
+    using I = Type<W, WordType>;
+    const I a = GENERATE(take(10, random_integer<W, WordType>()), I::max(), I::min(), I::zero());
+
+    REQUIRE(square(a) == mul(a, a));
+    REQUIRE(expanding_square(a) == expanding_mul(a, a));
+}
+
+SCENARIO("Modular exponentiation", "[integer][unsigned][operation]")
+{
+    GIVEN("A Mersenne prime p = 2^127 - 1")
+    {
+        using I = uinteger<128>;
+        const I p = sub(I::one() << 127, I::one());
+        const I a = GENERATE(take(5, random_uinteger<128, uint64_t>()));
+
+        THEN("Fermat's little theorem holds")
+        {
+            const I reduced = remainder(a, p);
+            if (!reduced.is_zero())
+            {
+                REQUIRE(pow_mod(a, sub(p, I::one()), p) == I::one());
+            }
+            REQUIRE(pow_mod(a, p, p) == reduced);
+        }
+    }
+    GIVEN("Numbers fitting into machine words")
+    {
+        const uint32_t base = GENERATE(take(10, random(uint32_t{0}, uint32_t{1000000})));
+        const uint32_t exponent = GENERATE(0U, 1U, 2U, 12345U, 4294967295U);
+        const uint32_t modulus = GENERATE(1U, 2U, 97U, 65521U, 4294967291U);
+
+        uint64_t expected = 1U % modulus;
+        uint64_t b = base % modulus;
+        for (uint32_t e = exponent; e != 0; e >>= 1U)
+        {
+            if ((e & 1U) != 0U)
+            {
+                expected = (expected * b) % modulus;
+            }
+            b = (b * b) % modulus;
+        }
+
+        THEN("The result matches the native computation")
+        {
+            REQUIRE(pow_mod(uinteger<32>{base}, uinteger<32>{exponent}, uinteger<32>{modulus}) ==
+                    uinteger<32>{expected});
+            REQUIRE(pow_mod(uinteger<300, uint32_t>{base}, uinteger<40, uint32_t>{exponent},
+                            uinteger<300, uint32_t>{modulus}) ==
+                    uinteger<300, uint32_t>{expected});
+        }
+    }
+    GIVEN("A modulus of zero")
+    {
+        THEN("An exception is thrown")
+        {
+            REQUIRE_THROWS_AS(pow_mod(uinteger<64>{3U}, uinteger<64>{3U}, uinteger<64>{0U}),
+                              std::runtime_error);
+        }
+    }
+}
+
 TEMPLATE_TEST_CASE_SIG("Bit-wise negation", "[integer][arithmetic][foo]",
                        AARITH_INT_EXTENDED_TEST_SIGNATURE,
                        AARITH_INT_EXTENDED_TEST_TEMPLATE_PARAM_RANGE)
@@ -1418,4 +1568,71 @@ TEMPLATE_TEST_CASE_SIG("Bit-wise negation", "[integer][arithmetic][foo]",
             }
         }
     }
-}
\ No newline at end of file
+}
+
+TEMPLATE_TEST_CASE_SIG("Signed long division matches the restoring division",
+                       "[integer][signed][arithmetic][division]", AARITH_INT_TEST_SIGNATURE,
+                       (24, uint8_t), (65, uint8_t), (150, uint16_t), (150, uint64_t))
+{
+    using I = integer<W, WordType>;
+
+    const I a = GENERATE(take(10, random_integer<W, WordType>()));
+    const I b_ = GENERATE(take(5, random_integer<W, WordType>()));
+    const size_t shift = GENERATE(0U, W / 2, W - 8);
+    const I b = (b_ >> shift).is_zero() ? I::minus_one() : (b_ >> shift);
+
+    const auto [q, r] = long_division(a, b);
+    const auto [q_ref, r_ref] = restoring_division(a, b);
+
+    REQUIRE(q == q_ref);
+    REQUIRE(r == r_ref);
+
+    const auto [q_min, r_min] = long_division(I::min(), b);
+    const auto [q_min_ref, r_min_ref] = restoring_division(I::min(), b);
+    REQUIRE(q_min == q_min_ref);
+    REQUIRE(r_min == r_min_ref);
+}
+
+TEMPLATE_TEST_CASE_SIG("Operations on integers fitting into native integers are bit exact",
+                       "[integer][arithmetic]", AARITH_INT_EXTENDED_TEST_SIGNATURE,
+                       (uinteger, 5, uint8_t), (uinteger, 27, uint16_t), (uinteger, 48, uint16_t),
+                       (uinteger, 48, uint64_t), (uinteger, 64, uint8_t), (uinteger, 65, uint64_t),
+                       (uinteger, 100, uint32_t), (uinteger, 128, uint64_t), (integer, 5, uint8_t),
+                       (integer, 27, uint16_t), (integer, 48, uint16_t), (integer, 48, uint64_t),
+                       (integer, 64, uint8_t), (integer, 65, uint64_t), (integer, 100, uint32_t),
+                       (integer, 128, uint64_t))
+{
+    // the wide type does not fit into a native integer and uses the word based algorithms
+    constexpr size_t Wide = 320;
+    using I = Type<W, WordType>;
+    using L = Type<Wide, WordType>;
+
+    using U = uinteger<W, WordType>;
+
+    const U a_bits = GENERATE(take(15, random_uinteger<W, WordType>()), U{I::max()}, U{I::min()});
+    const U b_bits =
+        GENERATE(take(15, random_uinteger<W, WordType>()), U{I::max()}, U{I::min()}, U::one());
+    const I a{a_bits};
+    const I b{b_bits};
+
+    const L a_ = width_cast<Wide>(a);
+    const L b_ = width_cast<Wide>(b);
+
+    REQUIRE(add(a, b) == width_cast<W>(add(a_, b_)));
+    REQUIRE(sub(a, b) == width_cast<W>(sub(a_, b_)));
+    REQUIRE(expanding_add(a, b) == width_cast<W + 1>(add(a_, b_)));
+    REQUIRE(mul(a, b) == width_cast<W>(mul(a_, b_)));
+    REQUIRE(expanding_mul(a, b) == width_cast<2 * W>(mul(a_, b_)));
+    REQUIRE((a < b) == (a_ < b_));
+    REQUIRE((b < a) == (b_ < a_));
+
+    if (!b.is_zero())
+    {
+        REQUIRE(div(a, b) == width_cast<W>(div(a_, b_)));
+        REQUIRE(remainder(a, b) == width_cast<W>(remainder(a_, b_)));
+    }
+
+    const size_t shift = GENERATE(1U, W / 2, W - 1);
+    REQUIRE((a << shift) == width_cast<W>(a_ << shift));
+    REQUIRE((a >> shift) == width_cast<W>(a_ >> shift));
+}
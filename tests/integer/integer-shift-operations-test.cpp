@@ -2,6 +2,7 @@
 #include <catch.hpp>
 
 #include "../test-signature-ranges.hpp"
+#include "gen_integer.hpp"
 
 using namespace aarith;
 
@@ -286,3 +287,49 @@ TEMPLATE_TEST_CASE_SIG("Left/right shifting signed integers",
         }
     }
 }
+
+namespace {
+
+template <typename U, typename S, size_t... Ns> void check_constant_shifts(const U& u, const S& s)
+{
+    (
+        [&u, &s]() {
+            REQUIRE(shift_left<Ns>(u) == (u << Ns));
+            REQUIRE(shift_right<Ns>(u) == (u >> Ns));
+            REQUIRE(shift_left<Ns>(s) == (s << Ns));
+            REQUIRE(arithmetic_shift_right<Ns>(s) == (s >> Ns));
+
+            U rotated_left{u};
+            rotate_left(rotated_left, Ns % U::width());
+            U rotated_right{u};
+            rotate_right(rotated_right, Ns % U::width());
+            if constexpr (Ns % U::width() != 0)
+            {
+                REQUIRE(rotate_left<Ns>(u) == rotated_left);
+                REQUIRE(rotate_right<Ns>(u) == rotated_right);
+            }
+            else
+            {
+                REQUIRE(rotate_left<Ns>(u) == u);
+                REQUIRE(rotate_right<Ns>(u) == u);
+            }
+        }(),
+        ...);
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("Shifting by constants matches shifting by run time values",
+                       "[integer][utility]", AARITH_INT_TEST_SIGNATURE, (8, uint8_t),
+                       (13, uint8_t), (32, uint16_t), (64, uint64_t), (65, uint32_t),
+                       (100, uint8_t), (128, uint64_t), (150, uint64_t), (256, uint32_t))
+{
+    using U = uinteger<W, WordType>;
+    using S = integer<W, WordType>;
+
+    const U u = GENERATE(take(20, random_uinteger<W, WordType>()), U::all_ones(), U::zero());
+    const S s{u};
+
+    check_constant_shifts<U, S, 0, 1, 3, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 99, 127,
+                          128, 129, 200, 255, 256, 300>(u, s);
+}
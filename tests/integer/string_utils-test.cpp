@@ -1,3 +1,5 @@
+#include "../test-signature-ranges.hpp"
+#include "gen_integer.hpp"
 #include <aarith/integer_no_operators.hpp>
 
 #include <catch.hpp>
@@ -204,3 +206,29 @@ SCENARIO("Removing leading zeroes from string representations", "[utility][strin
         }
     }
 }
+
+TEMPLATE_TEST_CASE_SIG("Converting multi-word unsigned integers into decimal strings",
+                       "[integer][unsigned][string][utility]", AARITH_INT_TEST_SIGNATURE,
+                       (24, uint8_t), (150, uint16_t), (150, uint32_t), (1025, uint64_t))
+{
+    using I = uinteger<W, WordType>;
+    const I a = GENERATE(take(20, random_uinteger<W, WordType>()));
+
+    THEN("The string matches the conversion via binary coded decimals")
+    {
+        REQUIRE(to_decimal(a) == remove_leading_zeroes(to_hex(to_bcd(a))));
+    }
+    THEN("Leading zeroes of inner chunks are kept")
+    {
+        const I ten_pow = I{10U};
+        I value = I::one();
+        std::string expected = "1";
+        for (size_t i = 0; i < W / 4; ++i)
+        {
+            value = mul(value, ten_pow);
+            expected += "0";
+        }
+        REQUIRE(to_decimal(value) == expected);
+        REQUIRE(to_decimal(I::zero()) == "0");
+    }
+}
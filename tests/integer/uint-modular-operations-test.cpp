@@ -0,0 +1,125 @@
+#include "../test-signature-ranges.hpp"
+#include "gen_integer.hpp"
+#include <aarith/integer_no_operators.hpp>
+#include <catch.hpp>
+
+using namespace aarith;
+
+namespace {
+
+/// Reference implementation computing the modular power using one division per step
+template <size_t W, size_t E, typename WordType>
+uinteger<W, WordType> reference_pow_mod(const uinteger<W, WordType>& base,
+                                        const uinteger<E, WordType>& exponent,
+                                        const uinteger<W, WordType>& modulus)
+{
+    using D = uinteger<2 * W, WordType>;
+    const D m = width_cast<2 * W>(modulus);
+    uinteger<W, WordType> result = remainder(uinteger<W, WordType>::one(), modulus);
+    uinteger<W, WordType> b = remainder(base, modulus);
+    for (size_t i = 0; i < E; ++i)
+    {
+        if (exponent.bit(i))
+        {
+            result = width_cast<W>(remainder(expanding_mul(result, b), m));
+        }
+        b = width_cast<W>(remainder(expanding_mul(b, b), m));
+    }
+    return result;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("Montgomery multiplication matches the multiplication with a division",
+                       "[integer][unsigned][arithmetic][modular]", AARITH_INT_TEST_SIGNATURE,
+                       (8, uint8_t), (64, uint64_t), (150, uint8_t), (256, uint64_t),
+                       (1000, uint16_t), (1024, uint32_t), (2048, uint64_t))
+{
+    using I = uinteger<W, WordType>;
+    using D = uinteger<2 * W, WordType>;
+
+    I modulus = GENERATE(take(3, random_uinteger<W, WordType>()), I::max());
+    modulus.set_bit(0);
+    if (modulus == I::one())
+    {
+        modulus = I{WordType{3U}};
+    }
+
+    const montgomery_context<W, WordType> context{modulus};
+
+    const I a = GENERATE(take(3, random_uinteger<W, WordType>()), I::max(), I::zero());
+    const I b = GENERATE(take(3, random_uinteger<W, WordType>()), I::one());
+
+    const D wide_modulus = width_cast<2 * W>(modulus);
+    const I expected_product = width_cast<W>(
+        remainder(expanding_mul(remainder(a, modulus), remainder(b, modulus)), wide_modulus));
+
+    const I a_mont = context.to_mont(a);
+    const I b_mont = context.to_mont(b);
+
+    THEN("Converting into and out of Montgomery form yields the reduced number")
+    {
+        REQUIRE(a_mont < modulus);
+        REQUIRE(context.from_mont(a_mont) == remainder(a, modulus));
+        REQUIRE(context.from_mont(context.one()) == I::one());
+    }
+    THEN("The Montgomery product is the modular product")
+    {
+        REQUIRE(context.from_mont(context.mont_mul(a_mont, b_mont)) == expected_product);
+        REQUIRE(context.mont_sqr(a_mont) == context.mont_mul(a_mont, a_mont));
+    }
+    THEN("The Montgomery power is the modular power")
+    {
+        const uinteger<40, WordType> exponent = GENERATE(
+            take(2, random_uinteger<40, WordType>()), uinteger<40, WordType>::zero());
+        REQUIRE(context.from_mont(context.mont_pow(a_mont, exponent)) ==
+                reference_pow_mod(a, exponent, modulus));
+        REQUIRE(pow_mod(a, exponent, modulus) == reference_pow_mod(a, exponent, modulus));
+    }
+}
+
+SCENARIO("Montgomery arithmetic with special moduli", "[integer][unsigned][arithmetic][modular]")
+{
+    GIVEN("An even modulus")
+    {
+        THEN("No context can be created")
+        {
+            REQUIRE_THROWS_AS(montgomery_context<128>{uinteger<128>{10U}}, std::invalid_argument);
+        }
+        THEN("pow_mod still computes the modular power")
+        {
+            const uinteger<128> modulus = uinteger<128>::one() << 100;
+            const uinteger<128> base{3U};
+            const uinteger<64> exponent = uinteger<64>::max();
+            REQUIRE(pow_mod(base, exponent, modulus) == reference_pow_mod(base, exponent, modulus));
+        }
+    }
+    GIVEN("The Mersenne prime 2^521 - 1")
+    {
+        using I = uinteger<521, uint64_t>;
+        const I p = sub(I::max(), I::zero());
+        const montgomery_context<521, uint64_t> context{p};
+        const I a = GENERATE(take(3, random_uinteger<521, uint64_t>()));
+
+        THEN("Fermat's little theorem holds")
+        {
+            if (!remainder(a, p).is_zero())
+            {
+                REQUIRE(context.from_mont(context.mont_pow(context.to_mont(a), sub(p, I::one()))) ==
+                        I::one());
+            }
+        }
+    }
+    GIVEN("A constant modulus")
+    {
+        THEN("The computation can be performed at compile time")
+        {
+            using I = uinteger<128, uint32_t>;
+            constexpr I modulus = sub(I::max(), I{uint32_t{158U}}); // 2^128 - 159 is prime
+            constexpr montgomery_context<128, uint32_t> context{modulus};
+            constexpr I result = context.from_mont(
+                context.mont_pow(context.to_mont(I{uint32_t{2U}}), sub(modulus, I::one())));
+            REQUIRE(result == I::one());
+        }
+    }
+}
@@ -107,6 +107,42 @@ TEMPLATE_TEST_CASE_SIG("Addition wraps around correctly",
     }
 }
 
+TEMPLATE_TEST_CASE_SIG("Word-wise addition and subtraction match a ripple carry adder",
+                       "[integer][unsigned][arithmetic][addition]", AARITH_INT_TEST_SIGNATURE,
+                       (24, uint8_t), (65, uint8_t), (65, uint16_t), (150, uint32_t),
+                       (128, uint64_t), (150, uint64_t), (1025, uint64_t))
+{
+    using I = uinteger<W, WordType>;
+    using R = uinteger<W + 1, WordType>;
+
+    const I a = GENERATE(take(10, random_uinteger<W, WordType>()), I::max(), I::zero());
+    const I b = GENERATE(take(10, random_uinteger<W, WordType>()), I::max(), I::one());
+    const bool initial_carry = GENERATE(false, true);
+
+    R expected_sum;
+    I expected_difference;
+    bool carry = initial_carry;
+    bool borrow = false;
+    for (size_t i = 0; i < W; ++i)
+    {
+        const bool bit_a = a.bit(i);
+        const bool bit_b = b.bit(i);
+        expected_sum.set_bit(i, (bit_a != bit_b) != carry);
+        carry = (bit_a && bit_b) || (carry && (bit_a != bit_b));
+        expected_difference.set_bit(i, (bit_a != bit_b) != borrow);
+        borrow = (!bit_a && bit_b) || (borrow && (bit_a == bit_b));
+    }
+    expected_sum.set_bit(W, carry);
+
+    REQUIRE(expanding_add(a, b, initial_carry) == expected_sum);
+    if (!initial_carry)
+    {
+        REQUIRE(add(a, b) == width_cast<W>(expected_sum));
+        REQUIRE(sub(a, b) == expected_difference);
+        REQUIRE(expanding_sub(a, b) == expected_difference);
+    }
+}
+
 TEMPLATE_TEST_CASE_SIG("Zero is the neutral element of the subtraction",
                        "[integer][unsigned][arithmetic][subtraction]", AARITH_INT_TEST_SIGNATURE,
                        AARITH_INT_TEST_TEMPLATE_PARAM_RANGE)
@@ -260,6 +296,189 @@ TEMPLATE_TEST_CASE_SIG("Multiplying the max value with itself and truncation yie
     REQUIRE(karazuba(a, a) == I::one());
 }
 
+TEMPLATE_TEST_CASE_SIG("Word-wise schoolbook multiplication matches shift-and-add multiplication",
+                       "[integer][unsigned][arithmetic][multiplication]", AARITH_INT_TEST_SIGNATURE,
+                       (24, uint8_t), (65, uint8_t), (65, uint16_t), (150, uint16_t),
+                       (150, uint32_t), (128, uint64_t), (150, uint64_t), (1025, uint64_t))
+{
+    constexpr size_t V = W / 2 + 3;
+    using I = uinteger<W, WordType>;
+    using J = uinteger<V, WordType>;
+    using R = uinteger<W + V, WordType>;
+
+    const I a = GENERATE(take(10, random_uinteger<W, WordType>()));
+    const J b = GENERATE(take(5, random_uinteger<V, WordType>()));
+
+    R expected{R::zero()};
+    for (size_t i = 0; i < V; ++i)
+    {
+        if (b.bit(i))
+        {
+            expected = add(expected, width_cast<W + V>(a) << i);
+        }
+    }
+
+    THEN("The expanding multiplication is exact")
+    {
+        REQUIRE(schoolbook_expanding_mul(a, b) == expected);
+        REQUIRE(schoolbook_expanding_mul(b, a) == expected);
+    }
+
+    THEN("The truncating multiplication yields the least significant bits")
+    {
+        const I b_ = width_cast<W>(b);
+        REQUIRE(schoolbook_mul(a, b_) == width_cast<W>(expected));
+        REQUIRE(schoolbook_mul(b_, a) == width_cast<W>(expected));
+    }
+}
+
+SCENARIO("Multiplying the maximal values of multi-word unsigned integers",
+         "[integer][unsigned][arithmetic][multiplication]")
+{
+    GIVEN("The maximal value of a 256 bit unsigned integer")
+    {
+        using I = uinteger<256, uint64_t>;
+        using R = uinteger<512, uint64_t>;
+        constexpr I a = I::max();
+        THEN("Squaring it yields (2^256-1)^2 = 2^512 - 2^257 + 1")
+        {
+            constexpr R result = schoolbook_expanding_mul(a, a);
+            const R expected = add(sub(R::zero(), R::one() << 257), R::one());
+            REQUIRE(result == expected);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_SIG("Toom-Cook multiplication matches the schoolbook multiplication",
+                       "[integer][unsigned][arithmetic][multiplication]", AARITH_INT_TEST_SIGNATURE,
+                       (150, uint8_t), (1025, uint16_t), (4000, uint8_t), (5000, uint32_t),
+                       (16384, uint64_t), (32768, uint64_t))
+{
+    constexpr size_t V = W / 3 + 70;
+    using I = uinteger<W, WordType>;
+    using J = uinteger<V, WordType>;
+
+    const I a = GENERATE(take(3, random_uinteger<W, WordType>()), I::max(), I::one() << (W / 2));
+    const I b = GENERATE(take(2, random_uinteger<W, WordType>()), I::max());
+    const J c = GENERATE(take(2, random_uinteger<V, WordType>()), J::max());
+
+    const auto expected = schoolbook_expanding_mul(a, b);
+
+    THEN("Toom-Cook 3 computes the exact product")
+    {
+        REQUIRE(expanding_toom3(a, b) == expected);
+        REQUIRE(expanding_toom3(a, c) == schoolbook_expanding_mul(a, c));
+        REQUIRE(expanding_toom3(c, a) == schoolbook_expanding_mul(c, a));
+    }
+    THEN("Toom-Cook 4 computes the exact product")
+    {
+        REQUIRE(expanding_toom4(a, b) == expected);
+        REQUIRE(expanding_toom4(a, c) == schoolbook_expanding_mul(a, c));
+        REQUIRE(expanding_toom4(c, a) == schoolbook_expanding_mul(c, a));
+    }
+    THEN("The dispatching expanding multiplication computes the exact product")
+    {
+        REQUIRE(expanding_mul(a, b) == expected);
+    }
+    THEN("Multiplying with zero yields zero")
+    {
+        REQUIRE(expanding_toom3(a, I::zero()).is_zero());
+        REQUIRE(expanding_toom4(I::zero(), b).is_zero());
+    }
+}
+
+TEMPLATE_TEST_CASE_SIG("Karatsuba multiplication matches the schoolbook multiplication",
+                       "[integer][unsigned][arithmetic][multiplication]", AARITH_INT_TEST_SIGNATURE,
+                       (150, uint8_t), (1025, uint16_t), (1600, uint64_t), (2048, uint64_t),
+                       (3001, uint32_t), (8192, uint64_t))
+{
+    constexpr size_t V = W / 3 + 70;
+    using I = uinteger<W, WordType>;
+    using J = uinteger<V, WordType>;
+
+    const I a = GENERATE(take(3, random_uinteger<W, WordType>()), I::max(), I::one() << (W / 2));
+    const I b = GENERATE(take(2, random_uinteger<W, WordType>()), I::max());
+    const J c = GENERATE(take(2, random_uinteger<V, WordType>()), J::max());
+
+    THEN("Karatsuba computes the exact product")
+    {
+        REQUIRE(expanding_karazuba(a, b) == schoolbook_expanding_mul(a, b));
+    }
+    THEN("Factors of different widths are multiplied exactly")
+    {
+        REQUIRE(expanding_karazuba(a, c) == schoolbook_expanding_mul(a, c));
+        REQUIRE(expanding_karazuba(c, a) == schoolbook_expanding_mul(c, a));
+    }
+    THEN("The dispatching expanding multiplication computes the exact product")
+    {
+        REQUIRE(expanding_mul(a, b) == schoolbook_expanding_mul(a, b));
+    }
+}
+
+SCENARIO("Multiplying wide unsigned integers by computing the full product",
+         "[integer][unsigned][arithmetic][multiplication]")
+{
+    GIVEN("Numbers as wide as the threshold for computing the full product")
+    {
+        using I = uinteger<AARITH_MUL_EXPANDING_THRESHOLD + 64>;
+        const I a = GENERATE(take(2, random_uinteger<I::width(), uint64_t>()), I::max());
+        const I b = GENERATE(take(2, random_uinteger<I::width(), uint64_t>()), I::max());
+
+        THEN("The truncated product matches the schoolbook multiplication")
+        {
+            REQUIRE(mul(a, b) == schoolbook_mul(a, b));
+        }
+    }
+}
+
+SCENARIO("Using the karatsuba multiplication at compile time",
+         "[integer][unsigned][arithmetic][multiplication][constexpr]")
+{
+    GIVEN("Numbers wide enough for at least one level of recursion")
+    {
+        using I = uinteger<2 * AARITH_KARATSUBA_THRESHOLD>;
+        constexpr I a = I::max();
+        constexpr auto square = expanding_karazuba(a, a);
+
+        THEN("The product is computed exactly")
+        {
+            // (2^n - 1)^2 = 2^2n - 2^(n+1) + 1
+            constexpr auto expected =
+                add(sub(uinteger<2 * I::width()>::zero(), uinteger<2 * I::width()>::one()
+                                                              << (I::width() + 1)),
+                    uinteger<2 * I::width()>::one());
+            static_assert(square == expected);
+            REQUIRE(square == expected);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_SIG("NTT multiplication matches the schoolbook multiplication",
+                       "[integer][unsigned][arithmetic][multiplication]", AARITH_INT_TEST_SIGNATURE,
+                       (8, uint8_t), (150, uint8_t), (1025, uint16_t), (3000, uint32_t),
+                       (4096, uint64_t), (20000, uint64_t))
+{
+    constexpr size_t V = W / 3 + 70;
+    using I = uinteger<W, WordType>;
+    using J = uinteger<V, WordType>;
+
+    const I a = GENERATE(take(3, random_uinteger<W, WordType>()), I::max(), I::one() << (W / 2));
+    const I b = GENERATE(take(2, random_uinteger<W, WordType>()), I::max());
+    const J c = GENERATE(take(2, random_uinteger<V, WordType>()), J::max());
+
+    THEN("The number theoretic transform computes the exact product")
+    {
+        REQUIRE(expanding_ntt_mul(a, b) == schoolbook_expanding_mul(a, b));
+        REQUIRE(expanding_ntt_mul(a, c) == schoolbook_expanding_mul(a, c));
+        REQUIRE(expanding_ntt_mul(c, a) == schoolbook_expanding_mul(c, a));
+    }
+    THEN("Multiplying with zero yields zero")
+    {
+        REQUIRE(expanding_ntt_mul(a, I::zero()).is_zero());
+        REQUIRE(expanding_ntt_mul(J::zero(), b).is_zero());
+    }
+}
+
 SCENARIO("Adding two unsigned integers exactly", "[integer][unsigned][arithmetic][addition]")
 {
     GIVEN("Two uinteger<N> a and b with N <= word_width")
@@ -1048,6 +1267,67 @@ TEMPLATE_TEST_CASE_SIG("Invariants for the unsigned integer division",
     }
 }
 
+TEMPLATE_TEST_CASE_SIG("Long division matches the restoring division",
+                       "[integer][unsigned][arithmetic][division]", AARITH_INT_TEST_SIGNATURE,
+                       (24, uint8_t), (65, uint8_t), (150, uint8_t), (150, uint16_t),
+                       (150, uint32_t), (128, uint64_t), (150, uint64_t), (300, uint64_t))
+{
+    using I = uinteger<W, WordType>;
+
+    const I a = GENERATE(take(10, random_uinteger<W, WordType>()));
+    const I b_ = GENERATE(take(5, random_uinteger<W, WordType>()));
+    // vary the number of significant words of the denominator
+    const size_t shift = GENERATE(0U, 1U, W / 3, W / 2, W - 8);
+    const I b = (b_ >> shift).is_zero() ? I::one() : (b_ >> shift);
+
+    const auto [q, r] = long_division(a, b);
+    const auto [q_ref, r_ref] = restoring_division(a, b);
+
+    CHECK(q == q_ref);
+    CHECK(r == r_ref);
+    REQUIRE(add(mul(q, b), r) == a);
+    REQUIRE(r < b);
+}
+
+SCENARIO("Long division corrects the estimated quotient words",
+         "[integer][unsigned][arithmetic][division]")
+{
+    GIVEN("Numbers for which the first estimate of the quotient word is too large")
+    {
+        using I = uinteger<256, uint64_t>;
+        // examples from Hacker's Delight, scaled to 64 bit words
+        const I a = I::from_words(0x7fff800000000000ULL, 0U, 0U, 0U);
+        const I b = I::from_words(0x8000000000000000ULL, 1U);
+        const I c = I::from_words(0x8000000000000000ULL, 0U, 0U, 3U);
+        const I d = I::from_words(0x2000000000000001ULL, 0U);
+        const I e = I::from_words(0xffffffffffffffffULL, 0xfffffffffffffffeULL, 0U);
+
+        THEN("The long division yields the same results as the restoring division")
+        {
+            REQUIRE(long_division(a, b) == restoring_division(a, b));
+            REQUIRE(long_division(c, d) == restoring_division(c, d));
+            REQUIRE(long_division(I::max(), b) == restoring_division(I::max(), b));
+            REQUIRE(long_division(I::max(), d) == restoring_division(I::max(), d));
+            REQUIRE(long_division(I::max(), e) == restoring_division(I::max(), e));
+            REQUIRE(long_division(e, d) == restoring_division(e, d));
+        }
+    }
+    GIVEN("Multi-word numbers")
+    {
+        using I = uinteger<256, uint64_t>;
+        constexpr I a = I::max();
+        constexpr I b = I::from_words(0U, 1U, 0U, 0U);
+        THEN("The division can be computed at compile time")
+        {
+            constexpr I q = div(a, b);
+            constexpr I r = remainder(a, b);
+            constexpr I expected = I::from_words(0xffffffffffffffffULL, 0xffffffffffffffffULL);
+            REQUIRE(q == expected);
+            REQUIRE(r == expected);
+        }
+    }
+}
+
 SCENARIO("Dividing two unsigned integers exactly", "[integer][unsigned][arithmetic][division]")
 {
     GIVEN("Two uinteger<N> a and b with N <= 32")
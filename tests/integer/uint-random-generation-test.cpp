@@ -46,6 +46,23 @@ TEMPLATE_TEST_CASE_SIG("Generating exactly one number with more than one word wo
     }
 }
 
+TEMPLATE_TEST_CASE_SIG("Distributions over empty ranges are rejected",
+                       "[integer][unsigned][utility][random]",
+                       ((size_t W, typename WordType), W, WordType), (8, uint8_t), (70, uint32_t),
+                       (150, uint64_t))
+{
+    using I = uinteger<W, WordType>;
+    using D = uniform_uinteger_distribution<W, WordType>;
+
+    const I val{42U};
+    const std::string message{"uniform_uinteger_distribution: a must be <= b"};
+
+    // the lower bound directly above the upper bound used to fail creating a divider by zero
+    REQUIRE_THROWS_WITH(D(add(val, I::one()), val), message);
+    REQUIRE_THROWS_WITH(D(I::max(), I::zero()), message);
+    REQUIRE_NOTHROW(D(val, val));
+}
+
 TEMPLATE_TEST_CASE_SIG("The generated numbers are in the given range",
                        "[integer][unsigned][utility][random]",
                        ((size_t W, typename WordType, size_t L, size_t U), W, WordType, L, U),